@@ -16,6 +16,9 @@ if [ "$modified" ]; then
     exit 1
 fi
 
+# ensure the thrift generated files are not modified by hand
+"${root}"/src/idl/recompile_thrift.sh --check || exit 1
+
 "${root}"/run.sh build -c --skip_thirdparty --disable_gperf && ./run.sh test --on_travis
 ret=$?
 if [ $ret ]; then
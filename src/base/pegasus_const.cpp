@@ -15,6 +15,18 @@ const std::string ROCKSDB_ENV_USAGE_SCENARIO_KEY("rocksdb.usage_scenario");
 const std::string ROCKSDB_ENV_USAGE_SCENARIO_NORMAL("normal");
 const std::string ROCKSDB_ENV_USAGE_SCENARIO_PREFER_WRITE("prefer_write");
 const std::string ROCKSDB_ENV_USAGE_SCENARIO_BULK_LOAD("bulk_load");
+/// The following usage scenarios change the compaction style, which takes effect when the
+/// replica is opened, that is, after the env is set and the replicas are reopened:
+///   * "time_series": FIFO compaction for append-only tables whose records all have ttl, the
+///     oldest files are dropped once all records in them expire, without any rewrite.
+///     FIFO compaction requires all files in level 0, so a table with files in other levels
+///     should be compacted with "manual_compact.once.target_level=0" before reopened,
+///     otherwise it is opened with level compaction.
+///   * "write_heavy": universal compaction, which has lower write amplification than level
+///     compaction at the cost of space amplification.
+/// Switching from these scenarios to the others restores level compaction after reopened.
+const std::string ROCKSDB_ENV_USAGE_SCENARIO_TIME_SERIES("time_series");
+const std::string ROCKSDB_ENV_USAGE_SCENARIO_WRITE_HEAVY("write_heavy");
 
 /// A task of manual compaction can be triggered by update of app environment variables as follows:
 /// Periodic manual compaction: triggered every day at the given `trigger_time`.
@@ -27,7 +39,8 @@ const std::string ROCKSDB_ENV_USAGE_SCENARIO_BULK_LOAD("bulk_load");
 /// Executed-once manual compaction: Triggered only at the specified unix time.
 /// ```
 /// manual_compact.once.trigger_time=1525930272                 // required
-/// manual_compact.once.target_level=-1                         // optional, default -1
+/// manual_compact.once.target_level=-1                         // optional, default -1,
+///                                                             // 0 moves all data to level 0
 /// manual_compact.once.bottommost_level_compaction=force       // optional, default force
 /// ```
 ///
@@ -69,4 +82,45 @@ const std::string PEGASUS_CLUSTER_SECTION_NAME("pegasus.clusters");
 
 /// table level slow query
 const std::string ROCKSDB_ENV_SLOW_QUERY_THRESHOLD("replica.slow_query_threshold");
+
+/// table level mode of sortkey_count:
+///   * "scan": default, count by scanning all records of the hash key.
+///   * "maintain": the write path maintains a count record for each hash key, but sortkey_count
+///     still counts by scanning. It can be used to verify the count records against the scan.
+///   * "meta": maintain the count records, and sortkey_count reads them directly, which falls
+///     back to scanning until the count record of the hash key is ready.
+/// The primary switches between "scan" and the other modes by a write, so that all the replicas
+/// switch at the same decree, and the count records written before are dropped by compaction.
+/// Once written, a hash key without a valid count record is recounted in background, which
+/// happens after the switch, or once any counted record with ttl may have expired. Tables with
+/// 'default_ttl' always count by scanning.
+const std::string SORTKEY_COUNT_MODE_KEY("replica.sortkey_count_mode");
+const std::string SORTKEY_COUNT_MODE_SCAN("scan");
+const std::string SORTKEY_COUNT_MODE_MAINTAIN("maintain");
+const std::string SORTKEY_COUNT_MODE_META("meta");
+
+/// table level block cache isolation:
+///   * "replica.block_cache.capacity": if > 0, replicas of the table on each server use a block
+///     cache of this capacity in bytes dedicated to the table, instead of the block cache shared
+///     by all tables, so that the table can neither evict nor be evicted by other tables.
+///     Changing the capacity takes effect immediately, but switching between the dedicated and
+///     the shared block cache takes effect after the replicas are reopened.
+///   * "replica.block_cache.scan_fill_cache": default true, if false, blocks read by scans are
+///     not inserted into the block cache, which is useful for batch tables to avoid polluting
+///     the block cache.
+const std::string ROCKSDB_ENV_BLOCK_CACHE_CAPACITY("replica.block_cache.capacity");
+const std::string ROCKSDB_ENV_SCAN_FILL_BLOCK_CACHE("replica.block_cache.scan_fill_cache");
+
+/// table level bulk ingestion: the dir of sst files built by pegasus_sst_builder (e.g. by the
+/// 'build_ingest_sst' shell command), which must be accessible by all replica servers. Once
+/// the env is set or changed, the primary checks the build and sends a BULK_INGEST write to
+/// itself, and each replica ingests the files of its partition into rocksdb when the write is
+/// applied, so the ingested records override the records written before it and are overridden
+/// by the records written after it on all the replicas. The ingestion of the same build is
+/// done only once. A replica which fails to ingest the files is removed and learns the data
+/// from the others. The partition count of the build must be the same as the table, which is
+/// known once the partition version is set. Ingested records bypass the write path, so they
+/// are not duplicated to other clusters, and the ingestion is refused unless
+/// 'replica.sortkey_count_mode' is 'scan'.
+const std::string ROCKSDB_ENV_BULK_INGEST_DIR("replica.bulk_ingest.dir");
 } // namespace pegasus
@@ -20,6 +20,8 @@ extern const std::string ROCKSDB_ENV_USAGE_SCENARIO_KEY;
 extern const std::string ROCKSDB_ENV_USAGE_SCENARIO_NORMAL;
 extern const std::string ROCKSDB_ENV_USAGE_SCENARIO_PREFER_WRITE;
 extern const std::string ROCKSDB_ENV_USAGE_SCENARIO_BULK_LOAD;
+extern const std::string ROCKSDB_ENV_USAGE_SCENARIO_TIME_SERIES;
+extern const std::string ROCKSDB_ENV_USAGE_SCENARIO_WRITE_HEAVY;
 
 extern const std::string MANUAL_COMPACT_KEY_PREFIX;
 extern const std::string MANUAL_COMPACT_DISABLED_KEY;
@@ -45,4 +47,14 @@ extern const std::string ROCKDB_CHECKPOINT_RESERVE_TIME_SECONDS;
 extern const std::string PEGASUS_CLUSTER_SECTION_NAME;
 
 extern const std::string ROCKSDB_ENV_SLOW_QUERY_THRESHOLD;
+
+extern const std::string SORTKEY_COUNT_MODE_KEY;
+extern const std::string SORTKEY_COUNT_MODE_SCAN;
+extern const std::string SORTKEY_COUNT_MODE_MAINTAIN;
+extern const std::string SORTKEY_COUNT_MODE_META;
+
+extern const std::string ROCKSDB_ENV_BLOCK_CACHE_CAPACITY;
+extern const std::string ROCKSDB_ENV_SCAN_FILL_BLOCK_CACHE;
+
+extern const std::string ROCKSDB_ENV_BULK_INGEST_DIR;
 } // namespace pegasus
@@ -156,4 +156,16 @@ inline uint64_t pegasus_hash_key_hash(const ::dsn::blob &hash_key)
     return dsn::utils::crc64_calc(hash_key.data(), hash_key.length(), 0);
 }
 
+/// Check whether a record with hash value `key_hash` belongs to partition `pidx`, where
+/// `partition_version` is (partition_count - 1), the partition count is always a power of 2.
+/// Return false if `partition_version` is invalid, which means the partition is splitting
+/// and should not serve any request.
+inline bool check_pegasus_key_hash(uint64_t key_hash, int32_t pidx, int32_t partition_version)
+{
+    if (partition_version < 0 || pidx > partition_version) {
+        return false;
+    }
+    return static_cast<int32_t>(key_hash & partition_version) == pidx;
+}
+
 } // namespace pegasus
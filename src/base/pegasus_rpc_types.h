@@ -19,6 +19,9 @@ using remove_rpc = dsn::rpc_holder<dsn::blob, dsn::apps::update_response>;
 
 using incr_rpc = dsn::rpc_holder<dsn::apps::incr_request, dsn::apps::incr_response>;
 
+using multi_incr_rpc =
+    dsn::rpc_holder<dsn::apps::multi_incr_request, dsn::apps::multi_incr_response>;
+
 using check_and_set_rpc =
     dsn::rpc_holder<dsn::apps::check_and_set_request, dsn::apps::check_and_set_response>;
 
@@ -27,4 +30,9 @@ using duplicate_rpc = dsn::apps::duplicate_rpc;
 using check_and_mutate_rpc =
     dsn::rpc_holder<dsn::apps::check_and_mutate_request, dsn::apps::check_and_mutate_response>;
 
+using maintain_sortkey_count_rpc =
+    dsn::rpc_holder<dsn::apps::maintain_sortkey_count_request, dsn::apps::update_response>;
+
+using bulk_ingest_rpc = dsn::rpc_holder<dsn::apps::bulk_ingest_request, dsn::apps::update_response>;
+
 } // namespace pegasus
@@ -0,0 +1,212 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "pegasus_sst_builder.h"
+
+#include <algorithm>
+#include <fstream>
+#include <rocksdb/options.h>
+#include <rocksdb/sst_file_writer.h>
+#include <dsn/utility/filesystem.h>
+#include <dsn/utility/rand.h>
+#include <dsn/utility/string_conv.h>
+
+#include "base/pegasus_key_schema.h"
+
+namespace pegasus {
+
+const std::string INGEST_META_FILE("INGEST_META");
+
+std::string ingest_marker_key(uint64_t ingest_id)
+{
+    std::string key("\xFF\xFF"
+                    "i");
+    key.append(std::to_string(ingest_id));
+    return key;
+}
+
+rocksdb::Status ingest_meta::load(const std::string &dir)
+{
+    std::string path = dsn::utils::filesystem::path_combine(dir, INGEST_META_FILE);
+    std::ifstream is(path);
+    if (!is) {
+        return rocksdb::Status::IOError("open file failed", path);
+    }
+
+    bool has_id = false, has_partition_count = false, has_data_version = false;
+    std::string line;
+    while (std::getline(is, line)) {
+        size_t pos = line.find('=');
+        if (pos == std::string::npos) {
+            continue;
+        }
+        std::string name = line.substr(0, pos);
+        std::string value = line.substr(pos + 1);
+        if (name == "id") {
+            has_id = dsn::buf2uint64(value, id);
+        } else if (name == "partition_count") {
+            has_partition_count = dsn::buf2int32(value, partition_count) && partition_count > 0;
+        } else if (name == "data_version") {
+            uint64_t version;
+            has_data_version = dsn::buf2uint64(value, version);
+            data_version = static_cast<uint32_t>(version);
+        }
+    }
+    if (!has_id || !has_partition_count || !has_data_version) {
+        return rocksdb::Status::Corruption("invalid ingest meta", path);
+    }
+    return rocksdb::Status::OK();
+}
+
+rocksdb::Status ingest_meta::dump(const std::string &dir) const
+{
+    std::string path = dsn::utils::filesystem::path_combine(dir, INGEST_META_FILE);
+    std::ofstream os(path, std::ios::out | std::ios::trunc);
+    os << "id=" << id << std::endl;
+    os << "partition_count=" << partition_count << std::endl;
+    os << "data_version=" << data_version << std::endl;
+    os.close();
+    if (!os) {
+        return rocksdb::Status::IOError("write file failed", path);
+    }
+    return rocksdb::Status::OK();
+}
+
+pegasus_sst_builder::pegasus_sst_builder(const std::string &output_dir,
+                                         int32_t partition_count,
+                                         uint32_t data_version,
+                                         uint64_t max_buffer_bytes)
+    : _output_dir(output_dir),
+      _max_buffer_bytes(max_buffer_bytes),
+      _buffers(partition_count),
+      _next_seq(partition_count, 0)
+{
+    dassert(partition_count > 0, "invalid partition_count %d", partition_count);
+    _meta.id = dsn::rand::next_u64();
+    _meta.partition_count = partition_count;
+    _meta.data_version = data_version;
+}
+
+rocksdb::Status pegasus_sst_builder::add(const std::string &hash_key,
+                                         const std::string &sort_key,
+                                         const std::string &value,
+                                         uint32_t expire_ts)
+{
+    if (hash_key.length() >= UINT16_MAX) {
+        return rocksdb::Status::InvalidArgument("hash key is too long");
+    }
+
+    dsn::blob key;
+    pegasus_generate_key(key, hash_key, sort_key);
+    int32_t pidx = static_cast<int32_t>(pegasus_key_hash(key) % _meta.partition_count);
+
+    std::string raw_value;
+    rocksdb::SliceParts sparts =
+        _value_generator.generate_value(_meta.data_version, value, expire_ts, 0);
+    for (int i = 0; i < sparts.num_parts; ++i) {
+        raw_value.append(sparts.parts[i].data(), sparts.parts[i].size());
+    }
+
+    _buffer_bytes += key.length() + raw_value.size();
+    _buffers[pidx].emplace_back(key.to_string(), std::move(raw_value));
+    _record_count++;
+
+    if (_buffer_bytes >= _max_buffer_bytes) {
+        return flush();
+    }
+    return rocksdb::Status::OK();
+}
+
+rocksdb::Status pegasus_sst_builder::finish()
+{
+    rocksdb::Status status = flush();
+    if (!status.ok()) {
+        return status;
+    }
+
+    // the marker record has an empty value which never expires
+    std::string marker_value;
+    rocksdb::SliceParts sparts = _value_generator.generate_value(_meta.data_version, "", 0, 0);
+    for (int i = 0; i < sparts.num_parts; ++i) {
+        marker_value.append(sparts.parts[i].data(), sparts.parts[i].size());
+    }
+    for (int32_t pidx = 0; pidx < _meta.partition_count; ++pidx) {
+        std::vector<std::pair<std::string, std::string>> kvs;
+        kvs.emplace_back(ingest_marker_key(_meta.id), marker_value);
+        status = write_file(pidx, kvs);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    return _meta.dump(_output_dir);
+}
+
+rocksdb::Status pegasus_sst_builder::flush()
+{
+    for (int32_t pidx = 0; pidx < _meta.partition_count; ++pidx) {
+        std::vector<std::pair<std::string, std::string>> &kvs = _buffers[pidx];
+        if (kvs.empty()) {
+            continue;
+        }
+
+        // keep the last added one of the same key
+        std::stable_sort(kvs.begin(),
+                         kvs.end(),
+                         [](const std::pair<std::string, std::string> &l,
+                            const std::pair<std::string, std::string> &r) {
+                             return l.first < r.first;
+                         });
+        auto last = kvs.begin();
+        for (auto it = kvs.begin() + 1; it != kvs.end(); ++it) {
+            if (it->first == last->first) {
+                *last = std::move(*it);
+            } else if (++last != it) {
+                *last = std::move(*it);
+            }
+        }
+        kvs.erase(last + 1, kvs.end());
+
+        rocksdb::Status status = write_file(pidx, kvs);
+        if (!status.ok()) {
+            return status;
+        }
+        kvs.clear();
+        kvs.shrink_to_fit();
+    }
+    _buffer_bytes = 0;
+    return rocksdb::Status::OK();
+}
+
+rocksdb::Status pegasus_sst_builder::write_file(
+    int32_t pidx, const std::vector<std::pair<std::string, std::string>> &kvs)
+{
+    std::string dir = dsn::utils::filesystem::path_combine(_output_dir, std::to_string(pidx));
+    if (!dsn::utils::filesystem::create_directory(dir)) {
+        return rocksdb::Status::IOError("create dir failed", dir);
+    }
+    std::string path =
+        dsn::utils::filesystem::path_combine(dir, std::to_string(_next_seq[pidx]++) + ".sst");
+
+    rocksdb::Options options;
+    options.compression = rocksdb::kLZ4Compression;
+    rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), options);
+    rocksdb::Status status = writer.Open(path);
+    if (!status.ok()) {
+        return status;
+    }
+    for (const auto &kv : kvs) {
+        status = writer.Put(kv.first, kv.second);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    status = writer.Finish();
+    if (status.ok()) {
+        _file_count++;
+    }
+    return status;
+}
+
+} // namespace pegasus
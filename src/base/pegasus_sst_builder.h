@@ -0,0 +1,87 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <rocksdb/status.h>
+
+#include "base/pegasus_value_schema.h"
+
+namespace pegasus {
+
+// Description of the sst files built by pegasus_sst_builder, stored in the file
+// `INGEST_META_FILE` under the output dir, as lines of "name=value".
+struct ingest_meta
+{
+    // random id of this build, which identifies the ingestion on the replicas.
+    uint64_t id{0};
+    int32_t partition_count{0};
+    uint32_t data_version{0};
+
+    rocksdb::Status load(const std::string &dir);
+    rocksdb::Status dump(const std::string &dir) const;
+};
+
+// The sst files of partition i are put in dir "<output_dir>/<i>", and named "<seq>.sst", which
+// should be ingested one by one in the order of seq, later files override earlier ones.
+// The last file of each partition only contains the marker record of the ingestion.
+extern const std::string INGEST_META_FILE;
+
+// rocksdb key = [0xFFFF] ['i'] [ingest id(decimal)], see sortkey_count_meta for 0xFFFF.
+// The marker record is ingested with the last file of each partition, so a replica knows
+// whether the ingestion is done from its data, even if the data is learned from others.
+std::string ingest_marker_key(uint64_t ingest_id);
+
+// Builds sst files of a pegasus table with `partition_count` partitions, which can be
+// ingested by the replicas, see ROCKSDB_ENV_BULK_INGEST_DIR.
+//
+// Records can be added in any order. They are buffered in memory, and once the buffer is
+// full, sorted and written to a new sst file of each partition. If a key is added more
+// than once, the last one wins.
+class pegasus_sst_builder
+{
+public:
+    pegasus_sst_builder(const std::string &output_dir,
+                        int32_t partition_count,
+                        uint32_t data_version = PEGASUS_DATA_VERSION_MAX,
+                        uint64_t max_buffer_bytes = 256 * 1024 * 1024);
+
+    // `expire_ts` is 0 if the record never expires.
+    rocksdb::Status add(const std::string &hash_key,
+                        const std::string &sort_key,
+                        const std::string &value,
+                        uint32_t expire_ts);
+
+    // Write the buffered records, the marker records and the ingest meta file.
+    rocksdb::Status finish();
+
+    uint64_t record_count() const { return _record_count; }
+    uint64_t file_count() const { return _file_count; }
+
+private:
+    rocksdb::Status flush();
+
+    rocksdb::Status write_file(int32_t pidx,
+                               const std::vector<std::pair<std::string, std::string>> &kvs);
+
+private:
+    const std::string _output_dir;
+    ingest_meta _meta;
+    const uint64_t _max_buffer_bytes;
+
+    pegasus_value_generator _value_generator;
+    // partition index -> buffered (rocksdb key, rocksdb value)
+    std::vector<std::vector<std::pair<std::string, std::string>>> _buffers;
+    uint64_t _buffer_bytes{0};
+    // partition index -> seq of the next file
+    std::vector<uint64_t> _next_seq;
+
+    uint64_t _record_count{0};
+    uint64_t _file_count{0};
+};
+
+} // namespace pegasus
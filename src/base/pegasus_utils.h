@@ -6,6 +6,7 @@
 
 #include <time.h>
 #include <cctype>
+#include <chrono>
 #include <cstring>
 #include <queue>
 #include <boost/lexical_cast.hpp>
@@ -20,6 +21,15 @@ namespace utils {
 const uint32_t epoch_begin = 1451606400;
 inline uint32_t epoch_now() { return time(nullptr) - epoch_begin; }
 
+// it's milliseconds since 1970.01.01-00:00:00 GMT, used as the deadline of requests, which is
+// compared between the client and the server
+inline int64_t unix_now_ms()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
 // extract "host" from rpc_address
 void addr2host(const ::dsn::rpc_address &addr, char *str, int len);
 
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -72,6 +73,40 @@ pegasus_extract_user_data(uint32_t version, std::string &&raw_value, ::dsn::blob
     user_data.assign(std::move(buf), 0, static_cast<unsigned int>(view.length()));
 }
 
+/// Extracts user value from a raw rocksdb value without copying.
+/// The returned view points into `raw_value`, so it must not outlive `raw_value`.
+inline dsn::string_view pegasus_extract_user_data_view(uint32_t version,
+                                                       dsn::string_view raw_value)
+{
+    dassert_f(version <= PEGASUS_DATA_VERSION_MAX,
+              "data version({}) must be <= {}",
+              version,
+              PEGASUS_DATA_VERSION_MAX);
+
+    dsn::data_input input(raw_value);
+    input.skip(sizeof(uint32_t));
+    if (version == 1) {
+        input.skip(sizeof(uint64_t));
+    }
+    return input.read_str();
+}
+
+/// Extracts user value from a rocksdb value read into a PinnableSlice.
+/// The ownership of `raw_value` will be transferred into `user_data`, so if the value
+/// is pinned in block cache, the block is referenced by `user_data` without copying.
+/// \param user_data: the result.
+inline void pegasus_extract_user_data(uint32_t version,
+                                      std::unique_ptr<rocksdb::PinnableSlice> raw_value,
+                                      ::dsn::blob &user_data)
+{
+    dsn::string_view view = pegasus_extract_user_data_view(
+        version, dsn::string_view(raw_value->data(), raw_value->size()));
+
+    auto *s = raw_value.release();
+    std::shared_ptr<char> buf(const_cast<char *>(view.data()), [s](char *) { delete s; });
+    user_data.assign(std::move(buf), 0, static_cast<unsigned int>(view.length()));
+}
+
 /// Extracts timetag from a v1 value.
 inline uint64_t pegasus_extract_timetag(int version, dsn::string_view value)
 {
@@ -1595,6 +1595,18 @@ void multi_get_request::__set_sort_key_filter_pattern(const ::dsn::blob &val)
 
 void multi_get_request::__set_reverse(const bool val) { this->reverse = val; }
 
+void multi_get_request::__set_value_filter_type(const filter_type::type val)
+{
+    this->value_filter_type = val;
+}
+
+void multi_get_request::__set_value_filter_pattern(const ::dsn::blob &val)
+{
+    this->value_filter_pattern = val;
+}
+
+void multi_get_request::__set_deadline_ms(const int64_t val) { this->deadline_ms = val; }
+
 uint32_t multi_get_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
@@ -1723,6 +1735,32 @@ uint32_t multi_get_request::read(::apache::thrift::protocol::TProtocol *iprot)
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 13:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast54;
+                xfer += iprot->readI32(ecast54);
+                this->value_filter_type = (filter_type::type)ecast54;
+                this->__isset.value_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 14:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->value_filter_pattern.read(iprot);
+                this->__isset.value_filter_pattern = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 15:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->deadline_ms);
+                this->__isset.deadline_ms = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -1749,9 +1787,9 @@ uint32_t multi_get_request::write(::apache::thrift::protocol::TProtocol *oprot)
     {
         xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
                                       static_cast<uint32_t>(this->sort_keys.size()));
-        std::vector<::dsn::blob>::const_iterator _iter54;
-        for (_iter54 = this->sort_keys.begin(); _iter54 != this->sort_keys.end(); ++_iter54) {
-            xfer += (*_iter54).write(oprot);
+        std::vector<::dsn::blob>::const_iterator _iter55;
+        for (_iter55 = this->sort_keys.begin(); _iter55 != this->sort_keys.end(); ++_iter55) {
+            xfer += (*_iter55).write(oprot);
         }
         xfer += oprot->writeListEnd();
     }
@@ -1798,6 +1836,19 @@ uint32_t multi_get_request::write(::apache::thrift::protocol::TProtocol *oprot)
     xfer += oprot->writeBool(this->reverse);
     xfer += oprot->writeFieldEnd();
 
+    xfer += oprot->writeFieldBegin("value_filter_type", ::apache::thrift::protocol::T_I32, 13);
+    xfer += oprot->writeI32((int32_t)this->value_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("value_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 14);
+    xfer += this->value_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("deadline_ms", ::apache::thrift::protocol::T_I64, 15);
+    xfer += oprot->writeI64(this->deadline_ms);
+    xfer += oprot->writeFieldEnd();
+
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
@@ -1818,73 +1869,88 @@ void swap(multi_get_request &a, multi_get_request &b)
     swap(a.sort_key_filter_type, b.sort_key_filter_type);
     swap(a.sort_key_filter_pattern, b.sort_key_filter_pattern);
     swap(a.reverse, b.reverse);
+    swap(a.value_filter_type, b.value_filter_type);
+    swap(a.value_filter_pattern, b.value_filter_pattern);
+    swap(a.deadline_ms, b.deadline_ms);
     swap(a.__isset, b.__isset);
 }
 
-multi_get_request::multi_get_request(const multi_get_request &other55)
-{
-    hash_key = other55.hash_key;
-    sort_keys = other55.sort_keys;
-    max_kv_count = other55.max_kv_count;
-    max_kv_size = other55.max_kv_size;
-    no_value = other55.no_value;
-    start_sortkey = other55.start_sortkey;
-    stop_sortkey = other55.stop_sortkey;
-    start_inclusive = other55.start_inclusive;
-    stop_inclusive = other55.stop_inclusive;
-    sort_key_filter_type = other55.sort_key_filter_type;
-    sort_key_filter_pattern = other55.sort_key_filter_pattern;
-    reverse = other55.reverse;
-    __isset = other55.__isset;
-}
-multi_get_request::multi_get_request(multi_get_request &&other56)
-{
-    hash_key = std::move(other56.hash_key);
-    sort_keys = std::move(other56.sort_keys);
-    max_kv_count = std::move(other56.max_kv_count);
-    max_kv_size = std::move(other56.max_kv_size);
-    no_value = std::move(other56.no_value);
-    start_sortkey = std::move(other56.start_sortkey);
-    stop_sortkey = std::move(other56.stop_sortkey);
-    start_inclusive = std::move(other56.start_inclusive);
-    stop_inclusive = std::move(other56.stop_inclusive);
-    sort_key_filter_type = std::move(other56.sort_key_filter_type);
-    sort_key_filter_pattern = std::move(other56.sort_key_filter_pattern);
-    reverse = std::move(other56.reverse);
-    __isset = std::move(other56.__isset);
-}
-multi_get_request &multi_get_request::operator=(const multi_get_request &other57)
-{
-    hash_key = other57.hash_key;
-    sort_keys = other57.sort_keys;
-    max_kv_count = other57.max_kv_count;
-    max_kv_size = other57.max_kv_size;
-    no_value = other57.no_value;
-    start_sortkey = other57.start_sortkey;
-    stop_sortkey = other57.stop_sortkey;
-    start_inclusive = other57.start_inclusive;
-    stop_inclusive = other57.stop_inclusive;
-    sort_key_filter_type = other57.sort_key_filter_type;
-    sort_key_filter_pattern = other57.sort_key_filter_pattern;
-    reverse = other57.reverse;
-    __isset = other57.__isset;
+multi_get_request::multi_get_request(const multi_get_request &other56)
+{
+    hash_key = other56.hash_key;
+    sort_keys = other56.sort_keys;
+    max_kv_count = other56.max_kv_count;
+    max_kv_size = other56.max_kv_size;
+    no_value = other56.no_value;
+    start_sortkey = other56.start_sortkey;
+    stop_sortkey = other56.stop_sortkey;
+    start_inclusive = other56.start_inclusive;
+    stop_inclusive = other56.stop_inclusive;
+    sort_key_filter_type = other56.sort_key_filter_type;
+    sort_key_filter_pattern = other56.sort_key_filter_pattern;
+    reverse = other56.reverse;
+    value_filter_type = other56.value_filter_type;
+    value_filter_pattern = other56.value_filter_pattern;
+    deadline_ms = other56.deadline_ms;
+    __isset = other56.__isset;
+}
+multi_get_request::multi_get_request(multi_get_request &&other57)
+{
+    hash_key = std::move(other57.hash_key);
+    sort_keys = std::move(other57.sort_keys);
+    max_kv_count = std::move(other57.max_kv_count);
+    max_kv_size = std::move(other57.max_kv_size);
+    no_value = std::move(other57.no_value);
+    start_sortkey = std::move(other57.start_sortkey);
+    stop_sortkey = std::move(other57.stop_sortkey);
+    start_inclusive = std::move(other57.start_inclusive);
+    stop_inclusive = std::move(other57.stop_inclusive);
+    sort_key_filter_type = std::move(other57.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other57.sort_key_filter_pattern);
+    reverse = std::move(other57.reverse);
+    value_filter_type = std::move(other57.value_filter_type);
+    value_filter_pattern = std::move(other57.value_filter_pattern);
+    deadline_ms = std::move(other57.deadline_ms);
+    __isset = std::move(other57.__isset);
+}
+multi_get_request &multi_get_request::operator=(const multi_get_request &other58)
+{
+    hash_key = other58.hash_key;
+    sort_keys = other58.sort_keys;
+    max_kv_count = other58.max_kv_count;
+    max_kv_size = other58.max_kv_size;
+    no_value = other58.no_value;
+    start_sortkey = other58.start_sortkey;
+    stop_sortkey = other58.stop_sortkey;
+    start_inclusive = other58.start_inclusive;
+    stop_inclusive = other58.stop_inclusive;
+    sort_key_filter_type = other58.sort_key_filter_type;
+    sort_key_filter_pattern = other58.sort_key_filter_pattern;
+    reverse = other58.reverse;
+    value_filter_type = other58.value_filter_type;
+    value_filter_pattern = other58.value_filter_pattern;
+    deadline_ms = other58.deadline_ms;
+    __isset = other58.__isset;
     return *this;
 }
-multi_get_request &multi_get_request::operator=(multi_get_request &&other58)
-{
-    hash_key = std::move(other58.hash_key);
-    sort_keys = std::move(other58.sort_keys);
-    max_kv_count = std::move(other58.max_kv_count);
-    max_kv_size = std::move(other58.max_kv_size);
-    no_value = std::move(other58.no_value);
-    start_sortkey = std::move(other58.start_sortkey);
-    stop_sortkey = std::move(other58.stop_sortkey);
-    start_inclusive = std::move(other58.start_inclusive);
-    stop_inclusive = std::move(other58.stop_inclusive);
-    sort_key_filter_type = std::move(other58.sort_key_filter_type);
-    sort_key_filter_pattern = std::move(other58.sort_key_filter_pattern);
-    reverse = std::move(other58.reverse);
-    __isset = std::move(other58.__isset);
+multi_get_request &multi_get_request::operator=(multi_get_request &&other59)
+{
+    hash_key = std::move(other59.hash_key);
+    sort_keys = std::move(other59.sort_keys);
+    max_kv_count = std::move(other59.max_kv_count);
+    max_kv_size = std::move(other59.max_kv_size);
+    no_value = std::move(other59.no_value);
+    start_sortkey = std::move(other59.start_sortkey);
+    stop_sortkey = std::move(other59.stop_sortkey);
+    start_inclusive = std::move(other59.start_inclusive);
+    stop_inclusive = std::move(other59.stop_inclusive);
+    sort_key_filter_type = std::move(other59.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other59.sort_key_filter_pattern);
+    reverse = std::move(other59.reverse);
+    value_filter_type = std::move(other59.value_filter_type);
+    value_filter_pattern = std::move(other59.value_filter_pattern);
+    deadline_ms = std::move(other59.deadline_ms);
+    __isset = std::move(other59.__isset);
     return *this;
 }
 void multi_get_request::printTo(std::ostream &out) const
@@ -1914,6 +1980,12 @@ void multi_get_request::printTo(std::ostream &out) const
         << "sort_key_filter_pattern=" << to_string(sort_key_filter_pattern);
     out << ", "
         << "reverse=" << to_string(reverse);
+    out << ", "
+        << "value_filter_type=" << to_string(value_filter_type);
+    out << ", "
+        << "value_filter_pattern=" << to_string(value_filter_pattern);
+    out << ", "
+        << "deadline_ms=" << to_string(deadline_ms);
     out << ")";
 }
 
@@ -1929,6 +2001,12 @@ void multi_get_response::__set_partition_index(const int32_t val) { this->partit
 
 void multi_get_response::__set_server(const std::string &val) { this->server = val; }
 
+void multi_get_response::__set_error_hint(const std::string &val)
+{
+    this->error_hint = val;
+    __isset.error_hint = true;
+}
+
 uint32_t multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
@@ -1960,13 +2038,13 @@ uint32_t multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
             if (ftype == ::apache::thrift::protocol::T_LIST) {
                 {
                     this->kvs.clear();
-                    uint32_t _size59;
-                    ::apache::thrift::protocol::TType _etype62;
-                    xfer += iprot->readListBegin(_etype62, _size59);
-                    this->kvs.resize(_size59);
-                    uint32_t _i63;
-                    for (_i63 = 0; _i63 < _size59; ++_i63) {
-                        xfer += this->kvs[_i63].read(iprot);
+                    uint32_t _size60;
+                    ::apache::thrift::protocol::TType _etype63;
+                    xfer += iprot->readListBegin(_etype63, _size60);
+                    this->kvs.resize(_size60);
+                    uint32_t _i64;
+                    for (_i64 = 0; _i64 < _size60; ++_i64) {
+                        xfer += this->kvs[_i64].read(iprot);
                     }
                     xfer += iprot->readListEnd();
                 }
@@ -1999,6 +2077,14 @@ uint32_t multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->error_hint);
+                this->__isset.error_hint = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -2025,9 +2111,9 @@ uint32_t multi_get_response::write(::apache::thrift::protocol::TProtocol *oprot)
     {
         xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
                                       static_cast<uint32_t>(this->kvs.size()));
-        std::vector<key_value>::const_iterator _iter64;
-        for (_iter64 = this->kvs.begin(); _iter64 != this->kvs.end(); ++_iter64) {
-            xfer += (*_iter64).write(oprot);
+        std::vector<key_value>::const_iterator _iter65;
+        for (_iter65 = this->kvs.begin(); _iter65 != this->kvs.end(); ++_iter65) {
+            xfer += (*_iter65).write(oprot);
         }
         xfer += oprot->writeListEnd();
     }
@@ -2045,6 +2131,11 @@ uint32_t multi_get_response::write(::apache::thrift::protocol::TProtocol *oprot)
     xfer += oprot->writeString(this->server);
     xfer += oprot->writeFieldEnd();
 
+    if (this->__isset.error_hint) {
+        xfer += oprot->writeFieldBegin("error_hint", ::apache::thrift::protocol::T_STRING, 7);
+        xfer += oprot->writeString(this->error_hint);
+        xfer += oprot->writeFieldEnd();
+    }
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
@@ -2058,45 +2149,50 @@ void swap(multi_get_response &a, multi_get_response &b)
     swap(a.app_id, b.app_id);
     swap(a.partition_index, b.partition_index);
     swap(a.server, b.server);
+    swap(a.error_hint, b.error_hint);
     swap(a.__isset, b.__isset);
 }
 
-multi_get_response::multi_get_response(const multi_get_response &other65)
+multi_get_response::multi_get_response(const multi_get_response &other66)
 {
-    error = other65.error;
-    kvs = other65.kvs;
-    app_id = other65.app_id;
-    partition_index = other65.partition_index;
-    server = other65.server;
-    __isset = other65.__isset;
+    error = other66.error;
+    kvs = other66.kvs;
+    app_id = other66.app_id;
+    partition_index = other66.partition_index;
+    server = other66.server;
+    error_hint = other66.error_hint;
+    __isset = other66.__isset;
 }
-multi_get_response::multi_get_response(multi_get_response &&other66)
+multi_get_response::multi_get_response(multi_get_response &&other67)
 {
-    error = std::move(other66.error);
-    kvs = std::move(other66.kvs);
-    app_id = std::move(other66.app_id);
-    partition_index = std::move(other66.partition_index);
-    server = std::move(other66.server);
-    __isset = std::move(other66.__isset);
+    error = std::move(other67.error);
+    kvs = std::move(other67.kvs);
+    app_id = std::move(other67.app_id);
+    partition_index = std::move(other67.partition_index);
+    server = std::move(other67.server);
+    error_hint = std::move(other67.error_hint);
+    __isset = std::move(other67.__isset);
 }
-multi_get_response &multi_get_response::operator=(const multi_get_response &other67)
+multi_get_response &multi_get_response::operator=(const multi_get_response &other68)
 {
-    error = other67.error;
-    kvs = other67.kvs;
-    app_id = other67.app_id;
-    partition_index = other67.partition_index;
-    server = other67.server;
-    __isset = other67.__isset;
+    error = other68.error;
+    kvs = other68.kvs;
+    app_id = other68.app_id;
+    partition_index = other68.partition_index;
+    server = other68.server;
+    error_hint = other68.error_hint;
+    __isset = other68.__isset;
     return *this;
 }
-multi_get_response &multi_get_response::operator=(multi_get_response &&other68)
+multi_get_response &multi_get_response::operator=(multi_get_response &&other69)
 {
-    error = std::move(other68.error);
-    kvs = std::move(other68.kvs);
-    app_id = std::move(other68.app_id);
-    partition_index = std::move(other68.partition_index);
-    server = std::move(other68.server);
-    __isset = std::move(other68.__isset);
+    error = std::move(other69.error);
+    kvs = std::move(other69.kvs);
+    app_id = std::move(other69.app_id);
+    partition_index = std::move(other69.partition_index);
+    server = std::move(other69.server);
+    error_hint = std::move(other69.error_hint);
+    __isset = std::move(other69.__isset);
     return *this;
 }
 void multi_get_response::printTo(std::ostream &out) const
@@ -2112,18 +2208,19 @@ void multi_get_response::printTo(std::ostream &out) const
         << "partition_index=" << to_string(partition_index);
     out << ", "
         << "server=" << to_string(server);
+    out << ", "
+        << "error_hint=";
+    (__isset.error_hint ? (out << to_string(error_hint)) : (out << "<null>"));
     out << ")";
 }
 
-incr_request::~incr_request() throw() {}
-
-void incr_request::__set_key(const ::dsn::blob &val) { this->key = val; }
+full_key::~full_key() throw() {}
 
-void incr_request::__set_increment(const int64_t val) { this->increment = val; }
+void full_key::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
 
-void incr_request::__set_expire_ts_seconds(const int32_t val) { this->expire_ts_seconds = val; }
+void full_key::__set_sort_key(const ::dsn::blob &val) { this->sort_key = val; }
 
-uint32_t incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t full_key::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -2144,24 +2241,16 @@ uint32_t incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
         switch (fid) {
         case 1:
             if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->key.read(iprot);
-                this->__isset.key = true;
+                xfer += this->hash_key.read(iprot);
+                this->__isset.hash_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->increment);
-                this->__isset.increment = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 3:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->expire_ts_seconds);
-                this->__isset.expire_ts_seconds = true;
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->sort_key.read(iprot);
+                this->__isset.sort_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -2178,22 +2267,18 @@ uint32_t incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t incr_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t full_key::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("incr_request");
-
-    xfer += oprot->writeFieldBegin("key", ::apache::thrift::protocol::T_STRUCT, 1);
-    xfer += this->key.write(oprot);
-    xfer += oprot->writeFieldEnd();
+    xfer += oprot->writeStructBegin("full_key");
 
-    xfer += oprot->writeFieldBegin("increment", ::apache::thrift::protocol::T_I64, 2);
-    xfer += oprot->writeI64(this->increment);
+    xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->hash_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("expire_ts_seconds", ::apache::thrift::protocol::T_I32, 3);
-    xfer += oprot->writeI32(this->expire_ts_seconds);
+    xfer += oprot->writeFieldBegin("sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->sort_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -2201,72 +2286,55 @@ uint32_t incr_request::write(::apache::thrift::protocol::TProtocol *oprot) const
     return xfer;
 }
 
-void swap(incr_request &a, incr_request &b)
+void swap(full_key &a, full_key &b)
 {
     using ::std::swap;
-    swap(a.key, b.key);
-    swap(a.increment, b.increment);
-    swap(a.expire_ts_seconds, b.expire_ts_seconds);
+    swap(a.hash_key, b.hash_key);
+    swap(a.sort_key, b.sort_key);
     swap(a.__isset, b.__isset);
 }
 
-incr_request::incr_request(const incr_request &other69)
+full_key::full_key(const full_key &other70)
 {
-    key = other69.key;
-    increment = other69.increment;
-    expire_ts_seconds = other69.expire_ts_seconds;
-    __isset = other69.__isset;
+    hash_key = other70.hash_key;
+    sort_key = other70.sort_key;
+    __isset = other70.__isset;
 }
-incr_request::incr_request(incr_request &&other70)
+full_key::full_key(full_key &&other71)
 {
-    key = std::move(other70.key);
-    increment = std::move(other70.increment);
-    expire_ts_seconds = std::move(other70.expire_ts_seconds);
-    __isset = std::move(other70.__isset);
+    hash_key = std::move(other71.hash_key);
+    sort_key = std::move(other71.sort_key);
+    __isset = std::move(other71.__isset);
 }
-incr_request &incr_request::operator=(const incr_request &other71)
+full_key &full_key::operator=(const full_key &other72)
 {
-    key = other71.key;
-    increment = other71.increment;
-    expire_ts_seconds = other71.expire_ts_seconds;
-    __isset = other71.__isset;
+    hash_key = other72.hash_key;
+    sort_key = other72.sort_key;
+    __isset = other72.__isset;
     return *this;
 }
-incr_request &incr_request::operator=(incr_request &&other72)
+full_key &full_key::operator=(full_key &&other73)
 {
-    key = std::move(other72.key);
-    increment = std::move(other72.increment);
-    expire_ts_seconds = std::move(other72.expire_ts_seconds);
-    __isset = std::move(other72.__isset);
+    hash_key = std::move(other73.hash_key);
+    sort_key = std::move(other73.sort_key);
+    __isset = std::move(other73.__isset);
     return *this;
 }
-void incr_request::printTo(std::ostream &out) const
+void full_key::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "incr_request(";
-    out << "key=" << to_string(key);
-    out << ", "
-        << "increment=" << to_string(increment);
+    out << "full_key(";
+    out << "hash_key=" << to_string(hash_key);
     out << ", "
-        << "expire_ts_seconds=" << to_string(expire_ts_seconds);
+        << "sort_key=" << to_string(sort_key);
     out << ")";
 }
 
-incr_response::~incr_response() throw() {}
-
-void incr_response::__set_error(const int32_t val) { this->error = val; }
-
-void incr_response::__set_new_value(const int64_t val) { this->new_value = val; }
-
-void incr_response::__set_app_id(const int32_t val) { this->app_id = val; }
-
-void incr_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
-
-void incr_response::__set_decree(const int64_t val) { this->decree = val; }
+batch_get_request::~batch_get_request() throw() {}
 
-void incr_response::__set_server(const std::string &val) { this->server = val; }
+void batch_get_request::__set_keys(const std::vector<full_key> &val) { this->keys = val; }
 
-uint32_t incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t batch_get_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -2286,49 +2354,20 @@ uint32_t incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
         }
         switch (fid) {
         case 1:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->error);
-                this->__isset.error = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 2:
-            if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->new_value);
-                this->__isset.new_value = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 3:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->app_id);
-                this->__isset.app_id = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 4:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->partition_index);
-                this->__isset.partition_index = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 5:
-            if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->decree);
-                this->__isset.decree = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 6:
-            if (ftype == ::apache::thrift::protocol::T_STRING) {
-                xfer += iprot->readString(this->server);
-                this->__isset.server = true;
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->keys.clear();
+                    uint32_t _size74;
+                    ::apache::thrift::protocol::TType _etype77;
+                    xfer += iprot->readListBegin(_etype77, _size74);
+                    this->keys.resize(_size74);
+                    uint32_t _i78;
+                    for (_i78 = 0; _i78 < _size74; ++_i78) {
+                        xfer += this->keys[_i78].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.keys = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -2345,34 +2384,22 @@ uint32_t incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t incr_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t batch_get_request::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("incr_response");
-
-    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
-    xfer += oprot->writeI32(this->error);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("new_value", ::apache::thrift::protocol::T_I64, 2);
-    xfer += oprot->writeI64(this->new_value);
-    xfer += oprot->writeFieldEnd();
+    xfer += oprot->writeStructBegin("batch_get_request");
 
-    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
-    xfer += oprot->writeI32(this->app_id);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 4);
-    xfer += oprot->writeI32(this->partition_index);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 5);
-    xfer += oprot->writeI64(this->decree);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
-    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldBegin("keys", ::apache::thrift::protocol::T_LIST, 1);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->keys.size()));
+        std::vector<full_key>::const_iterator _iter79;
+        for (_iter79 = this->keys.begin(); _iter79 != this->keys.end(); ++_iter79) {
+            xfer += (*_iter79).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -2380,117 +2407,52 @@ uint32_t incr_response::write(::apache::thrift::protocol::TProtocol *oprot) cons
     return xfer;
 }
 
-void swap(incr_response &a, incr_response &b)
+void swap(batch_get_request &a, batch_get_request &b)
 {
     using ::std::swap;
-    swap(a.error, b.error);
-    swap(a.new_value, b.new_value);
-    swap(a.app_id, b.app_id);
-    swap(a.partition_index, b.partition_index);
-    swap(a.decree, b.decree);
-    swap(a.server, b.server);
+    swap(a.keys, b.keys);
     swap(a.__isset, b.__isset);
 }
 
-incr_response::incr_response(const incr_response &other73)
+batch_get_request::batch_get_request(const batch_get_request &other80)
 {
-    error = other73.error;
-    new_value = other73.new_value;
-    app_id = other73.app_id;
-    partition_index = other73.partition_index;
-    decree = other73.decree;
-    server = other73.server;
-    __isset = other73.__isset;
+    keys = other80.keys;
+    __isset = other80.__isset;
 }
-incr_response::incr_response(incr_response &&other74)
+batch_get_request::batch_get_request(batch_get_request &&other81)
 {
-    error = std::move(other74.error);
-    new_value = std::move(other74.new_value);
-    app_id = std::move(other74.app_id);
-    partition_index = std::move(other74.partition_index);
-    decree = std::move(other74.decree);
-    server = std::move(other74.server);
-    __isset = std::move(other74.__isset);
+    keys = std::move(other81.keys);
+    __isset = std::move(other81.__isset);
 }
-incr_response &incr_response::operator=(const incr_response &other75)
+batch_get_request &batch_get_request::operator=(const batch_get_request &other82)
 {
-    error = other75.error;
-    new_value = other75.new_value;
-    app_id = other75.app_id;
-    partition_index = other75.partition_index;
-    decree = other75.decree;
-    server = other75.server;
-    __isset = other75.__isset;
+    keys = other82.keys;
+    __isset = other82.__isset;
     return *this;
 }
-incr_response &incr_response::operator=(incr_response &&other76)
+batch_get_request &batch_get_request::operator=(batch_get_request &&other83)
 {
-    error = std::move(other76.error);
-    new_value = std::move(other76.new_value);
-    app_id = std::move(other76.app_id);
-    partition_index = std::move(other76.partition_index);
-    decree = std::move(other76.decree);
-    server = std::move(other76.server);
-    __isset = std::move(other76.__isset);
+    keys = std::move(other83.keys);
+    __isset = std::move(other83.__isset);
     return *this;
 }
-void incr_response::printTo(std::ostream &out) const
+void batch_get_request::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "incr_response(";
-    out << "error=" << to_string(error);
-    out << ", "
-        << "new_value=" << to_string(new_value);
-    out << ", "
-        << "app_id=" << to_string(app_id);
-    out << ", "
-        << "partition_index=" << to_string(partition_index);
-    out << ", "
-        << "decree=" << to_string(decree);
-    out << ", "
-        << "server=" << to_string(server);
+    out << "batch_get_request(";
+    out << "keys=" << to_string(keys);
     out << ")";
 }
 
-check_and_set_request::~check_and_set_request() throw() {}
-
-void check_and_set_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
-
-void check_and_set_request::__set_check_sort_key(const ::dsn::blob &val)
-{
-    this->check_sort_key = val;
-}
-
-void check_and_set_request::__set_check_type(const cas_check_type::type val)
-{
-    this->check_type = val;
-}
-
-void check_and_set_request::__set_check_operand(const ::dsn::blob &val)
-{
-    this->check_operand = val;
-}
-
-void check_and_set_request::__set_set_diff_sort_key(const bool val)
-{
-    this->set_diff_sort_key = val;
-}
-
-void check_and_set_request::__set_set_sort_key(const ::dsn::blob &val) { this->set_sort_key = val; }
+full_data::~full_data() throw() {}
 
-void check_and_set_request::__set_set_value(const ::dsn::blob &val) { this->set_value = val; }
+void full_data::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
 
-void check_and_set_request::__set_set_expire_ts_seconds(const int32_t val)
-{
-    this->set_expire_ts_seconds = val;
-}
+void full_data::__set_sort_key(const ::dsn::blob &val) { this->sort_key = val; }
 
-void check_and_set_request::__set_return_check_value(const bool val)
-{
-    this->return_check_value = val;
-}
+void full_data::__set_value(const ::dsn::blob &val) { this->value = val; }
 
-uint32_t check_and_set_request::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t full_data::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -2519,66 +2481,16 @@ uint32_t check_and_set_request::read(::apache::thrift::protocol::TProtocol *ipro
             break;
         case 2:
             if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->check_sort_key.read(iprot);
-                this->__isset.check_sort_key = true;
+                xfer += this->sort_key.read(iprot);
+                this->__isset.sort_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 3:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast77;
-                xfer += iprot->readI32(ecast77);
-                this->check_type = (cas_check_type::type)ecast77;
-                this->__isset.check_type = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 4:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->check_operand.read(iprot);
-                this->__isset.check_operand = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 5:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->set_diff_sort_key);
-                this->__isset.set_diff_sort_key = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 6:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->set_sort_key.read(iprot);
-                this->__isset.set_sort_key = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 7:
             if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->set_value.read(iprot);
-                this->__isset.set_value = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 8:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->set_expire_ts_seconds);
-                this->__isset.set_expire_ts_seconds = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 9:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->return_check_value);
-                this->__isset.return_check_value = true;
+                xfer += this->value.read(iprot);
+                this->__isset.value = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -2595,46 +2507,22 @@ uint32_t check_and_set_request::read(::apache::thrift::protocol::TProtocol *ipro
     return xfer;
 }
 
-uint32_t check_and_set_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t full_data::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("check_and_set_request");
+    xfer += oprot->writeStructBegin("full_data");
 
     xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->hash_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("check_sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
-    xfer += this->check_sort_key.write(oprot);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("check_type", ::apache::thrift::protocol::T_I32, 3);
-    xfer += oprot->writeI32((int32_t)this->check_type);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("check_operand", ::apache::thrift::protocol::T_STRUCT, 4);
-    xfer += this->check_operand.write(oprot);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("set_diff_sort_key", ::apache::thrift::protocol::T_BOOL, 5);
-    xfer += oprot->writeBool(this->set_diff_sort_key);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("set_sort_key", ::apache::thrift::protocol::T_STRUCT, 6);
-    xfer += this->set_sort_key.write(oprot);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("set_value", ::apache::thrift::protocol::T_STRUCT, 7);
-    xfer += this->set_value.write(oprot);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("set_expire_ts_seconds", ::apache::thrift::protocol::T_I32, 8);
-    xfer += oprot->writeI32(this->set_expire_ts_seconds);
+    xfer += oprot->writeFieldBegin("sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->sort_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("return_check_value", ::apache::thrift::protocol::T_BOOL, 9);
-    xfer += oprot->writeBool(this->return_check_value);
+    xfer += oprot->writeFieldBegin("value", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->value.write(oprot);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -2642,127 +2530,70 @@ uint32_t check_and_set_request::write(::apache::thrift::protocol::TProtocol *opr
     return xfer;
 }
 
-void swap(check_and_set_request &a, check_and_set_request &b)
+void swap(full_data &a, full_data &b)
 {
     using ::std::swap;
     swap(a.hash_key, b.hash_key);
-    swap(a.check_sort_key, b.check_sort_key);
-    swap(a.check_type, b.check_type);
-    swap(a.check_operand, b.check_operand);
-    swap(a.set_diff_sort_key, b.set_diff_sort_key);
-    swap(a.set_sort_key, b.set_sort_key);
-    swap(a.set_value, b.set_value);
-    swap(a.set_expire_ts_seconds, b.set_expire_ts_seconds);
-    swap(a.return_check_value, b.return_check_value);
+    swap(a.sort_key, b.sort_key);
+    swap(a.value, b.value);
     swap(a.__isset, b.__isset);
 }
 
-check_and_set_request::check_and_set_request(const check_and_set_request &other78)
-{
-    hash_key = other78.hash_key;
-    check_sort_key = other78.check_sort_key;
-    check_type = other78.check_type;
-    check_operand = other78.check_operand;
-    set_diff_sort_key = other78.set_diff_sort_key;
-    set_sort_key = other78.set_sort_key;
-    set_value = other78.set_value;
-    set_expire_ts_seconds = other78.set_expire_ts_seconds;
-    return_check_value = other78.return_check_value;
-    __isset = other78.__isset;
-}
-check_and_set_request::check_and_set_request(check_and_set_request &&other79)
-{
-    hash_key = std::move(other79.hash_key);
-    check_sort_key = std::move(other79.check_sort_key);
-    check_type = std::move(other79.check_type);
-    check_operand = std::move(other79.check_operand);
-    set_diff_sort_key = std::move(other79.set_diff_sort_key);
-    set_sort_key = std::move(other79.set_sort_key);
-    set_value = std::move(other79.set_value);
-    set_expire_ts_seconds = std::move(other79.set_expire_ts_seconds);
-    return_check_value = std::move(other79.return_check_value);
-    __isset = std::move(other79.__isset);
-}
-check_and_set_request &check_and_set_request::operator=(const check_and_set_request &other80)
-{
-    hash_key = other80.hash_key;
-    check_sort_key = other80.check_sort_key;
-    check_type = other80.check_type;
-    check_operand = other80.check_operand;
-    set_diff_sort_key = other80.set_diff_sort_key;
-    set_sort_key = other80.set_sort_key;
-    set_value = other80.set_value;
-    set_expire_ts_seconds = other80.set_expire_ts_seconds;
-    return_check_value = other80.return_check_value;
-    __isset = other80.__isset;
+full_data::full_data(const full_data &other84)
+{
+    hash_key = other84.hash_key;
+    sort_key = other84.sort_key;
+    value = other84.value;
+    __isset = other84.__isset;
+}
+full_data::full_data(full_data &&other85)
+{
+    hash_key = std::move(other85.hash_key);
+    sort_key = std::move(other85.sort_key);
+    value = std::move(other85.value);
+    __isset = std::move(other85.__isset);
+}
+full_data &full_data::operator=(const full_data &other86)
+{
+    hash_key = other86.hash_key;
+    sort_key = other86.sort_key;
+    value = other86.value;
+    __isset = other86.__isset;
     return *this;
 }
-check_and_set_request &check_and_set_request::operator=(check_and_set_request &&other81)
-{
-    hash_key = std::move(other81.hash_key);
-    check_sort_key = std::move(other81.check_sort_key);
-    check_type = std::move(other81.check_type);
-    check_operand = std::move(other81.check_operand);
-    set_diff_sort_key = std::move(other81.set_diff_sort_key);
-    set_sort_key = std::move(other81.set_sort_key);
-    set_value = std::move(other81.set_value);
-    set_expire_ts_seconds = std::move(other81.set_expire_ts_seconds);
-    return_check_value = std::move(other81.return_check_value);
-    __isset = std::move(other81.__isset);
+full_data &full_data::operator=(full_data &&other87)
+{
+    hash_key = std::move(other87.hash_key);
+    sort_key = std::move(other87.sort_key);
+    value = std::move(other87.value);
+    __isset = std::move(other87.__isset);
     return *this;
 }
-void check_and_set_request::printTo(std::ostream &out) const
+void full_data::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "check_and_set_request(";
+    out << "full_data(";
     out << "hash_key=" << to_string(hash_key);
     out << ", "
-        << "check_sort_key=" << to_string(check_sort_key);
-    out << ", "
-        << "check_type=" << to_string(check_type);
-    out << ", "
-        << "check_operand=" << to_string(check_operand);
-    out << ", "
-        << "set_diff_sort_key=" << to_string(set_diff_sort_key);
-    out << ", "
-        << "set_sort_key=" << to_string(set_sort_key);
-    out << ", "
-        << "set_value=" << to_string(set_value);
-    out << ", "
-        << "set_expire_ts_seconds=" << to_string(set_expire_ts_seconds);
+        << "sort_key=" << to_string(sort_key);
     out << ", "
-        << "return_check_value=" << to_string(return_check_value);
+        << "value=" << to_string(value);
     out << ")";
 }
 
-check_and_set_response::~check_and_set_response() throw() {}
-
-void check_and_set_response::__set_error(const int32_t val) { this->error = val; }
-
-void check_and_set_response::__set_check_value_returned(const bool val)
-{
-    this->check_value_returned = val;
-}
-
-void check_and_set_response::__set_check_value_exist(const bool val)
-{
-    this->check_value_exist = val;
-}
+batch_get_response::~batch_get_response() throw() {}
 
-void check_and_set_response::__set_check_value(const ::dsn::blob &val) { this->check_value = val; }
+void batch_get_response::__set_error(const int32_t val) { this->error = val; }
 
-void check_and_set_response::__set_app_id(const int32_t val) { this->app_id = val; }
+void batch_get_response::__set_data(const std::vector<full_data> &val) { this->data = val; }
 
-void check_and_set_response::__set_partition_index(const int32_t val)
-{
-    this->partition_index = val;
-}
+void batch_get_response::__set_app_id(const int32_t val) { this->app_id = val; }
 
-void check_and_set_response::__set_decree(const int64_t val) { this->decree = val; }
+void batch_get_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
 
-void check_and_set_response::__set_server(const std::string &val) { this->server = val; }
+void batch_get_response::__set_server(const std::string &val) { this->server = val; }
 
-uint32_t check_and_set_response::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t batch_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -2790,30 +2621,25 @@ uint32_t check_and_set_response::read(::apache::thrift::protocol::TProtocol *ipr
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->check_value_returned);
-                this->__isset.check_value_returned = true;
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->data.clear();
+                    uint32_t _size88;
+                    ::apache::thrift::protocol::TType _etype91;
+                    xfer += iprot->readListBegin(_etype91, _size88);
+                    this->data.resize(_size88);
+                    uint32_t _i92;
+                    for (_i92 = 0; _i92 < _size88; ++_i92) {
+                        xfer += this->data[_i92].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.data = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 3:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->check_value_exist);
-                this->__isset.check_value_exist = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 4:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->check_value.read(iprot);
-                this->__isset.check_value = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 5:
             if (ftype == ::apache::thrift::protocol::T_I32) {
                 xfer += iprot->readI32(this->app_id);
                 this->__isset.app_id = true;
@@ -2821,7 +2647,7 @@ uint32_t check_and_set_response::read(::apache::thrift::protocol::TProtocol *ipr
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 6:
+        case 4:
             if (ftype == ::apache::thrift::protocol::T_I32) {
                 xfer += iprot->readI32(this->partition_index);
                 this->__isset.partition_index = true;
@@ -2829,15 +2655,7 @@ uint32_t check_and_set_response::read(::apache::thrift::protocol::TProtocol *ipr
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 7:
-            if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->decree);
-                this->__isset.decree = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 8:
+        case 6:
             if (ftype == ::apache::thrift::protocol::T_STRING) {
                 xfer += iprot->readString(this->server);
                 this->__isset.server = true;
@@ -2857,41 +2675,37 @@ uint32_t check_and_set_response::read(::apache::thrift::protocol::TProtocol *ipr
     return xfer;
 }
 
-uint32_t check_and_set_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t batch_get_response::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("check_and_set_response");
+    xfer += oprot->writeStructBegin("batch_get_response");
 
     xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
     xfer += oprot->writeI32(this->error);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("check_value_returned", ::apache::thrift::protocol::T_BOOL, 2);
-    xfer += oprot->writeBool(this->check_value_returned);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("check_value_exist", ::apache::thrift::protocol::T_BOOL, 3);
-    xfer += oprot->writeBool(this->check_value_exist);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("check_value", ::apache::thrift::protocol::T_STRUCT, 4);
-    xfer += this->check_value.write(oprot);
+    xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_LIST, 2);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->data.size()));
+        std::vector<full_data>::const_iterator _iter93;
+        for (_iter93 = this->data.begin(); _iter93 != this->data.end(); ++_iter93) {
+            xfer += (*_iter93).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 5);
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
     xfer += oprot->writeI32(this->app_id);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 6);
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 4);
     xfer += oprot->writeI32(this->partition_index);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 7);
-    xfer += oprot->writeI64(this->decree);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 8);
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
     xfer += oprot->writeString(this->server);
     xfer += oprot->writeFieldEnd();
 
@@ -2900,103 +2714,86 @@ uint32_t check_and_set_response::write(::apache::thrift::protocol::TProtocol *op
     return xfer;
 }
 
-void swap(check_and_set_response &a, check_and_set_response &b)
+void swap(batch_get_response &a, batch_get_response &b)
 {
     using ::std::swap;
     swap(a.error, b.error);
-    swap(a.check_value_returned, b.check_value_returned);
-    swap(a.check_value_exist, b.check_value_exist);
-    swap(a.check_value, b.check_value);
+    swap(a.data, b.data);
     swap(a.app_id, b.app_id);
     swap(a.partition_index, b.partition_index);
-    swap(a.decree, b.decree);
     swap(a.server, b.server);
     swap(a.__isset, b.__isset);
 }
 
-check_and_set_response::check_and_set_response(const check_and_set_response &other82)
+batch_get_response::batch_get_response(const batch_get_response &other94)
 {
-    error = other82.error;
-    check_value_returned = other82.check_value_returned;
-    check_value_exist = other82.check_value_exist;
-    check_value = other82.check_value;
-    app_id = other82.app_id;
-    partition_index = other82.partition_index;
-    decree = other82.decree;
-    server = other82.server;
-    __isset = other82.__isset;
+    error = other94.error;
+    data = other94.data;
+    app_id = other94.app_id;
+    partition_index = other94.partition_index;
+    server = other94.server;
+    __isset = other94.__isset;
 }
-check_and_set_response::check_and_set_response(check_and_set_response &&other83)
+batch_get_response::batch_get_response(batch_get_response &&other95)
 {
-    error = std::move(other83.error);
-    check_value_returned = std::move(other83.check_value_returned);
-    check_value_exist = std::move(other83.check_value_exist);
-    check_value = std::move(other83.check_value);
-    app_id = std::move(other83.app_id);
-    partition_index = std::move(other83.partition_index);
-    decree = std::move(other83.decree);
-    server = std::move(other83.server);
-    __isset = std::move(other83.__isset);
+    error = std::move(other95.error);
+    data = std::move(other95.data);
+    app_id = std::move(other95.app_id);
+    partition_index = std::move(other95.partition_index);
+    server = std::move(other95.server);
+    __isset = std::move(other95.__isset);
 }
-check_and_set_response &check_and_set_response::operator=(const check_and_set_response &other84)
+batch_get_response &batch_get_response::operator=(const batch_get_response &other96)
 {
-    error = other84.error;
-    check_value_returned = other84.check_value_returned;
-    check_value_exist = other84.check_value_exist;
-    check_value = other84.check_value;
-    app_id = other84.app_id;
-    partition_index = other84.partition_index;
-    decree = other84.decree;
-    server = other84.server;
-    __isset = other84.__isset;
+    error = other96.error;
+    data = other96.data;
+    app_id = other96.app_id;
+    partition_index = other96.partition_index;
+    server = other96.server;
+    __isset = other96.__isset;
     return *this;
 }
-check_and_set_response &check_and_set_response::operator=(check_and_set_response &&other85)
+batch_get_response &batch_get_response::operator=(batch_get_response &&other97)
 {
-    error = std::move(other85.error);
-    check_value_returned = std::move(other85.check_value_returned);
-    check_value_exist = std::move(other85.check_value_exist);
-    check_value = std::move(other85.check_value);
-    app_id = std::move(other85.app_id);
-    partition_index = std::move(other85.partition_index);
-    decree = std::move(other85.decree);
-    server = std::move(other85.server);
-    __isset = std::move(other85.__isset);
+    error = std::move(other97.error);
+    data = std::move(other97.data);
+    app_id = std::move(other97.app_id);
+    partition_index = std::move(other97.partition_index);
+    server = std::move(other97.server);
+    __isset = std::move(other97.__isset);
     return *this;
 }
-void check_and_set_response::printTo(std::ostream &out) const
+void batch_get_response::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "check_and_set_response(";
+    out << "batch_get_response(";
     out << "error=" << to_string(error);
     out << ", "
-        << "check_value_returned=" << to_string(check_value_returned);
-    out << ", "
-        << "check_value_exist=" << to_string(check_value_exist);
-    out << ", "
-        << "check_value=" << to_string(check_value);
+        << "data=" << to_string(data);
     out << ", "
         << "app_id=" << to_string(app_id);
     out << ", "
         << "partition_index=" << to_string(partition_index);
-    out << ", "
-        << "decree=" << to_string(decree);
     out << ", "
         << "server=" << to_string(server);
     out << ")";
 }
 
-mutate::~mutate() throw() {}
+incr_request::~incr_request() throw() {}
 
-void mutate::__set_operation(const mutate_operation::type val) { this->operation = val; }
+void incr_request::__set_key(const ::dsn::blob &val) { this->key = val; }
 
-void mutate::__set_sort_key(const ::dsn::blob &val) { this->sort_key = val; }
+void incr_request::__set_increment(const int64_t val) { this->increment = val; }
 
-void mutate::__set_value(const ::dsn::blob &val) { this->value = val; }
+void incr_request::__set_expire_ts_seconds(const int32_t val) { this->expire_ts_seconds = val; }
 
-void mutate::__set_set_expire_ts_seconds(const int32_t val) { this->set_expire_ts_seconds = val; }
+void incr_request::__set_blind(const bool val)
+{
+    this->blind = val;
+    __isset.blind = true;
+}
 
-uint32_t mutate::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -3016,35 +2813,33 @@ uint32_t mutate::read(::apache::thrift::protocol::TProtocol *iprot)
         }
         switch (fid) {
         case 1:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast86;
-                xfer += iprot->readI32(ecast86);
-                this->operation = (mutate_operation::type)ecast86;
-                this->__isset.operation = true;
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->key.read(iprot);
+                this->__isset.key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->sort_key.read(iprot);
-                this->__isset.sort_key = true;
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->increment);
+                this->__isset.increment = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 3:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->value.read(iprot);
-                this->__isset.value = true;
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->expire_ts_seconds);
+                this->__isset.expire_ts_seconds = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 4:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->set_expire_ts_seconds);
-                this->__isset.set_expire_ts_seconds = true;
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->blind);
+                this->__isset.blind = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -3061,121 +2856,108 @@ uint32_t mutate::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t mutate::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t incr_request::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("mutate");
-
-    xfer += oprot->writeFieldBegin("operation", ::apache::thrift::protocol::T_I32, 1);
-    xfer += oprot->writeI32((int32_t)this->operation);
-    xfer += oprot->writeFieldEnd();
+    xfer += oprot->writeStructBegin("incr_request");
 
-    xfer += oprot->writeFieldBegin("sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
-    xfer += this->sort_key.write(oprot);
+    xfer += oprot->writeFieldBegin("key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("value", ::apache::thrift::protocol::T_STRUCT, 3);
-    xfer += this->value.write(oprot);
+    xfer += oprot->writeFieldBegin("increment", ::apache::thrift::protocol::T_I64, 2);
+    xfer += oprot->writeI64(this->increment);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("set_expire_ts_seconds", ::apache::thrift::protocol::T_I32, 4);
-    xfer += oprot->writeI32(this->set_expire_ts_seconds);
+    xfer += oprot->writeFieldBegin("expire_ts_seconds", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->expire_ts_seconds);
     xfer += oprot->writeFieldEnd();
 
+    if (this->__isset.blind) {
+        xfer += oprot->writeFieldBegin("blind", ::apache::thrift::protocol::T_BOOL, 4);
+        xfer += oprot->writeBool(this->blind);
+        xfer += oprot->writeFieldEnd();
+    }
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
 }
 
-void swap(mutate &a, mutate &b)
+void swap(incr_request &a, incr_request &b)
 {
     using ::std::swap;
-    swap(a.operation, b.operation);
-    swap(a.sort_key, b.sort_key);
-    swap(a.value, b.value);
-    swap(a.set_expire_ts_seconds, b.set_expire_ts_seconds);
+    swap(a.key, b.key);
+    swap(a.increment, b.increment);
+    swap(a.expire_ts_seconds, b.expire_ts_seconds);
+    swap(a.blind, b.blind);
     swap(a.__isset, b.__isset);
 }
 
-mutate::mutate(const mutate &other87)
+incr_request::incr_request(const incr_request &other98)
 {
-    operation = other87.operation;
-    sort_key = other87.sort_key;
-    value = other87.value;
-    set_expire_ts_seconds = other87.set_expire_ts_seconds;
-    __isset = other87.__isset;
+    key = other98.key;
+    increment = other98.increment;
+    expire_ts_seconds = other98.expire_ts_seconds;
+    blind = other98.blind;
+    __isset = other98.__isset;
 }
-mutate::mutate(mutate &&other88)
+incr_request::incr_request(incr_request &&other99)
 {
-    operation = std::move(other88.operation);
-    sort_key = std::move(other88.sort_key);
-    value = std::move(other88.value);
-    set_expire_ts_seconds = std::move(other88.set_expire_ts_seconds);
-    __isset = std::move(other88.__isset);
+    key = std::move(other99.key);
+    increment = std::move(other99.increment);
+    expire_ts_seconds = std::move(other99.expire_ts_seconds);
+    blind = std::move(other99.blind);
+    __isset = std::move(other99.__isset);
 }
-mutate &mutate::operator=(const mutate &other89)
+incr_request &incr_request::operator=(const incr_request &other100)
 {
-    operation = other89.operation;
-    sort_key = other89.sort_key;
-    value = other89.value;
-    set_expire_ts_seconds = other89.set_expire_ts_seconds;
-    __isset = other89.__isset;
+    key = other100.key;
+    increment = other100.increment;
+    expire_ts_seconds = other100.expire_ts_seconds;
+    blind = other100.blind;
+    __isset = other100.__isset;
     return *this;
 }
-mutate &mutate::operator=(mutate &&other90)
+incr_request &incr_request::operator=(incr_request &&other101)
 {
-    operation = std::move(other90.operation);
-    sort_key = std::move(other90.sort_key);
-    value = std::move(other90.value);
-    set_expire_ts_seconds = std::move(other90.set_expire_ts_seconds);
-    __isset = std::move(other90.__isset);
+    key = std::move(other101.key);
+    increment = std::move(other101.increment);
+    expire_ts_seconds = std::move(other101.expire_ts_seconds);
+    blind = std::move(other101.blind);
+    __isset = std::move(other101.__isset);
     return *this;
 }
-void mutate::printTo(std::ostream &out) const
+void incr_request::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "mutate(";
-    out << "operation=" << to_string(operation);
+    out << "incr_request(";
+    out << "key=" << to_string(key);
     out << ", "
-        << "sort_key=" << to_string(sort_key);
+        << "increment=" << to_string(increment);
     out << ", "
-        << "value=" << to_string(value);
+        << "expire_ts_seconds=" << to_string(expire_ts_seconds);
     out << ", "
-        << "set_expire_ts_seconds=" << to_string(set_expire_ts_seconds);
+        << "blind=";
+    (__isset.blind ? (out << to_string(blind)) : (out << "<null>"));
     out << ")";
 }
 
-check_and_mutate_request::~check_and_mutate_request() throw() {}
+incr_response::~incr_response() throw() {}
 
-void check_and_mutate_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
+void incr_response::__set_error(const int32_t val) { this->error = val; }
 
-void check_and_mutate_request::__set_check_sort_key(const ::dsn::blob &val)
-{
-    this->check_sort_key = val;
-}
+void incr_response::__set_new_value(const int64_t val) { this->new_value = val; }
 
-void check_and_mutate_request::__set_check_type(const cas_check_type::type val)
-{
-    this->check_type = val;
-}
+void incr_response::__set_app_id(const int32_t val) { this->app_id = val; }
 
-void check_and_mutate_request::__set_check_operand(const ::dsn::blob &val)
-{
-    this->check_operand = val;
-}
+void incr_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
 
-void check_and_mutate_request::__set_mutate_list(const std::vector<mutate> &val)
-{
-    this->mutate_list = val;
-}
+void incr_response::__set_decree(const int64_t val) { this->decree = val; }
 
-void check_and_mutate_request::__set_return_check_value(const bool val)
-{
-    this->return_check_value = val;
-}
+void incr_response::__set_server(const std::string &val) { this->server = val; }
 
-uint32_t check_and_mutate_request::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -3195,62 +2977,49 @@ uint32_t check_and_mutate_request::read(::apache::thrift::protocol::TProtocol *i
         }
         switch (fid) {
         case 1:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->hash_key.read(iprot);
-                this->__isset.hash_key = true;
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->check_sort_key.read(iprot);
-                this->__isset.check_sort_key = true;
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->new_value);
+                this->__isset.new_value = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 3:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast91;
-                xfer += iprot->readI32(ecast91);
-                this->check_type = (cas_check_type::type)ecast91;
-                this->__isset.check_type = true;
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 4:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->check_operand.read(iprot);
-                this->__isset.check_operand = true;
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 5:
-            if (ftype == ::apache::thrift::protocol::T_LIST) {
-                {
-                    this->mutate_list.clear();
-                    uint32_t _size92;
-                    ::apache::thrift::protocol::TType _etype95;
-                    xfer += iprot->readListBegin(_etype95, _size92);
-                    this->mutate_list.resize(_size92);
-                    uint32_t _i96;
-                    for (_i96 = 0; _i96 < _size92; ++_i96) {
-                        xfer += this->mutate_list[_i96].read(iprot);
-                    }
-                    xfer += iprot->readListEnd();
-                }
-                this->__isset.mutate_list = true;
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->decree);
+                this->__isset.decree = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 6:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->return_check_value);
-                this->__isset.return_check_value = true;
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -3267,42 +3036,34 @@ uint32_t check_and_mutate_request::read(::apache::thrift::protocol::TProtocol *i
     return xfer;
 }
 
-uint32_t check_and_mutate_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t incr_response::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("check_and_mutate_request");
+    xfer += oprot->writeStructBegin("incr_response");
 
-    xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
-    xfer += this->hash_key.write(oprot);
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("check_sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
-    xfer += this->check_sort_key.write(oprot);
+    xfer += oprot->writeFieldBegin("new_value", ::apache::thrift::protocol::T_I64, 2);
+    xfer += oprot->writeI64(this->new_value);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("check_type", ::apache::thrift::protocol::T_I32, 3);
-    xfer += oprot->writeI32((int32_t)this->check_type);
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->app_id);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("check_operand", ::apache::thrift::protocol::T_STRUCT, 4);
-    xfer += this->check_operand.write(oprot);
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(this->partition_index);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("mutate_list", ::apache::thrift::protocol::T_LIST, 5);
-    {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
-                                      static_cast<uint32_t>(this->mutate_list.size()));
-        std::vector<mutate>::const_iterator _iter97;
-        for (_iter97 = this->mutate_list.begin(); _iter97 != this->mutate_list.end(); ++_iter97) {
-            xfer += (*_iter97).write(oprot);
-        }
-        xfer += oprot->writeListEnd();
-    }
+    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 5);
+    xfer += oprot->writeI64(this->decree);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("return_check_value", ::apache::thrift::protocol::T_BOOL, 6);
-    xfer += oprot->writeBool(this->return_check_value);
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
+    xfer += oprot->writeString(this->server);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -3310,110 +3071,87 @@ uint32_t check_and_mutate_request::write(::apache::thrift::protocol::TProtocol *
     return xfer;
 }
 
-void swap(check_and_mutate_request &a, check_and_mutate_request &b)
+void swap(incr_response &a, incr_response &b)
 {
     using ::std::swap;
-    swap(a.hash_key, b.hash_key);
-    swap(a.check_sort_key, b.check_sort_key);
-    swap(a.check_type, b.check_type);
-    swap(a.check_operand, b.check_operand);
-    swap(a.mutate_list, b.mutate_list);
-    swap(a.return_check_value, b.return_check_value);
+    swap(a.error, b.error);
+    swap(a.new_value, b.new_value);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.decree, b.decree);
+    swap(a.server, b.server);
     swap(a.__isset, b.__isset);
 }
 
-check_and_mutate_request::check_and_mutate_request(const check_and_mutate_request &other98)
+incr_response::incr_response(const incr_response &other102)
 {
-    hash_key = other98.hash_key;
-    check_sort_key = other98.check_sort_key;
-    check_type = other98.check_type;
-    check_operand = other98.check_operand;
-    mutate_list = other98.mutate_list;
-    return_check_value = other98.return_check_value;
-    __isset = other98.__isset;
+    error = other102.error;
+    new_value = other102.new_value;
+    app_id = other102.app_id;
+    partition_index = other102.partition_index;
+    decree = other102.decree;
+    server = other102.server;
+    __isset = other102.__isset;
 }
-check_and_mutate_request::check_and_mutate_request(check_and_mutate_request &&other99)
+incr_response::incr_response(incr_response &&other103)
 {
-    hash_key = std::move(other99.hash_key);
-    check_sort_key = std::move(other99.check_sort_key);
-    check_type = std::move(other99.check_type);
-    check_operand = std::move(other99.check_operand);
-    mutate_list = std::move(other99.mutate_list);
-    return_check_value = std::move(other99.return_check_value);
-    __isset = std::move(other99.__isset);
+    error = std::move(other103.error);
+    new_value = std::move(other103.new_value);
+    app_id = std::move(other103.app_id);
+    partition_index = std::move(other103.partition_index);
+    decree = std::move(other103.decree);
+    server = std::move(other103.server);
+    __isset = std::move(other103.__isset);
 }
-check_and_mutate_request &check_and_mutate_request::
-operator=(const check_and_mutate_request &other100)
-{
-    hash_key = other100.hash_key;
-    check_sort_key = other100.check_sort_key;
-    check_type = other100.check_type;
-    check_operand = other100.check_operand;
-    mutate_list = other100.mutate_list;
-    return_check_value = other100.return_check_value;
-    __isset = other100.__isset;
+incr_response &incr_response::operator=(const incr_response &other104)
+{
+    error = other104.error;
+    new_value = other104.new_value;
+    app_id = other104.app_id;
+    partition_index = other104.partition_index;
+    decree = other104.decree;
+    server = other104.server;
+    __isset = other104.__isset;
     return *this;
 }
-check_and_mutate_request &check_and_mutate_request::operator=(check_and_mutate_request &&other101)
+incr_response &incr_response::operator=(incr_response &&other105)
 {
-    hash_key = std::move(other101.hash_key);
-    check_sort_key = std::move(other101.check_sort_key);
-    check_type = std::move(other101.check_type);
-    check_operand = std::move(other101.check_operand);
-    mutate_list = std::move(other101.mutate_list);
-    return_check_value = std::move(other101.return_check_value);
-    __isset = std::move(other101.__isset);
+    error = std::move(other105.error);
+    new_value = std::move(other105.new_value);
+    app_id = std::move(other105.app_id);
+    partition_index = std::move(other105.partition_index);
+    decree = std::move(other105.decree);
+    server = std::move(other105.server);
+    __isset = std::move(other105.__isset);
     return *this;
 }
-void check_and_mutate_request::printTo(std::ostream &out) const
+void incr_response::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "check_and_mutate_request(";
-    out << "hash_key=" << to_string(hash_key);
+    out << "incr_response(";
+    out << "error=" << to_string(error);
     out << ", "
-        << "check_sort_key=" << to_string(check_sort_key);
+        << "new_value=" << to_string(new_value);
     out << ", "
-        << "check_type=" << to_string(check_type);
+        << "app_id=" << to_string(app_id);
     out << ", "
-        << "check_operand=" << to_string(check_operand);
+        << "partition_index=" << to_string(partition_index);
     out << ", "
-        << "mutate_list=" << to_string(mutate_list);
+        << "decree=" << to_string(decree);
     out << ", "
-        << "return_check_value=" << to_string(return_check_value);
+        << "server=" << to_string(server);
     out << ")";
 }
 
-check_and_mutate_response::~check_and_mutate_response() throw() {}
-
-void check_and_mutate_response::__set_error(const int32_t val) { this->error = val; }
-
-void check_and_mutate_response::__set_check_value_returned(const bool val)
-{
-    this->check_value_returned = val;
-}
-
-void check_and_mutate_response::__set_check_value_exist(const bool val)
-{
-    this->check_value_exist = val;
-}
-
-void check_and_mutate_response::__set_check_value(const ::dsn::blob &val)
-{
-    this->check_value = val;
-}
-
-void check_and_mutate_response::__set_app_id(const int32_t val) { this->app_id = val; }
+incr_item::~incr_item() throw() {}
 
-void check_and_mutate_response::__set_partition_index(const int32_t val)
-{
-    this->partition_index = val;
-}
+void incr_item::__set_sort_key(const ::dsn::blob &val) { this->sort_key = val; }
 
-void check_and_mutate_response::__set_decree(const int64_t val) { this->decree = val; }
+void incr_item::__set_increment(const int64_t val) { this->increment = val; }
 
-void check_and_mutate_response::__set_server(const std::string &val) { this->server = val; }
+void incr_item::__set_expire_ts_seconds(const int32_t val) { this->expire_ts_seconds = val; }
 
-uint32_t check_and_mutate_response::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t incr_item::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -3433,65 +3171,2733 @@ uint32_t check_and_mutate_response::read(::apache::thrift::protocol::TProtocol *
         }
         switch (fid) {
         case 1:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->error);
-                this->__isset.error = true;
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->sort_key.read(iprot);
+                this->__isset.sort_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->check_value_returned);
-                this->__isset.check_value_returned = true;
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->increment);
+                this->__isset.increment = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 3:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->check_value_exist);
-                this->__isset.check_value_exist = true;
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->expire_ts_seconds);
+                this->__isset.expire_ts_seconds = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t incr_item::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("incr_item");
+
+    xfer += oprot->writeFieldBegin("sort_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->sort_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("increment", ::apache::thrift::protocol::T_I64, 2);
+    xfer += oprot->writeI64(this->increment);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("expire_ts_seconds", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->expire_ts_seconds);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(incr_item &a, incr_item &b)
+{
+    using ::std::swap;
+    swap(a.sort_key, b.sort_key);
+    swap(a.increment, b.increment);
+    swap(a.expire_ts_seconds, b.expire_ts_seconds);
+    swap(a.__isset, b.__isset);
+}
+
+incr_item::incr_item(const incr_item &other106)
+{
+    sort_key = other106.sort_key;
+    increment = other106.increment;
+    expire_ts_seconds = other106.expire_ts_seconds;
+    __isset = other106.__isset;
+}
+incr_item::incr_item(incr_item &&other107)
+{
+    sort_key = std::move(other107.sort_key);
+    increment = std::move(other107.increment);
+    expire_ts_seconds = std::move(other107.expire_ts_seconds);
+    __isset = std::move(other107.__isset);
+}
+incr_item &incr_item::operator=(const incr_item &other108)
+{
+    sort_key = other108.sort_key;
+    increment = other108.increment;
+    expire_ts_seconds = other108.expire_ts_seconds;
+    __isset = other108.__isset;
+    return *this;
+}
+incr_item &incr_item::operator=(incr_item &&other109)
+{
+    sort_key = std::move(other109.sort_key);
+    increment = std::move(other109.increment);
+    expire_ts_seconds = std::move(other109.expire_ts_seconds);
+    __isset = std::move(other109.__isset);
+    return *this;
+}
+void incr_item::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "incr_item(";
+    out << "sort_key=" << to_string(sort_key);
+    out << ", "
+        << "increment=" << to_string(increment);
+    out << ", "
+        << "expire_ts_seconds=" << to_string(expire_ts_seconds);
+    out << ")";
+}
+
+multi_incr_request::~multi_incr_request() throw() {}
+
+void multi_incr_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
+
+void multi_incr_request::__set_items(const std::vector<incr_item> &val) { this->items = val; }
+
+void multi_incr_request::__set_blind(const bool val)
+{
+    this->blind = val;
+    __isset.blind = true;
+}
+
+uint32_t multi_incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->hash_key.read(iprot);
+                this->__isset.hash_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->items.clear();
+                    uint32_t _size110;
+                    ::apache::thrift::protocol::TType _etype113;
+                    xfer += iprot->readListBegin(_etype113, _size110);
+                    this->items.resize(_size110);
+                    uint32_t _i114;
+                    for (_i114 = 0; _i114 < _size110; ++_i114) {
+                        xfer += this->items[_i114].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.items = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->blind);
+                this->__isset.blind = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t multi_incr_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("multi_incr_request");
+
+    xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->hash_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("items", ::apache::thrift::protocol::T_LIST, 2);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->items.size()));
+        std::vector<incr_item>::const_iterator _iter115;
+        for (_iter115 = this->items.begin(); _iter115 != this->items.end(); ++_iter115) {
+            xfer += (*_iter115).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    if (this->__isset.blind) {
+        xfer += oprot->writeFieldBegin("blind", ::apache::thrift::protocol::T_BOOL, 3);
+        xfer += oprot->writeBool(this->blind);
+        xfer += oprot->writeFieldEnd();
+    }
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(multi_incr_request &a, multi_incr_request &b)
+{
+    using ::std::swap;
+    swap(a.hash_key, b.hash_key);
+    swap(a.items, b.items);
+    swap(a.blind, b.blind);
+    swap(a.__isset, b.__isset);
+}
+
+multi_incr_request::multi_incr_request(const multi_incr_request &other116)
+{
+    hash_key = other116.hash_key;
+    items = other116.items;
+    blind = other116.blind;
+    __isset = other116.__isset;
+}
+multi_incr_request::multi_incr_request(multi_incr_request &&other117)
+{
+    hash_key = std::move(other117.hash_key);
+    items = std::move(other117.items);
+    blind = std::move(other117.blind);
+    __isset = std::move(other117.__isset);
+}
+multi_incr_request &multi_incr_request::operator=(const multi_incr_request &other118)
+{
+    hash_key = other118.hash_key;
+    items = other118.items;
+    blind = other118.blind;
+    __isset = other118.__isset;
+    return *this;
+}
+multi_incr_request &multi_incr_request::operator=(multi_incr_request &&other119)
+{
+    hash_key = std::move(other119.hash_key);
+    items = std::move(other119.items);
+    blind = std::move(other119.blind);
+    __isset = std::move(other119.__isset);
+    return *this;
+}
+void multi_incr_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "multi_incr_request(";
+    out << "hash_key=" << to_string(hash_key);
+    out << ", "
+        << "items=" << to_string(items);
+    out << ", "
+        << "blind=";
+    (__isset.blind ? (out << to_string(blind)) : (out << "<null>"));
+    out << ")";
+}
+
+multi_incr_response::~multi_incr_response() throw() {}
+
+void multi_incr_response::__set_error(const int32_t val) { this->error = val; }
+
+void multi_incr_response::__set_new_values(const std::vector<int64_t> &val)
+{
+    this->new_values = val;
+}
+
+void multi_incr_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void multi_incr_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
+
+void multi_incr_response::__set_decree(const int64_t val) { this->decree = val; }
+
+void multi_incr_response::__set_server(const std::string &val) { this->server = val; }
+
+uint32_t multi_incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->new_values.clear();
+                    uint32_t _size120;
+                    ::apache::thrift::protocol::TType _etype123;
+                    xfer += iprot->readListBegin(_etype123, _size120);
+                    this->new_values.resize(_size120);
+                    uint32_t _i124;
+                    for (_i124 = 0; _i124 < _size120; ++_i124) {
+                        xfer += iprot->readI64(this->new_values[_i124]);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.new_values = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->decree);
+                this->__isset.decree = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t multi_incr_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("multi_incr_response");
+
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("new_values", ::apache::thrift::protocol::T_LIST, 2);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64,
+                                      static_cast<uint32_t>(this->new_values.size()));
+        std::vector<int64_t>::const_iterator _iter125;
+        for (_iter125 = this->new_values.begin(); _iter125 != this->new_values.end(); ++_iter125) {
+            xfer += oprot->writeI64((*_iter125));
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->app_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 5);
+    xfer += oprot->writeI64(this->decree);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
+    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(multi_incr_response &a, multi_incr_response &b)
+{
+    using ::std::swap;
+    swap(a.error, b.error);
+    swap(a.new_values, b.new_values);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.decree, b.decree);
+    swap(a.server, b.server);
+    swap(a.__isset, b.__isset);
+}
+
+multi_incr_response::multi_incr_response(const multi_incr_response &other126)
+{
+    error = other126.error;
+    new_values = other126.new_values;
+    app_id = other126.app_id;
+    partition_index = other126.partition_index;
+    decree = other126.decree;
+    server = other126.server;
+    __isset = other126.__isset;
+}
+multi_incr_response::multi_incr_response(multi_incr_response &&other127)
+{
+    error = std::move(other127.error);
+    new_values = std::move(other127.new_values);
+    app_id = std::move(other127.app_id);
+    partition_index = std::move(other127.partition_index);
+    decree = std::move(other127.decree);
+    server = std::move(other127.server);
+    __isset = std::move(other127.__isset);
+}
+multi_incr_response &multi_incr_response::operator=(const multi_incr_response &other128)
+{
+    error = other128.error;
+    new_values = other128.new_values;
+    app_id = other128.app_id;
+    partition_index = other128.partition_index;
+    decree = other128.decree;
+    server = other128.server;
+    __isset = other128.__isset;
+    return *this;
+}
+multi_incr_response &multi_incr_response::operator=(multi_incr_response &&other129)
+{
+    error = std::move(other129.error);
+    new_values = std::move(other129.new_values);
+    app_id = std::move(other129.app_id);
+    partition_index = std::move(other129.partition_index);
+    decree = std::move(other129.decree);
+    server = std::move(other129.server);
+    __isset = std::move(other129.__isset);
+    return *this;
+}
+void multi_incr_response::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "multi_incr_response(";
+    out << "error=" << to_string(error);
+    out << ", "
+        << "new_values=" << to_string(new_values);
+    out << ", "
+        << "app_id=" << to_string(app_id);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ", "
+        << "decree=" << to_string(decree);
+    out << ", "
+        << "server=" << to_string(server);
+    out << ")";
+}
+
+check_and_set_request::~check_and_set_request() throw() {}
+
+void check_and_set_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
+
+void check_and_set_request::__set_check_sort_key(const ::dsn::blob &val)
+{
+    this->check_sort_key = val;
+}
+
+void check_and_set_request::__set_check_type(const cas_check_type::type val)
+{
+    this->check_type = val;
+}
+
+void check_and_set_request::__set_check_operand(const ::dsn::blob &val)
+{
+    this->check_operand = val;
+}
+
+void check_and_set_request::__set_set_diff_sort_key(const bool val)
+{
+    this->set_diff_sort_key = val;
+}
+
+void check_and_set_request::__set_set_sort_key(const ::dsn::blob &val) { this->set_sort_key = val; }
+
+void check_and_set_request::__set_set_value(const ::dsn::blob &val) { this->set_value = val; }
+
+void check_and_set_request::__set_set_expire_ts_seconds(const int32_t val)
+{
+    this->set_expire_ts_seconds = val;
+}
+
+void check_and_set_request::__set_return_check_value(const bool val)
+{
+    this->return_check_value = val;
+}
+
+uint32_t check_and_set_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->hash_key.read(iprot);
+                this->__isset.hash_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->check_sort_key.read(iprot);
+                this->__isset.check_sort_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast130;
+                xfer += iprot->readI32(ecast130);
+                this->check_type = (cas_check_type::type)ecast130;
+                this->__isset.check_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->check_operand.read(iprot);
+                this->__isset.check_operand = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->set_diff_sort_key);
+                this->__isset.set_diff_sort_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->set_sort_key.read(iprot);
+                this->__isset.set_sort_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->set_value.read(iprot);
+                this->__isset.set_value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 8:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->set_expire_ts_seconds);
+                this->__isset.set_expire_ts_seconds = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 9:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->return_check_value);
+                this->__isset.return_check_value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t check_and_set_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("check_and_set_request");
+
+    xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->hash_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->check_sort_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_type", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32((int32_t)this->check_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_operand", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->check_operand.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("set_diff_sort_key", ::apache::thrift::protocol::T_BOOL, 5);
+    xfer += oprot->writeBool(this->set_diff_sort_key);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("set_sort_key", ::apache::thrift::protocol::T_STRUCT, 6);
+    xfer += this->set_sort_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("set_value", ::apache::thrift::protocol::T_STRUCT, 7);
+    xfer += this->set_value.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("set_expire_ts_seconds", ::apache::thrift::protocol::T_I32, 8);
+    xfer += oprot->writeI32(this->set_expire_ts_seconds);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("return_check_value", ::apache::thrift::protocol::T_BOOL, 9);
+    xfer += oprot->writeBool(this->return_check_value);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(check_and_set_request &a, check_and_set_request &b)
+{
+    using ::std::swap;
+    swap(a.hash_key, b.hash_key);
+    swap(a.check_sort_key, b.check_sort_key);
+    swap(a.check_type, b.check_type);
+    swap(a.check_operand, b.check_operand);
+    swap(a.set_diff_sort_key, b.set_diff_sort_key);
+    swap(a.set_sort_key, b.set_sort_key);
+    swap(a.set_value, b.set_value);
+    swap(a.set_expire_ts_seconds, b.set_expire_ts_seconds);
+    swap(a.return_check_value, b.return_check_value);
+    swap(a.__isset, b.__isset);
+}
+
+check_and_set_request::check_and_set_request(const check_and_set_request &other131)
+{
+    hash_key = other131.hash_key;
+    check_sort_key = other131.check_sort_key;
+    check_type = other131.check_type;
+    check_operand = other131.check_operand;
+    set_diff_sort_key = other131.set_diff_sort_key;
+    set_sort_key = other131.set_sort_key;
+    set_value = other131.set_value;
+    set_expire_ts_seconds = other131.set_expire_ts_seconds;
+    return_check_value = other131.return_check_value;
+    __isset = other131.__isset;
+}
+check_and_set_request::check_and_set_request(check_and_set_request &&other132)
+{
+    hash_key = std::move(other132.hash_key);
+    check_sort_key = std::move(other132.check_sort_key);
+    check_type = std::move(other132.check_type);
+    check_operand = std::move(other132.check_operand);
+    set_diff_sort_key = std::move(other132.set_diff_sort_key);
+    set_sort_key = std::move(other132.set_sort_key);
+    set_value = std::move(other132.set_value);
+    set_expire_ts_seconds = std::move(other132.set_expire_ts_seconds);
+    return_check_value = std::move(other132.return_check_value);
+    __isset = std::move(other132.__isset);
+}
+check_and_set_request &check_and_set_request::operator=(const check_and_set_request &other133)
+{
+    hash_key = other133.hash_key;
+    check_sort_key = other133.check_sort_key;
+    check_type = other133.check_type;
+    check_operand = other133.check_operand;
+    set_diff_sort_key = other133.set_diff_sort_key;
+    set_sort_key = other133.set_sort_key;
+    set_value = other133.set_value;
+    set_expire_ts_seconds = other133.set_expire_ts_seconds;
+    return_check_value = other133.return_check_value;
+    __isset = other133.__isset;
+    return *this;
+}
+check_and_set_request &check_and_set_request::operator=(check_and_set_request &&other134)
+{
+    hash_key = std::move(other134.hash_key);
+    check_sort_key = std::move(other134.check_sort_key);
+    check_type = std::move(other134.check_type);
+    check_operand = std::move(other134.check_operand);
+    set_diff_sort_key = std::move(other134.set_diff_sort_key);
+    set_sort_key = std::move(other134.set_sort_key);
+    set_value = std::move(other134.set_value);
+    set_expire_ts_seconds = std::move(other134.set_expire_ts_seconds);
+    return_check_value = std::move(other134.return_check_value);
+    __isset = std::move(other134.__isset);
+    return *this;
+}
+void check_and_set_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "check_and_set_request(";
+    out << "hash_key=" << to_string(hash_key);
+    out << ", "
+        << "check_sort_key=" << to_string(check_sort_key);
+    out << ", "
+        << "check_type=" << to_string(check_type);
+    out << ", "
+        << "check_operand=" << to_string(check_operand);
+    out << ", "
+        << "set_diff_sort_key=" << to_string(set_diff_sort_key);
+    out << ", "
+        << "set_sort_key=" << to_string(set_sort_key);
+    out << ", "
+        << "set_value=" << to_string(set_value);
+    out << ", "
+        << "set_expire_ts_seconds=" << to_string(set_expire_ts_seconds);
+    out << ", "
+        << "return_check_value=" << to_string(return_check_value);
+    out << ")";
+}
+
+check_and_set_response::~check_and_set_response() throw() {}
+
+void check_and_set_response::__set_error(const int32_t val) { this->error = val; }
+
+void check_and_set_response::__set_check_value_returned(const bool val)
+{
+    this->check_value_returned = val;
+}
+
+void check_and_set_response::__set_check_value_exist(const bool val)
+{
+    this->check_value_exist = val;
+}
+
+void check_and_set_response::__set_check_value(const ::dsn::blob &val) { this->check_value = val; }
+
+void check_and_set_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void check_and_set_response::__set_partition_index(const int32_t val)
+{
+    this->partition_index = val;
+}
+
+void check_and_set_response::__set_decree(const int64_t val) { this->decree = val; }
+
+void check_and_set_response::__set_server(const std::string &val) { this->server = val; }
+
+uint32_t check_and_set_response::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->check_value_returned);
+                this->__isset.check_value_returned = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->check_value_exist);
+                this->__isset.check_value_exist = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->check_value.read(iprot);
+                this->__isset.check_value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->decree);
+                this->__isset.decree = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 8:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t check_and_set_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("check_and_set_response");
+
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_value_returned", ::apache::thrift::protocol::T_BOOL, 2);
+    xfer += oprot->writeBool(this->check_value_returned);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_value_exist", ::apache::thrift::protocol::T_BOOL, 3);
+    xfer += oprot->writeBool(this->check_value_exist);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_value", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->check_value.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 5);
+    xfer += oprot->writeI32(this->app_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 6);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 7);
+    xfer += oprot->writeI64(this->decree);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 8);
+    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(check_and_set_response &a, check_and_set_response &b)
+{
+    using ::std::swap;
+    swap(a.error, b.error);
+    swap(a.check_value_returned, b.check_value_returned);
+    swap(a.check_value_exist, b.check_value_exist);
+    swap(a.check_value, b.check_value);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.decree, b.decree);
+    swap(a.server, b.server);
+    swap(a.__isset, b.__isset);
+}
+
+check_and_set_response::check_and_set_response(const check_and_set_response &other135)
+{
+    error = other135.error;
+    check_value_returned = other135.check_value_returned;
+    check_value_exist = other135.check_value_exist;
+    check_value = other135.check_value;
+    app_id = other135.app_id;
+    partition_index = other135.partition_index;
+    decree = other135.decree;
+    server = other135.server;
+    __isset = other135.__isset;
+}
+check_and_set_response::check_and_set_response(check_and_set_response &&other136)
+{
+    error = std::move(other136.error);
+    check_value_returned = std::move(other136.check_value_returned);
+    check_value_exist = std::move(other136.check_value_exist);
+    check_value = std::move(other136.check_value);
+    app_id = std::move(other136.app_id);
+    partition_index = std::move(other136.partition_index);
+    decree = std::move(other136.decree);
+    server = std::move(other136.server);
+    __isset = std::move(other136.__isset);
+}
+check_and_set_response &check_and_set_response::operator=(const check_and_set_response &other137)
+{
+    error = other137.error;
+    check_value_returned = other137.check_value_returned;
+    check_value_exist = other137.check_value_exist;
+    check_value = other137.check_value;
+    app_id = other137.app_id;
+    partition_index = other137.partition_index;
+    decree = other137.decree;
+    server = other137.server;
+    __isset = other137.__isset;
+    return *this;
+}
+check_and_set_response &check_and_set_response::operator=(check_and_set_response &&other138)
+{
+    error = std::move(other138.error);
+    check_value_returned = std::move(other138.check_value_returned);
+    check_value_exist = std::move(other138.check_value_exist);
+    check_value = std::move(other138.check_value);
+    app_id = std::move(other138.app_id);
+    partition_index = std::move(other138.partition_index);
+    decree = std::move(other138.decree);
+    server = std::move(other138.server);
+    __isset = std::move(other138.__isset);
+    return *this;
+}
+void check_and_set_response::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "check_and_set_response(";
+    out << "error=" << to_string(error);
+    out << ", "
+        << "check_value_returned=" << to_string(check_value_returned);
+    out << ", "
+        << "check_value_exist=" << to_string(check_value_exist);
+    out << ", "
+        << "check_value=" << to_string(check_value);
+    out << ", "
+        << "app_id=" << to_string(app_id);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ", "
+        << "decree=" << to_string(decree);
+    out << ", "
+        << "server=" << to_string(server);
+    out << ")";
+}
+
+mutate::~mutate() throw() {}
+
+void mutate::__set_operation(const mutate_operation::type val) { this->operation = val; }
+
+void mutate::__set_sort_key(const ::dsn::blob &val) { this->sort_key = val; }
+
+void mutate::__set_value(const ::dsn::blob &val) { this->value = val; }
+
+void mutate::__set_set_expire_ts_seconds(const int32_t val) { this->set_expire_ts_seconds = val; }
+
+uint32_t mutate::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast139;
+                xfer += iprot->readI32(ecast139);
+                this->operation = (mutate_operation::type)ecast139;
+                this->__isset.operation = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->sort_key.read(iprot);
+                this->__isset.sort_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->value.read(iprot);
+                this->__isset.value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->set_expire_ts_seconds);
+                this->__isset.set_expire_ts_seconds = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t mutate::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("mutate");
+
+    xfer += oprot->writeFieldBegin("operation", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32((int32_t)this->operation);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->sort_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->value.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("set_expire_ts_seconds", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(this->set_expire_ts_seconds);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(mutate &a, mutate &b)
+{
+    using ::std::swap;
+    swap(a.operation, b.operation);
+    swap(a.sort_key, b.sort_key);
+    swap(a.value, b.value);
+    swap(a.set_expire_ts_seconds, b.set_expire_ts_seconds);
+    swap(a.__isset, b.__isset);
+}
+
+mutate::mutate(const mutate &other140)
+{
+    operation = other140.operation;
+    sort_key = other140.sort_key;
+    value = other140.value;
+    set_expire_ts_seconds = other140.set_expire_ts_seconds;
+    __isset = other140.__isset;
+}
+mutate::mutate(mutate &&other141)
+{
+    operation = std::move(other141.operation);
+    sort_key = std::move(other141.sort_key);
+    value = std::move(other141.value);
+    set_expire_ts_seconds = std::move(other141.set_expire_ts_seconds);
+    __isset = std::move(other141.__isset);
+}
+mutate &mutate::operator=(const mutate &other142)
+{
+    operation = other142.operation;
+    sort_key = other142.sort_key;
+    value = other142.value;
+    set_expire_ts_seconds = other142.set_expire_ts_seconds;
+    __isset = other142.__isset;
+    return *this;
+}
+mutate &mutate::operator=(mutate &&other143)
+{
+    operation = std::move(other143.operation);
+    sort_key = std::move(other143.sort_key);
+    value = std::move(other143.value);
+    set_expire_ts_seconds = std::move(other143.set_expire_ts_seconds);
+    __isset = std::move(other143.__isset);
+    return *this;
+}
+void mutate::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "mutate(";
+    out << "operation=" << to_string(operation);
+    out << ", "
+        << "sort_key=" << to_string(sort_key);
+    out << ", "
+        << "value=" << to_string(value);
+    out << ", "
+        << "set_expire_ts_seconds=" << to_string(set_expire_ts_seconds);
+    out << ")";
+}
+
+check_and_mutate_request::~check_and_mutate_request() throw() {}
+
+void check_and_mutate_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
+
+void check_and_mutate_request::__set_check_sort_key(const ::dsn::blob &val)
+{
+    this->check_sort_key = val;
+}
+
+void check_and_mutate_request::__set_check_type(const cas_check_type::type val)
+{
+    this->check_type = val;
+}
+
+void check_and_mutate_request::__set_check_operand(const ::dsn::blob &val)
+{
+    this->check_operand = val;
+}
+
+void check_and_mutate_request::__set_mutate_list(const std::vector<mutate> &val)
+{
+    this->mutate_list = val;
+}
+
+void check_and_mutate_request::__set_return_check_value(const bool val)
+{
+    this->return_check_value = val;
+}
+
+uint32_t check_and_mutate_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->hash_key.read(iprot);
+                this->__isset.hash_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->check_sort_key.read(iprot);
+                this->__isset.check_sort_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast144;
+                xfer += iprot->readI32(ecast144);
+                this->check_type = (cas_check_type::type)ecast144;
+                this->__isset.check_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->check_operand.read(iprot);
+                this->__isset.check_operand = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->mutate_list.clear();
+                    uint32_t _size145;
+                    ::apache::thrift::protocol::TType _etype148;
+                    xfer += iprot->readListBegin(_etype148, _size145);
+                    this->mutate_list.resize(_size145);
+                    uint32_t _i149;
+                    for (_i149 = 0; _i149 < _size145; ++_i149) {
+                        xfer += this->mutate_list[_i149].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.mutate_list = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->return_check_value);
+                this->__isset.return_check_value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t check_and_mutate_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("check_and_mutate_request");
+
+    xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->hash_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->check_sort_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_type", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32((int32_t)this->check_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_operand", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->check_operand.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("mutate_list", ::apache::thrift::protocol::T_LIST, 5);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->mutate_list.size()));
+        std::vector<mutate>::const_iterator _iter150;
+        for (_iter150 = this->mutate_list.begin(); _iter150 != this->mutate_list.end(); ++_iter150) {
+            xfer += (*_iter150).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("return_check_value", ::apache::thrift::protocol::T_BOOL, 6);
+    xfer += oprot->writeBool(this->return_check_value);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(check_and_mutate_request &a, check_and_mutate_request &b)
+{
+    using ::std::swap;
+    swap(a.hash_key, b.hash_key);
+    swap(a.check_sort_key, b.check_sort_key);
+    swap(a.check_type, b.check_type);
+    swap(a.check_operand, b.check_operand);
+    swap(a.mutate_list, b.mutate_list);
+    swap(a.return_check_value, b.return_check_value);
+    swap(a.__isset, b.__isset);
+}
+
+check_and_mutate_request::check_and_mutate_request(const check_and_mutate_request &other151)
+{
+    hash_key = other151.hash_key;
+    check_sort_key = other151.check_sort_key;
+    check_type = other151.check_type;
+    check_operand = other151.check_operand;
+    mutate_list = other151.mutate_list;
+    return_check_value = other151.return_check_value;
+    __isset = other151.__isset;
+}
+check_and_mutate_request::check_and_mutate_request(check_and_mutate_request &&other152)
+{
+    hash_key = std::move(other152.hash_key);
+    check_sort_key = std::move(other152.check_sort_key);
+    check_type = std::move(other152.check_type);
+    check_operand = std::move(other152.check_operand);
+    mutate_list = std::move(other152.mutate_list);
+    return_check_value = std::move(other152.return_check_value);
+    __isset = std::move(other152.__isset);
+}
+check_and_mutate_request &check_and_mutate_request::
+operator=(const check_and_mutate_request &other153)
+{
+    hash_key = other153.hash_key;
+    check_sort_key = other153.check_sort_key;
+    check_type = other153.check_type;
+    check_operand = other153.check_operand;
+    mutate_list = other153.mutate_list;
+    return_check_value = other153.return_check_value;
+    __isset = other153.__isset;
+    return *this;
+}
+check_and_mutate_request &check_and_mutate_request::operator=(check_and_mutate_request &&other154)
+{
+    hash_key = std::move(other154.hash_key);
+    check_sort_key = std::move(other154.check_sort_key);
+    check_type = std::move(other154.check_type);
+    check_operand = std::move(other154.check_operand);
+    mutate_list = std::move(other154.mutate_list);
+    return_check_value = std::move(other154.return_check_value);
+    __isset = std::move(other154.__isset);
+    return *this;
+}
+void check_and_mutate_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "check_and_mutate_request(";
+    out << "hash_key=" << to_string(hash_key);
+    out << ", "
+        << "check_sort_key=" << to_string(check_sort_key);
+    out << ", "
+        << "check_type=" << to_string(check_type);
+    out << ", "
+        << "check_operand=" << to_string(check_operand);
+    out << ", "
+        << "mutate_list=" << to_string(mutate_list);
+    out << ", "
+        << "return_check_value=" << to_string(return_check_value);
+    out << ")";
+}
+
+check_and_mutate_response::~check_and_mutate_response() throw() {}
+
+void check_and_mutate_response::__set_error(const int32_t val) { this->error = val; }
+
+void check_and_mutate_response::__set_check_value_returned(const bool val)
+{
+    this->check_value_returned = val;
+}
+
+void check_and_mutate_response::__set_check_value_exist(const bool val)
+{
+    this->check_value_exist = val;
+}
+
+void check_and_mutate_response::__set_check_value(const ::dsn::blob &val)
+{
+    this->check_value = val;
+}
+
+void check_and_mutate_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void check_and_mutate_response::__set_partition_index(const int32_t val)
+{
+    this->partition_index = val;
+}
+
+void check_and_mutate_response::__set_decree(const int64_t val) { this->decree = val; }
+
+void check_and_mutate_response::__set_server(const std::string &val) { this->server = val; }
+
+uint32_t check_and_mutate_response::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->check_value_returned);
+                this->__isset.check_value_returned = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->check_value_exist);
+                this->__isset.check_value_exist = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->check_value.read(iprot);
+                this->__isset.check_value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->decree);
+                this->__isset.decree = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 8:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t check_and_mutate_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("check_and_mutate_response");
+
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_value_returned", ::apache::thrift::protocol::T_BOOL, 2);
+    xfer += oprot->writeBool(this->check_value_returned);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_value_exist", ::apache::thrift::protocol::T_BOOL, 3);
+    xfer += oprot->writeBool(this->check_value_exist);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("check_value", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->check_value.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 5);
+    xfer += oprot->writeI32(this->app_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 6);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 7);
+    xfer += oprot->writeI64(this->decree);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 8);
+    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(check_and_mutate_response &a, check_and_mutate_response &b)
+{
+    using ::std::swap;
+    swap(a.error, b.error);
+    swap(a.check_value_returned, b.check_value_returned);
+    swap(a.check_value_exist, b.check_value_exist);
+    swap(a.check_value, b.check_value);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.decree, b.decree);
+    swap(a.server, b.server);
+    swap(a.__isset, b.__isset);
+}
+
+check_and_mutate_response::check_and_mutate_response(const check_and_mutate_response &other155)
+{
+    error = other155.error;
+    check_value_returned = other155.check_value_returned;
+    check_value_exist = other155.check_value_exist;
+    check_value = other155.check_value;
+    app_id = other155.app_id;
+    partition_index = other155.partition_index;
+    decree = other155.decree;
+    server = other155.server;
+    __isset = other155.__isset;
+}
+check_and_mutate_response::check_and_mutate_response(check_and_mutate_response &&other156)
+{
+    error = std::move(other156.error);
+    check_value_returned = std::move(other156.check_value_returned);
+    check_value_exist = std::move(other156.check_value_exist);
+    check_value = std::move(other156.check_value);
+    app_id = std::move(other156.app_id);
+    partition_index = std::move(other156.partition_index);
+    decree = std::move(other156.decree);
+    server = std::move(other156.server);
+    __isset = std::move(other156.__isset);
+}
+check_and_mutate_response &check_and_mutate_response::
+operator=(const check_and_mutate_response &other157)
+{
+    error = other157.error;
+    check_value_returned = other157.check_value_returned;
+    check_value_exist = other157.check_value_exist;
+    check_value = other157.check_value;
+    app_id = other157.app_id;
+    partition_index = other157.partition_index;
+    decree = other157.decree;
+    server = other157.server;
+    __isset = other157.__isset;
+    return *this;
+}
+check_and_mutate_response &check_and_mutate_response::
+operator=(check_and_mutate_response &&other158)
+{
+    error = std::move(other158.error);
+    check_value_returned = std::move(other158.check_value_returned);
+    check_value_exist = std::move(other158.check_value_exist);
+    check_value = std::move(other158.check_value);
+    app_id = std::move(other158.app_id);
+    partition_index = std::move(other158.partition_index);
+    decree = std::move(other158.decree);
+    server = std::move(other158.server);
+    __isset = std::move(other158.__isset);
+    return *this;
+}
+void check_and_mutate_response::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "check_and_mutate_response(";
+    out << "error=" << to_string(error);
+    out << ", "
+        << "check_value_returned=" << to_string(check_value_returned);
+    out << ", "
+        << "check_value_exist=" << to_string(check_value_exist);
+    out << ", "
+        << "check_value=" << to_string(check_value);
+    out << ", "
+        << "app_id=" << to_string(app_id);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ", "
+        << "decree=" << to_string(decree);
+    out << ", "
+        << "server=" << to_string(server);
+    out << ")";
+}
+
+get_scanner_request::~get_scanner_request() throw() {}
+
+void get_scanner_request::__set_start_key(const ::dsn::blob &val) { this->start_key = val; }
+
+void get_scanner_request::__set_stop_key(const ::dsn::blob &val) { this->stop_key = val; }
+
+void get_scanner_request::__set_start_inclusive(const bool val) { this->start_inclusive = val; }
+
+void get_scanner_request::__set_stop_inclusive(const bool val) { this->stop_inclusive = val; }
+
+void get_scanner_request::__set_batch_size(const int32_t val) { this->batch_size = val; }
+
+void get_scanner_request::__set_no_value(const bool val) { this->no_value = val; }
+
+void get_scanner_request::__set_hash_key_filter_type(const filter_type::type val)
+{
+    this->hash_key_filter_type = val;
+}
+
+void get_scanner_request::__set_hash_key_filter_pattern(const ::dsn::blob &val)
+{
+    this->hash_key_filter_pattern = val;
+}
+
+void get_scanner_request::__set_sort_key_filter_type(const filter_type::type val)
+{
+    this->sort_key_filter_type = val;
+}
+
+void get_scanner_request::__set_sort_key_filter_pattern(const ::dsn::blob &val)
+{
+    this->sort_key_filter_pattern = val;
+}
+
+void get_scanner_request::__set_value_filter_type(const filter_type::type val)
+{
+    this->value_filter_type = val;
+}
+
+void get_scanner_request::__set_value_filter_pattern(const ::dsn::blob &val)
+{
+    this->value_filter_pattern = val;
+}
+
+void get_scanner_request::__set_max_batch_bytes(const int64_t val) { this->max_batch_bytes = val; }
+
+void get_scanner_request::__set_max_batch_time_us(const int64_t val)
+{
+    this->max_batch_time_us = val;
+}
+
+void get_scanner_request::__set_prefetch(const bool val) { this->prefetch = val; }
+
+void get_scanner_request::__set_reverse(const bool val) { this->reverse = val; }
+
+void get_scanner_request::__set_deadline_ms(const int64_t val) { this->deadline_ms = val; }
+
+uint32_t get_scanner_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->start_key.read(iprot);
+                this->__isset.start_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->stop_key.read(iprot);
+                this->__isset.stop_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->start_inclusive);
+                this->__isset.start_inclusive = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->stop_inclusive);
+                this->__isset.stop_inclusive = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->batch_size);
+                this->__isset.batch_size = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->no_value);
+                this->__isset.no_value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast159;
+                xfer += iprot->readI32(ecast159);
+                this->hash_key_filter_type = (filter_type::type)ecast159;
+                this->__isset.hash_key_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 8:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->hash_key_filter_pattern.read(iprot);
+                this->__isset.hash_key_filter_pattern = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 9:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast160;
+                xfer += iprot->readI32(ecast160);
+                this->sort_key_filter_type = (filter_type::type)ecast160;
+                this->__isset.sort_key_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 10:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->sort_key_filter_pattern.read(iprot);
+                this->__isset.sort_key_filter_pattern = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 11:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast161;
+                xfer += iprot->readI32(ecast161);
+                this->value_filter_type = (filter_type::type)ecast161;
+                this->__isset.value_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 12:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->value_filter_pattern.read(iprot);
+                this->__isset.value_filter_pattern = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 13:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->max_batch_bytes);
+                this->__isset.max_batch_bytes = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 14:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->max_batch_time_us);
+                this->__isset.max_batch_time_us = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 15:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->prefetch);
+                this->__isset.prefetch = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 16:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->reverse);
+                this->__isset.reverse = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 17:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->deadline_ms);
+                this->__isset.deadline_ms = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t get_scanner_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("get_scanner_request");
+
+    xfer += oprot->writeFieldBegin("start_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->start_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("stop_key", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->stop_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("start_inclusive", ::apache::thrift::protocol::T_BOOL, 3);
+    xfer += oprot->writeBool(this->start_inclusive);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("stop_inclusive", ::apache::thrift::protocol::T_BOOL, 4);
+    xfer += oprot->writeBool(this->stop_inclusive);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("batch_size", ::apache::thrift::protocol::T_I32, 5);
+    xfer += oprot->writeI32(this->batch_size);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("no_value", ::apache::thrift::protocol::T_BOOL, 6);
+    xfer += oprot->writeBool(this->no_value);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("hash_key_filter_type", ::apache::thrift::protocol::T_I32, 7);
+    xfer += oprot->writeI32((int32_t)this->hash_key_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("hash_key_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 8);
+    xfer += this->hash_key_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("sort_key_filter_type", ::apache::thrift::protocol::T_I32, 9);
+    xfer += oprot->writeI32((int32_t)this->sort_key_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("sort_key_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 10);
+    xfer += this->sort_key_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_filter_type", ::apache::thrift::protocol::T_I32, 11);
+    xfer += oprot->writeI32((int32_t)this->value_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("value_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 12);
+    xfer += this->value_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("max_batch_bytes", ::apache::thrift::protocol::T_I64, 13);
+    xfer += oprot->writeI64(this->max_batch_bytes);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("max_batch_time_us", ::apache::thrift::protocol::T_I64, 14);
+    xfer += oprot->writeI64(this->max_batch_time_us);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("prefetch", ::apache::thrift::protocol::T_BOOL, 15);
+    xfer += oprot->writeBool(this->prefetch);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("reverse", ::apache::thrift::protocol::T_BOOL, 16);
+    xfer += oprot->writeBool(this->reverse);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("deadline_ms", ::apache::thrift::protocol::T_I64, 17);
+    xfer += oprot->writeI64(this->deadline_ms);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(get_scanner_request &a, get_scanner_request &b)
+{
+    using ::std::swap;
+    swap(a.start_key, b.start_key);
+    swap(a.stop_key, b.stop_key);
+    swap(a.start_inclusive, b.start_inclusive);
+    swap(a.stop_inclusive, b.stop_inclusive);
+    swap(a.batch_size, b.batch_size);
+    swap(a.no_value, b.no_value);
+    swap(a.hash_key_filter_type, b.hash_key_filter_type);
+    swap(a.hash_key_filter_pattern, b.hash_key_filter_pattern);
+    swap(a.sort_key_filter_type, b.sort_key_filter_type);
+    swap(a.sort_key_filter_pattern, b.sort_key_filter_pattern);
+    swap(a.value_filter_type, b.value_filter_type);
+    swap(a.value_filter_pattern, b.value_filter_pattern);
+    swap(a.max_batch_bytes, b.max_batch_bytes);
+    swap(a.max_batch_time_us, b.max_batch_time_us);
+    swap(a.prefetch, b.prefetch);
+    swap(a.reverse, b.reverse);
+    swap(a.deadline_ms, b.deadline_ms);
+    swap(a.__isset, b.__isset);
+}
+
+get_scanner_request::get_scanner_request(const get_scanner_request &other162)
+{
+    start_key = other162.start_key;
+    stop_key = other162.stop_key;
+    start_inclusive = other162.start_inclusive;
+    stop_inclusive = other162.stop_inclusive;
+    batch_size = other162.batch_size;
+    no_value = other162.no_value;
+    hash_key_filter_type = other162.hash_key_filter_type;
+    hash_key_filter_pattern = other162.hash_key_filter_pattern;
+    sort_key_filter_type = other162.sort_key_filter_type;
+    sort_key_filter_pattern = other162.sort_key_filter_pattern;
+    value_filter_type = other162.value_filter_type;
+    value_filter_pattern = other162.value_filter_pattern;
+    max_batch_bytes = other162.max_batch_bytes;
+    max_batch_time_us = other162.max_batch_time_us;
+    prefetch = other162.prefetch;
+    reverse = other162.reverse;
+    deadline_ms = other162.deadline_ms;
+    __isset = other162.__isset;
+}
+get_scanner_request::get_scanner_request(get_scanner_request &&other163)
+{
+    start_key = std::move(other163.start_key);
+    stop_key = std::move(other163.stop_key);
+    start_inclusive = std::move(other163.start_inclusive);
+    stop_inclusive = std::move(other163.stop_inclusive);
+    batch_size = std::move(other163.batch_size);
+    no_value = std::move(other163.no_value);
+    hash_key_filter_type = std::move(other163.hash_key_filter_type);
+    hash_key_filter_pattern = std::move(other163.hash_key_filter_pattern);
+    sort_key_filter_type = std::move(other163.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other163.sort_key_filter_pattern);
+    value_filter_type = std::move(other163.value_filter_type);
+    value_filter_pattern = std::move(other163.value_filter_pattern);
+    max_batch_bytes = std::move(other163.max_batch_bytes);
+    max_batch_time_us = std::move(other163.max_batch_time_us);
+    prefetch = std::move(other163.prefetch);
+    reverse = std::move(other163.reverse);
+    deadline_ms = std::move(other163.deadline_ms);
+    __isset = std::move(other163.__isset);
+}
+get_scanner_request &get_scanner_request::operator=(const get_scanner_request &other164)
+{
+    start_key = other164.start_key;
+    stop_key = other164.stop_key;
+    start_inclusive = other164.start_inclusive;
+    stop_inclusive = other164.stop_inclusive;
+    batch_size = other164.batch_size;
+    no_value = other164.no_value;
+    hash_key_filter_type = other164.hash_key_filter_type;
+    hash_key_filter_pattern = other164.hash_key_filter_pattern;
+    sort_key_filter_type = other164.sort_key_filter_type;
+    sort_key_filter_pattern = other164.sort_key_filter_pattern;
+    value_filter_type = other164.value_filter_type;
+    value_filter_pattern = other164.value_filter_pattern;
+    max_batch_bytes = other164.max_batch_bytes;
+    max_batch_time_us = other164.max_batch_time_us;
+    prefetch = other164.prefetch;
+    reverse = other164.reverse;
+    deadline_ms = other164.deadline_ms;
+    __isset = other164.__isset;
+    return *this;
+}
+get_scanner_request &get_scanner_request::operator=(get_scanner_request &&other165)
+{
+    start_key = std::move(other165.start_key);
+    stop_key = std::move(other165.stop_key);
+    start_inclusive = std::move(other165.start_inclusive);
+    stop_inclusive = std::move(other165.stop_inclusive);
+    batch_size = std::move(other165.batch_size);
+    no_value = std::move(other165.no_value);
+    hash_key_filter_type = std::move(other165.hash_key_filter_type);
+    hash_key_filter_pattern = std::move(other165.hash_key_filter_pattern);
+    sort_key_filter_type = std::move(other165.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other165.sort_key_filter_pattern);
+    value_filter_type = std::move(other165.value_filter_type);
+    value_filter_pattern = std::move(other165.value_filter_pattern);
+    max_batch_bytes = std::move(other165.max_batch_bytes);
+    max_batch_time_us = std::move(other165.max_batch_time_us);
+    prefetch = std::move(other165.prefetch);
+    reverse = std::move(other165.reverse);
+    deadline_ms = std::move(other165.deadline_ms);
+    __isset = std::move(other165.__isset);
+    return *this;
+}
+void get_scanner_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "get_scanner_request(";
+    out << "start_key=" << to_string(start_key);
+    out << ", "
+        << "stop_key=" << to_string(stop_key);
+    out << ", "
+        << "start_inclusive=" << to_string(start_inclusive);
+    out << ", "
+        << "stop_inclusive=" << to_string(stop_inclusive);
+    out << ", "
+        << "batch_size=" << to_string(batch_size);
+    out << ", "
+        << "no_value=" << to_string(no_value);
+    out << ", "
+        << "hash_key_filter_type=" << to_string(hash_key_filter_type);
+    out << ", "
+        << "hash_key_filter_pattern=" << to_string(hash_key_filter_pattern);
+    out << ", "
+        << "sort_key_filter_type=" << to_string(sort_key_filter_type);
+    out << ", "
+        << "sort_key_filter_pattern=" << to_string(sort_key_filter_pattern);
+    out << ", "
+        << "value_filter_type=" << to_string(value_filter_type);
+    out << ", "
+        << "value_filter_pattern=" << to_string(value_filter_pattern);
+    out << ", "
+        << "max_batch_bytes=" << to_string(max_batch_bytes);
+    out << ", "
+        << "max_batch_time_us=" << to_string(max_batch_time_us);
+    out << ", "
+        << "prefetch=" << to_string(prefetch);
+    out << ", "
+        << "reverse=" << to_string(reverse);
+    out << ", "
+        << "deadline_ms=" << to_string(deadline_ms);
+    out << ")";
+}
+
+scan_request::~scan_request() throw() {}
+
+void scan_request::__set_context_id(const int64_t val) { this->context_id = val; }
+
+void scan_request::__set_deadline_ms(const int64_t val) { this->deadline_ms = val; }
+
+uint32_t scan_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->context_id);
+                this->__isset.context_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->deadline_ms);
+                this->__isset.deadline_ms = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t scan_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("scan_request");
+
+    xfer += oprot->writeFieldBegin("context_id", ::apache::thrift::protocol::T_I64, 1);
+    xfer += oprot->writeI64(this->context_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("deadline_ms", ::apache::thrift::protocol::T_I64, 2);
+    xfer += oprot->writeI64(this->deadline_ms);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(scan_request &a, scan_request &b)
+{
+    using ::std::swap;
+    swap(a.context_id, b.context_id);
+    swap(a.deadline_ms, b.deadline_ms);
+    swap(a.__isset, b.__isset);
+}
+
+scan_request::scan_request(const scan_request &other166)
+{
+    context_id = other166.context_id;
+    deadline_ms = other166.deadline_ms;
+    __isset = other166.__isset;
+}
+scan_request::scan_request(scan_request &&other167)
+{
+    context_id = std::move(other167.context_id);
+    deadline_ms = std::move(other167.deadline_ms);
+    __isset = std::move(other167.__isset);
+}
+scan_request &scan_request::operator=(const scan_request &other168)
+{
+    context_id = other168.context_id;
+    deadline_ms = other168.deadline_ms;
+    __isset = other168.__isset;
+    return *this;
+}
+scan_request &scan_request::operator=(scan_request &&other169)
+{
+    context_id = std::move(other169.context_id);
+    deadline_ms = std::move(other169.deadline_ms);
+    __isset = std::move(other169.__isset);
+    return *this;
+}
+void scan_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "scan_request(";
+    out << "context_id=" << to_string(context_id);
+    out << ", "
+        << "deadline_ms=" << to_string(deadline_ms);
+    out << ")";
+}
+
+scan_response::~scan_response() throw() {}
+
+void scan_response::__set_error(const int32_t val) { this->error = val; }
+
+void scan_response::__set_kvs(const std::vector<key_value> &val) { this->kvs = val; }
+
+void scan_response::__set_context_id(const int64_t val) { this->context_id = val; }
+
+void scan_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void scan_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
+
+void scan_response::__set_server(const std::string &val) { this->server = val; }
+
+void scan_response::__set_error_hint(const std::string &val)
+{
+    this->error_hint = val;
+    __isset.error_hint = true;
+}
+
+uint32_t scan_response::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->kvs.clear();
+                    uint32_t _size170;
+                    ::apache::thrift::protocol::TType _etype173;
+                    xfer += iprot->readListBegin(_etype173, _size170);
+                    this->kvs.resize(_size170);
+                    uint32_t _i174;
+                    for (_i174 = 0; _i174 < _size170; ++_i174) {
+                        xfer += this->kvs[_i174].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.kvs = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->context_id);
+                this->__isset.context_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->error_hint);
+                this->__isset.error_hint = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t scan_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("scan_response");
+
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("kvs", ::apache::thrift::protocol::T_LIST, 2);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->kvs.size()));
+        std::vector<key_value>::const_iterator _iter175;
+        for (_iter175 = this->kvs.begin(); _iter175 != this->kvs.end(); ++_iter175) {
+            xfer += (*_iter175).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("context_id", ::apache::thrift::protocol::T_I64, 3);
+    xfer += oprot->writeI64(this->context_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(this->app_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 5);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
+    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldEnd();
+
+    if (this->__isset.error_hint) {
+        xfer += oprot->writeFieldBegin("error_hint", ::apache::thrift::protocol::T_STRING, 7);
+        xfer += oprot->writeString(this->error_hint);
+        xfer += oprot->writeFieldEnd();
+    }
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(scan_response &a, scan_response &b)
+{
+    using ::std::swap;
+    swap(a.error, b.error);
+    swap(a.kvs, b.kvs);
+    swap(a.context_id, b.context_id);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.server, b.server);
+    swap(a.error_hint, b.error_hint);
+    swap(a.__isset, b.__isset);
+}
+
+scan_response::scan_response(const scan_response &other176)
+{
+    error = other176.error;
+    kvs = other176.kvs;
+    context_id = other176.context_id;
+    app_id = other176.app_id;
+    partition_index = other176.partition_index;
+    server = other176.server;
+    error_hint = other176.error_hint;
+    __isset = other176.__isset;
+}
+scan_response::scan_response(scan_response &&other177)
+{
+    error = std::move(other177.error);
+    kvs = std::move(other177.kvs);
+    context_id = std::move(other177.context_id);
+    app_id = std::move(other177.app_id);
+    partition_index = std::move(other177.partition_index);
+    server = std::move(other177.server);
+    error_hint = std::move(other177.error_hint);
+    __isset = std::move(other177.__isset);
+}
+scan_response &scan_response::operator=(const scan_response &other178)
+{
+    error = other178.error;
+    kvs = other178.kvs;
+    context_id = other178.context_id;
+    app_id = other178.app_id;
+    partition_index = other178.partition_index;
+    server = other178.server;
+    error_hint = other178.error_hint;
+    __isset = other178.__isset;
+    return *this;
+}
+scan_response &scan_response::operator=(scan_response &&other179)
+{
+    error = std::move(other179.error);
+    kvs = std::move(other179.kvs);
+    context_id = std::move(other179.context_id);
+    app_id = std::move(other179.app_id);
+    partition_index = std::move(other179.partition_index);
+    server = std::move(other179.server);
+    error_hint = std::move(other179.error_hint);
+    __isset = std::move(other179.__isset);
+    return *this;
+}
+void scan_response::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "scan_response(";
+    out << "error=" << to_string(error);
+    out << ", "
+        << "kvs=" << to_string(kvs);
+    out << ", "
+        << "context_id=" << to_string(context_id);
+    out << ", "
+        << "app_id=" << to_string(app_id);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ", "
+        << "server=" << to_string(server);
+    out << ", "
+        << "error_hint=";
+    (__isset.error_hint ? (out << to_string(error_hint)) : (out << "<null>"));
+    out << ")";
+}
+
+size_histogram::~size_histogram() throw() {}
+
+void size_histogram::__set_count(const int64_t val) { this->count = val; }
+
+void size_histogram::__set_sum(const int64_t val) { this->sum = val; }
+
+void size_histogram::__set_max(const int64_t val) { this->max = val; }
+
+void size_histogram::__set_buckets(const std::vector<int64_t> &val) { this->buckets = val; }
+
+uint32_t size_histogram::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->count);
+                this->__isset.count = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->sum);
+                this->__isset.sum = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->max);
+                this->__isset.max = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->buckets.clear();
+                    uint32_t _size180;
+                    ::apache::thrift::protocol::TType _etype183;
+                    xfer += iprot->readListBegin(_etype183, _size180);
+                    this->buckets.resize(_size180);
+                    uint32_t _i184;
+                    for (_i184 = 0; _i184 < _size180; ++_i184) {
+                        xfer += iprot->readI64(this->buckets[_i184]);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.buckets = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 4:
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t size_histogram::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("size_histogram");
+
+    xfer += oprot->writeFieldBegin("count", ::apache::thrift::protocol::T_I64, 1);
+    xfer += oprot->writeI64(this->count);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("sum", ::apache::thrift::protocol::T_I64, 2);
+    xfer += oprot->writeI64(this->sum);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("max", ::apache::thrift::protocol::T_I64, 3);
+    xfer += oprot->writeI64(this->max);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("buckets", ::apache::thrift::protocol::T_LIST, 4);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64,
+                                      static_cast<uint32_t>(this->buckets.size()));
+        std::vector<int64_t>::const_iterator _iter185;
+        for (_iter185 = this->buckets.begin(); _iter185 != this->buckets.end(); ++_iter185) {
+            xfer += oprot->writeI64((*_iter185));
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(size_histogram &a, size_histogram &b)
+{
+    using ::std::swap;
+    swap(a.count, b.count);
+    swap(a.sum, b.sum);
+    swap(a.max, b.max);
+    swap(a.buckets, b.buckets);
+    swap(a.__isset, b.__isset);
+}
+
+size_histogram::size_histogram(const size_histogram &other186)
+{
+    count = other186.count;
+    sum = other186.sum;
+    max = other186.max;
+    buckets = other186.buckets;
+    __isset = other186.__isset;
+}
+size_histogram::size_histogram(size_histogram &&other187)
+{
+    count = std::move(other187.count);
+    sum = std::move(other187.sum);
+    max = std::move(other187.max);
+    buckets = std::move(other187.buckets);
+    __isset = std::move(other187.__isset);
+}
+size_histogram &size_histogram::operator=(const size_histogram &other188)
+{
+    count = other188.count;
+    sum = other188.sum;
+    max = other188.max;
+    buckets = other188.buckets;
+    __isset = other188.__isset;
+    return *this;
+}
+size_histogram &size_histogram::operator=(size_histogram &&other189)
+{
+    count = std::move(other189.count);
+    sum = std::move(other189.sum);
+    max = std::move(other189.max);
+    buckets = std::move(other189.buckets);
+    __isset = std::move(other189.__isset);
+    return *this;
+}
+void size_histogram::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "size_histogram(";
+    out << "count=" << to_string(count);
+    out << ", "
+        << "sum=" << to_string(sum);
+    out << ", "
+        << "max=" << to_string(max);
+    out << ", "
+        << "buckets=" << to_string(buckets);
+    out << ")";
+}
+
+row_size_item::~row_size_item() throw() {}
+
+void row_size_item::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
+
+void row_size_item::__set_sort_key(const ::dsn::blob &val) { this->sort_key = val; }
+
+void row_size_item::__set_row_size(const int64_t val) { this->row_size = val; }
+
+uint32_t row_size_item::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
             if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->check_value.read(iprot);
-                this->__isset.check_value = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 5:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->app_id);
-                this->__isset.app_id = true;
+                xfer += this->hash_key.read(iprot);
+                this->__isset.hash_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 6:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->partition_index);
-                this->__isset.partition_index = true;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->sort_key.read(iprot);
+                this->__isset.sort_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 7:
+        case 3:
             if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->decree);
-                this->__isset.decree = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 8:
-            if (ftype == ::apache::thrift::protocol::T_STRING) {
-                xfer += iprot->readString(this->server);
-                this->__isset.server = true;
+                xfer += iprot->readI64(this->row_size);
+                this->__isset.row_size = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -3508,42 +5914,22 @@ uint32_t check_and_mutate_response::read(::apache::thrift::protocol::TProtocol *
     return xfer;
 }
 
-uint32_t check_and_mutate_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t row_size_item::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("check_and_mutate_response");
-
-    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
-    xfer += oprot->writeI32(this->error);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("check_value_returned", ::apache::thrift::protocol::T_BOOL, 2);
-    xfer += oprot->writeBool(this->check_value_returned);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("check_value_exist", ::apache::thrift::protocol::T_BOOL, 3);
-    xfer += oprot->writeBool(this->check_value_exist);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("check_value", ::apache::thrift::protocol::T_STRUCT, 4);
-    xfer += this->check_value.write(oprot);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 5);
-    xfer += oprot->writeI32(this->app_id);
-    xfer += oprot->writeFieldEnd();
+    xfer += oprot->writeStructBegin("row_size_item");
 
-    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 6);
-    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->hash_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 7);
-    xfer += oprot->writeI64(this->decree);
+    xfer += oprot->writeFieldBegin("sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->sort_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 8);
-    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldBegin("row_size", ::apache::thrift::protocol::T_I64, 3);
+    xfer += oprot->writeI64(this->row_size);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -3551,129 +5937,106 @@ uint32_t check_and_mutate_response::write(::apache::thrift::protocol::TProtocol
     return xfer;
 }
 
-void swap(check_and_mutate_response &a, check_and_mutate_response &b)
+void swap(row_size_item &a, row_size_item &b)
 {
     using ::std::swap;
-    swap(a.error, b.error);
-    swap(a.check_value_returned, b.check_value_returned);
-    swap(a.check_value_exist, b.check_value_exist);
-    swap(a.check_value, b.check_value);
-    swap(a.app_id, b.app_id);
-    swap(a.partition_index, b.partition_index);
-    swap(a.decree, b.decree);
-    swap(a.server, b.server);
+    swap(a.hash_key, b.hash_key);
+    swap(a.sort_key, b.sort_key);
+    swap(a.row_size, b.row_size);
     swap(a.__isset, b.__isset);
 }
 
-check_and_mutate_response::check_and_mutate_response(const check_and_mutate_response &other102)
+row_size_item::row_size_item(const row_size_item &other190)
 {
-    error = other102.error;
-    check_value_returned = other102.check_value_returned;
-    check_value_exist = other102.check_value_exist;
-    check_value = other102.check_value;
-    app_id = other102.app_id;
-    partition_index = other102.partition_index;
-    decree = other102.decree;
-    server = other102.server;
-    __isset = other102.__isset;
+    hash_key = other190.hash_key;
+    sort_key = other190.sort_key;
+    row_size = other190.row_size;
+    __isset = other190.__isset;
 }
-check_and_mutate_response::check_and_mutate_response(check_and_mutate_response &&other103)
+row_size_item::row_size_item(row_size_item &&other191)
 {
-    error = std::move(other103.error);
-    check_value_returned = std::move(other103.check_value_returned);
-    check_value_exist = std::move(other103.check_value_exist);
-    check_value = std::move(other103.check_value);
-    app_id = std::move(other103.app_id);
-    partition_index = std::move(other103.partition_index);
-    decree = std::move(other103.decree);
-    server = std::move(other103.server);
-    __isset = std::move(other103.__isset);
+    hash_key = std::move(other191.hash_key);
+    sort_key = std::move(other191.sort_key);
+    row_size = std::move(other191.row_size);
+    __isset = std::move(other191.__isset);
 }
-check_and_mutate_response &check_and_mutate_response::
-operator=(const check_and_mutate_response &other104)
+row_size_item &row_size_item::operator=(const row_size_item &other192)
 {
-    error = other104.error;
-    check_value_returned = other104.check_value_returned;
-    check_value_exist = other104.check_value_exist;
-    check_value = other104.check_value;
-    app_id = other104.app_id;
-    partition_index = other104.partition_index;
-    decree = other104.decree;
-    server = other104.server;
-    __isset = other104.__isset;
+    hash_key = other192.hash_key;
+    sort_key = other192.sort_key;
+    row_size = other192.row_size;
+    __isset = other192.__isset;
     return *this;
 }
-check_and_mutate_response &check_and_mutate_response::
-operator=(check_and_mutate_response &&other105)
+row_size_item &row_size_item::operator=(row_size_item &&other193)
 {
-    error = std::move(other105.error);
-    check_value_returned = std::move(other105.check_value_returned);
-    check_value_exist = std::move(other105.check_value_exist);
-    check_value = std::move(other105.check_value);
-    app_id = std::move(other105.app_id);
-    partition_index = std::move(other105.partition_index);
-    decree = std::move(other105.decree);
-    server = std::move(other105.server);
-    __isset = std::move(other105.__isset);
+    hash_key = std::move(other193.hash_key);
+    sort_key = std::move(other193.sort_key);
+    row_size = std::move(other193.row_size);
+    __isset = std::move(other193.__isset);
     return *this;
 }
-void check_and_mutate_response::printTo(std::ostream &out) const
+void row_size_item::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "check_and_mutate_response(";
-    out << "error=" << to_string(error);
-    out << ", "
-        << "check_value_returned=" << to_string(check_value_returned);
-    out << ", "
-        << "check_value_exist=" << to_string(check_value_exist);
-    out << ", "
-        << "check_value=" << to_string(check_value);
-    out << ", "
-        << "app_id=" << to_string(app_id);
-    out << ", "
-        << "partition_index=" << to_string(partition_index);
+    out << "row_size_item(";
+    out << "hash_key=" << to_string(hash_key);
     out << ", "
-        << "decree=" << to_string(decree);
+        << "sort_key=" << to_string(sort_key);
     out << ", "
-        << "server=" << to_string(server);
+        << "row_size=" << to_string(row_size);
     out << ")";
 }
 
-get_scanner_request::~get_scanner_request() throw() {}
-
-void get_scanner_request::__set_start_key(const ::dsn::blob &val) { this->start_key = val; }
+aggregate_scan_request::~aggregate_scan_request() throw() {}
 
-void get_scanner_request::__set_stop_key(const ::dsn::blob &val) { this->stop_key = val; }
+void aggregate_scan_request::__set_start_key(const ::dsn::blob &val) { this->start_key = val; }
 
-void get_scanner_request::__set_start_inclusive(const bool val) { this->start_inclusive = val; }
+void aggregate_scan_request::__set_stop_key(const ::dsn::blob &val) { this->stop_key = val; }
 
-void get_scanner_request::__set_stop_inclusive(const bool val) { this->stop_inclusive = val; }
+void aggregate_scan_request::__set_start_inclusive(const bool val) { this->start_inclusive = val; }
 
-void get_scanner_request::__set_batch_size(const int32_t val) { this->batch_size = val; }
+void aggregate_scan_request::__set_stop_inclusive(const bool val) { this->stop_inclusive = val; }
 
-void get_scanner_request::__set_no_value(const bool val) { this->no_value = val; }
+void aggregate_scan_request::__set_batch_size(const int32_t val) { this->batch_size = val; }
 
-void get_scanner_request::__set_hash_key_filter_type(const filter_type::type val)
+void aggregate_scan_request::__set_hash_key_filter_type(const filter_type::type val)
 {
     this->hash_key_filter_type = val;
 }
 
-void get_scanner_request::__set_hash_key_filter_pattern(const ::dsn::blob &val)
+void aggregate_scan_request::__set_hash_key_filter_pattern(const ::dsn::blob &val)
 {
     this->hash_key_filter_pattern = val;
 }
 
-void get_scanner_request::__set_sort_key_filter_type(const filter_type::type val)
+void aggregate_scan_request::__set_sort_key_filter_type(const filter_type::type val)
 {
     this->sort_key_filter_type = val;
 }
 
-void get_scanner_request::__set_sort_key_filter_pattern(const ::dsn::blob &val)
+void aggregate_scan_request::__set_sort_key_filter_pattern(const ::dsn::blob &val)
 {
     this->sort_key_filter_pattern = val;
 }
 
-uint32_t get_scanner_request::read(::apache::thrift::protocol::TProtocol *iprot)
+void aggregate_scan_request::__set_value_filter_type(const filter_type::type val)
+{
+    this->value_filter_type = val;
+}
+
+void aggregate_scan_request::__set_value_filter_pattern(const ::dsn::blob &val)
+{
+    this->value_filter_pattern = val;
+}
+
+void aggregate_scan_request::__set_stat_size(const bool val) { this->stat_size = val; }
+
+void aggregate_scan_request::__set_top_count(const int32_t val) { this->top_count = val; }
+
+void aggregate_scan_request::__set_context_id(const int64_t val) { this->context_id = val; }
+
+uint32_t aggregate_scan_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -3733,24 +6096,16 @@ uint32_t get_scanner_request::read(::apache::thrift::protocol::TProtocol *iprot)
             }
             break;
         case 6:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->no_value);
-                this->__isset.no_value = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 7:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast106;
-                xfer += iprot->readI32(ecast106);
-                this->hash_key_filter_type = (filter_type::type)ecast106;
+                int32_t ecast194;
+                xfer += iprot->readI32(ecast194);
+                this->hash_key_filter_type = (filter_type::type)ecast194;
                 this->__isset.hash_key_filter_type = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 8:
+        case 7:
             if (ftype == ::apache::thrift::protocol::T_STRUCT) {
                 xfer += this->hash_key_filter_pattern.read(iprot);
                 this->__isset.hash_key_filter_pattern = true;
@@ -3758,17 +6113,17 @@ uint32_t get_scanner_request::read(::apache::thrift::protocol::TProtocol *iprot)
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 9:
+        case 8:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast107;
-                xfer += iprot->readI32(ecast107);
-                this->sort_key_filter_type = (filter_type::type)ecast107;
+                int32_t ecast195;
+                xfer += iprot->readI32(ecast195);
+                this->sort_key_filter_type = (filter_type::type)ecast195;
                 this->__isset.sort_key_filter_type = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 10:
+        case 9:
             if (ftype == ::apache::thrift::protocol::T_STRUCT) {
                 xfer += this->sort_key_filter_pattern.read(iprot);
                 this->__isset.sort_key_filter_pattern = true;
@@ -3776,6 +6131,48 @@ uint32_t get_scanner_request::read(::apache::thrift::protocol::TProtocol *iprot)
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 10:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast196;
+                xfer += iprot->readI32(ecast196);
+                this->value_filter_type = (filter_type::type)ecast196;
+                this->__isset.value_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 11:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->value_filter_pattern.read(iprot);
+                this->__isset.value_filter_pattern = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 12:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->stat_size);
+                this->__isset.stat_size = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 13:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->top_count);
+                this->__isset.top_count = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 14:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->context_id);
+                this->__isset.context_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -3788,11 +6185,11 @@ uint32_t get_scanner_request::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t get_scanner_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t aggregate_scan_request::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("get_scanner_request");
+    xfer += oprot->writeStructBegin("aggregate_scan_request");
 
     xfer += oprot->writeFieldBegin("start_key", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->start_key.write(oprot);
@@ -3814,26 +6211,43 @@ uint32_t get_scanner_request::write(::apache::thrift::protocol::TProtocol *oprot
     xfer += oprot->writeI32(this->batch_size);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("no_value", ::apache::thrift::protocol::T_BOOL, 6);
-    xfer += oprot->writeBool(this->no_value);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("hash_key_filter_type", ::apache::thrift::protocol::T_I32, 7);
+    xfer += oprot->writeFieldBegin("hash_key_filter_type", ::apache::thrift::protocol::T_I32, 6);
     xfer += oprot->writeI32((int32_t)this->hash_key_filter_type);
     xfer += oprot->writeFieldEnd();
 
     xfer +=
-        oprot->writeFieldBegin("hash_key_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 8);
+        oprot->writeFieldBegin("hash_key_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 7);
     xfer += this->hash_key_filter_pattern.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("sort_key_filter_type", ::apache::thrift::protocol::T_I32, 9);
-    xfer += oprot->writeI32((int32_t)this->sort_key_filter_type);
+    xfer += oprot->writeFieldBegin("sort_key_filter_type", ::apache::thrift::protocol::T_I32, 8);
+    xfer += oprot->writeI32((int32_t)this->sort_key_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("sort_key_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 9);
+    xfer += this->sort_key_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_filter_type", ::apache::thrift::protocol::T_I32, 10);
+    xfer += oprot->writeI32((int32_t)this->value_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("value_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 11);
+    xfer += this->value_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("stat_size", ::apache::thrift::protocol::T_BOOL, 12);
+    xfer += oprot->writeBool(this->stat_size);
     xfer += oprot->writeFieldEnd();
 
-    xfer +=
-        oprot->writeFieldBegin("sort_key_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 10);
-    xfer += this->sort_key_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldBegin("top_count", ::apache::thrift::protocol::T_I32, 13);
+    xfer += oprot->writeI32(this->top_count);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("context_id", ::apache::thrift::protocol::T_I64, 14);
+    xfer += oprot->writeI64(this->context_id);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -3841,7 +6255,7 @@ uint32_t get_scanner_request::write(::apache::thrift::protocol::TProtocol *oprot
     return xfer;
 }
 
-void swap(get_scanner_request &a, get_scanner_request &b)
+void swap(aggregate_scan_request &a, aggregate_scan_request &b)
 {
     using ::std::swap;
     swap(a.start_key, b.start_key);
@@ -3849,76 +6263,96 @@ void swap(get_scanner_request &a, get_scanner_request &b)
     swap(a.start_inclusive, b.start_inclusive);
     swap(a.stop_inclusive, b.stop_inclusive);
     swap(a.batch_size, b.batch_size);
-    swap(a.no_value, b.no_value);
     swap(a.hash_key_filter_type, b.hash_key_filter_type);
     swap(a.hash_key_filter_pattern, b.hash_key_filter_pattern);
     swap(a.sort_key_filter_type, b.sort_key_filter_type);
     swap(a.sort_key_filter_pattern, b.sort_key_filter_pattern);
+    swap(a.value_filter_type, b.value_filter_type);
+    swap(a.value_filter_pattern, b.value_filter_pattern);
+    swap(a.stat_size, b.stat_size);
+    swap(a.top_count, b.top_count);
+    swap(a.context_id, b.context_id);
     swap(a.__isset, b.__isset);
 }
 
-get_scanner_request::get_scanner_request(const get_scanner_request &other108)
-{
-    start_key = other108.start_key;
-    stop_key = other108.stop_key;
-    start_inclusive = other108.start_inclusive;
-    stop_inclusive = other108.stop_inclusive;
-    batch_size = other108.batch_size;
-    no_value = other108.no_value;
-    hash_key_filter_type = other108.hash_key_filter_type;
-    hash_key_filter_pattern = other108.hash_key_filter_pattern;
-    sort_key_filter_type = other108.sort_key_filter_type;
-    sort_key_filter_pattern = other108.sort_key_filter_pattern;
-    __isset = other108.__isset;
-}
-get_scanner_request::get_scanner_request(get_scanner_request &&other109)
-{
-    start_key = std::move(other109.start_key);
-    stop_key = std::move(other109.stop_key);
-    start_inclusive = std::move(other109.start_inclusive);
-    stop_inclusive = std::move(other109.stop_inclusive);
-    batch_size = std::move(other109.batch_size);
-    no_value = std::move(other109.no_value);
-    hash_key_filter_type = std::move(other109.hash_key_filter_type);
-    hash_key_filter_pattern = std::move(other109.hash_key_filter_pattern);
-    sort_key_filter_type = std::move(other109.sort_key_filter_type);
-    sort_key_filter_pattern = std::move(other109.sort_key_filter_pattern);
-    __isset = std::move(other109.__isset);
-}
-get_scanner_request &get_scanner_request::operator=(const get_scanner_request &other110)
-{
-    start_key = other110.start_key;
-    stop_key = other110.stop_key;
-    start_inclusive = other110.start_inclusive;
-    stop_inclusive = other110.stop_inclusive;
-    batch_size = other110.batch_size;
-    no_value = other110.no_value;
-    hash_key_filter_type = other110.hash_key_filter_type;
-    hash_key_filter_pattern = other110.hash_key_filter_pattern;
-    sort_key_filter_type = other110.sort_key_filter_type;
-    sort_key_filter_pattern = other110.sort_key_filter_pattern;
-    __isset = other110.__isset;
+aggregate_scan_request::aggregate_scan_request(const aggregate_scan_request &other197)
+{
+    start_key = other197.start_key;
+    stop_key = other197.stop_key;
+    start_inclusive = other197.start_inclusive;
+    stop_inclusive = other197.stop_inclusive;
+    batch_size = other197.batch_size;
+    hash_key_filter_type = other197.hash_key_filter_type;
+    hash_key_filter_pattern = other197.hash_key_filter_pattern;
+    sort_key_filter_type = other197.sort_key_filter_type;
+    sort_key_filter_pattern = other197.sort_key_filter_pattern;
+    value_filter_type = other197.value_filter_type;
+    value_filter_pattern = other197.value_filter_pattern;
+    stat_size = other197.stat_size;
+    top_count = other197.top_count;
+    context_id = other197.context_id;
+    __isset = other197.__isset;
+}
+aggregate_scan_request::aggregate_scan_request(aggregate_scan_request &&other198)
+{
+    start_key = std::move(other198.start_key);
+    stop_key = std::move(other198.stop_key);
+    start_inclusive = std::move(other198.start_inclusive);
+    stop_inclusive = std::move(other198.stop_inclusive);
+    batch_size = std::move(other198.batch_size);
+    hash_key_filter_type = std::move(other198.hash_key_filter_type);
+    hash_key_filter_pattern = std::move(other198.hash_key_filter_pattern);
+    sort_key_filter_type = std::move(other198.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other198.sort_key_filter_pattern);
+    value_filter_type = std::move(other198.value_filter_type);
+    value_filter_pattern = std::move(other198.value_filter_pattern);
+    stat_size = std::move(other198.stat_size);
+    top_count = std::move(other198.top_count);
+    context_id = std::move(other198.context_id);
+    __isset = std::move(other198.__isset);
+}
+aggregate_scan_request &aggregate_scan_request::operator=(const aggregate_scan_request &other199)
+{
+    start_key = other199.start_key;
+    stop_key = other199.stop_key;
+    start_inclusive = other199.start_inclusive;
+    stop_inclusive = other199.stop_inclusive;
+    batch_size = other199.batch_size;
+    hash_key_filter_type = other199.hash_key_filter_type;
+    hash_key_filter_pattern = other199.hash_key_filter_pattern;
+    sort_key_filter_type = other199.sort_key_filter_type;
+    sort_key_filter_pattern = other199.sort_key_filter_pattern;
+    value_filter_type = other199.value_filter_type;
+    value_filter_pattern = other199.value_filter_pattern;
+    stat_size = other199.stat_size;
+    top_count = other199.top_count;
+    context_id = other199.context_id;
+    __isset = other199.__isset;
     return *this;
 }
-get_scanner_request &get_scanner_request::operator=(get_scanner_request &&other111)
-{
-    start_key = std::move(other111.start_key);
-    stop_key = std::move(other111.stop_key);
-    start_inclusive = std::move(other111.start_inclusive);
-    stop_inclusive = std::move(other111.stop_inclusive);
-    batch_size = std::move(other111.batch_size);
-    no_value = std::move(other111.no_value);
-    hash_key_filter_type = std::move(other111.hash_key_filter_type);
-    hash_key_filter_pattern = std::move(other111.hash_key_filter_pattern);
-    sort_key_filter_type = std::move(other111.sort_key_filter_type);
-    sort_key_filter_pattern = std::move(other111.sort_key_filter_pattern);
-    __isset = std::move(other111.__isset);
+aggregate_scan_request &aggregate_scan_request::operator=(aggregate_scan_request &&other200)
+{
+    start_key = std::move(other200.start_key);
+    stop_key = std::move(other200.stop_key);
+    start_inclusive = std::move(other200.start_inclusive);
+    stop_inclusive = std::move(other200.stop_inclusive);
+    batch_size = std::move(other200.batch_size);
+    hash_key_filter_type = std::move(other200.hash_key_filter_type);
+    hash_key_filter_pattern = std::move(other200.hash_key_filter_pattern);
+    sort_key_filter_type = std::move(other200.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other200.sort_key_filter_pattern);
+    value_filter_type = std::move(other200.value_filter_type);
+    value_filter_pattern = std::move(other200.value_filter_pattern);
+    stat_size = std::move(other200.stat_size);
+    top_count = std::move(other200.top_count);
+    context_id = std::move(other200.context_id);
+    __isset = std::move(other200.__isset);
     return *this;
 }
-void get_scanner_request::printTo(std::ostream &out) const
+void aggregate_scan_request::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "get_scanner_request(";
+    out << "aggregate_scan_request(";
     out << "start_key=" << to_string(start_key);
     out << ", "
         << "stop_key=" << to_string(stop_key);
@@ -3928,8 +6362,6 @@ void get_scanner_request::printTo(std::ostream &out) const
         << "stop_inclusive=" << to_string(stop_inclusive);
     out << ", "
         << "batch_size=" << to_string(batch_size);
-    out << ", "
-        << "no_value=" << to_string(no_value);
     out << ", "
         << "hash_key_filter_type=" << to_string(hash_key_filter_type);
     out << ", "
@@ -3938,14 +6370,64 @@ void get_scanner_request::printTo(std::ostream &out) const
         << "sort_key_filter_type=" << to_string(sort_key_filter_type);
     out << ", "
         << "sort_key_filter_pattern=" << to_string(sort_key_filter_pattern);
+    out << ", "
+        << "value_filter_type=" << to_string(value_filter_type);
+    out << ", "
+        << "value_filter_pattern=" << to_string(value_filter_pattern);
+    out << ", "
+        << "stat_size=" << to_string(stat_size);
+    out << ", "
+        << "top_count=" << to_string(top_count);
+    out << ", "
+        << "context_id=" << to_string(context_id);
     out << ")";
 }
 
-scan_request::~scan_request() throw() {}
+aggregate_scan_response::~aggregate_scan_response() throw() {}
 
-void scan_request::__set_context_id(const int64_t val) { this->context_id = val; }
+void aggregate_scan_response::__set_error(const int32_t val) { this->error = val; }
 
-uint32_t scan_request::read(::apache::thrift::protocol::TProtocol *iprot)
+void aggregate_scan_response::__set_row_count(const int64_t val) { this->row_count = val; }
+
+void aggregate_scan_response::__set_hash_key_count(const int64_t val)
+{
+    this->hash_key_count = val;
+}
+
+void aggregate_scan_response::__set_hash_key_size(const size_histogram &val)
+{
+    this->hash_key_size = val;
+}
+
+void aggregate_scan_response::__set_sort_key_size(const size_histogram &val)
+{
+    this->sort_key_size = val;
+}
+
+void aggregate_scan_response::__set_value_size(const size_histogram &val)
+{
+    this->value_size = val;
+}
+
+void aggregate_scan_response::__set_row_size(const size_histogram &val) { this->row_size = val; }
+
+void aggregate_scan_response::__set_top_rows(const std::vector<row_size_item> &val)
+{
+    this->top_rows = val;
+}
+
+void aggregate_scan_response::__set_context_id(const int64_t val) { this->context_id = val; }
+
+void aggregate_scan_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void aggregate_scan_response::__set_partition_index(const int32_t val)
+{
+    this->partition_index = val;
+}
+
+void aggregate_scan_response::__set_server(const std::string &val) { this->server = val; }
+
+uint32_t aggregate_scan_response::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -3965,6 +6447,81 @@ uint32_t scan_request::read(::apache::thrift::protocol::TProtocol *iprot)
         }
         switch (fid) {
         case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->row_count);
+                this->__isset.row_count = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->hash_key_count);
+                this->__isset.hash_key_count = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->hash_key_size.read(iprot);
+                this->__isset.hash_key_size = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->sort_key_size.read(iprot);
+                this->__isset.sort_key_size = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->value_size.read(iprot);
+                this->__isset.value_size = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->row_size.read(iprot);
+                this->__isset.row_size = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 8:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->top_rows.clear();
+                    uint32_t _size201;
+                    ::apache::thrift::protocol::TType _etype204;
+                    xfer += iprot->readListBegin(_etype204, _size201);
+                    this->top_rows.resize(_size201);
+                    uint32_t _i205;
+                    for (_i205 = 0; _i205 < _size201; ++_i205) {
+                        xfer += this->top_rows[_i205].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.top_rows = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 9:
             if (ftype == ::apache::thrift::protocol::T_I64) {
                 xfer += iprot->readI64(this->context_id);
                 this->__isset.context_id = true;
@@ -3972,6 +6529,30 @@ uint32_t scan_request::read(::apache::thrift::protocol::TProtocol *iprot)
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 10:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 11:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 12:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -3984,73 +6565,208 @@ uint32_t scan_request::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t scan_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t aggregate_scan_response::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("scan_request");
+    xfer += oprot->writeStructBegin("aggregate_scan_response");
 
-    xfer += oprot->writeFieldBegin("context_id", ::apache::thrift::protocol::T_I64, 1);
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("row_count", ::apache::thrift::protocol::T_I64, 2);
+    xfer += oprot->writeI64(this->row_count);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("hash_key_count", ::apache::thrift::protocol::T_I64, 3);
+    xfer += oprot->writeI64(this->hash_key_count);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("hash_key_size", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->hash_key_size.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("sort_key_size", ::apache::thrift::protocol::T_STRUCT, 5);
+    xfer += this->sort_key_size.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_size", ::apache::thrift::protocol::T_STRUCT, 6);
+    xfer += this->value_size.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("row_size", ::apache::thrift::protocol::T_STRUCT, 7);
+    xfer += this->row_size.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("top_rows", ::apache::thrift::protocol::T_LIST, 8);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->top_rows.size()));
+        std::vector<row_size_item>::const_iterator _iter206;
+        for (_iter206 = this->top_rows.begin(); _iter206 != this->top_rows.end(); ++_iter206) {
+            xfer += (*_iter206).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("context_id", ::apache::thrift::protocol::T_I64, 9);
     xfer += oprot->writeI64(this->context_id);
     xfer += oprot->writeFieldEnd();
 
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 10);
+    xfer += oprot->writeI32(this->app_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 11);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 12);
+    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldEnd();
+
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
 }
 
-void swap(scan_request &a, scan_request &b)
+void swap(aggregate_scan_response &a, aggregate_scan_response &b)
 {
     using ::std::swap;
+    swap(a.error, b.error);
+    swap(a.row_count, b.row_count);
+    swap(a.hash_key_count, b.hash_key_count);
+    swap(a.hash_key_size, b.hash_key_size);
+    swap(a.sort_key_size, b.sort_key_size);
+    swap(a.value_size, b.value_size);
+    swap(a.row_size, b.row_size);
+    swap(a.top_rows, b.top_rows);
     swap(a.context_id, b.context_id);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.server, b.server);
     swap(a.__isset, b.__isset);
 }
 
-scan_request::scan_request(const scan_request &other112)
-{
-    context_id = other112.context_id;
-    __isset = other112.__isset;
-}
-scan_request::scan_request(scan_request &&other113)
-{
-    context_id = std::move(other113.context_id);
-    __isset = std::move(other113.__isset);
-}
-scan_request &scan_request::operator=(const scan_request &other114)
-{
-    context_id = other114.context_id;
-    __isset = other114.__isset;
+aggregate_scan_response::aggregate_scan_response(const aggregate_scan_response &other207)
+{
+    error = other207.error;
+    row_count = other207.row_count;
+    hash_key_count = other207.hash_key_count;
+    hash_key_size = other207.hash_key_size;
+    sort_key_size = other207.sort_key_size;
+    value_size = other207.value_size;
+    row_size = other207.row_size;
+    top_rows = other207.top_rows;
+    context_id = other207.context_id;
+    app_id = other207.app_id;
+    partition_index = other207.partition_index;
+    server = other207.server;
+    __isset = other207.__isset;
+}
+aggregate_scan_response::aggregate_scan_response(aggregate_scan_response &&other208)
+{
+    error = std::move(other208.error);
+    row_count = std::move(other208.row_count);
+    hash_key_count = std::move(other208.hash_key_count);
+    hash_key_size = std::move(other208.hash_key_size);
+    sort_key_size = std::move(other208.sort_key_size);
+    value_size = std::move(other208.value_size);
+    row_size = std::move(other208.row_size);
+    top_rows = std::move(other208.top_rows);
+    context_id = std::move(other208.context_id);
+    app_id = std::move(other208.app_id);
+    partition_index = std::move(other208.partition_index);
+    server = std::move(other208.server);
+    __isset = std::move(other208.__isset);
+}
+aggregate_scan_response &aggregate_scan_response::operator=(const aggregate_scan_response &other209)
+{
+    error = other209.error;
+    row_count = other209.row_count;
+    hash_key_count = other209.hash_key_count;
+    hash_key_size = other209.hash_key_size;
+    sort_key_size = other209.sort_key_size;
+    value_size = other209.value_size;
+    row_size = other209.row_size;
+    top_rows = other209.top_rows;
+    context_id = other209.context_id;
+    app_id = other209.app_id;
+    partition_index = other209.partition_index;
+    server = other209.server;
+    __isset = other209.__isset;
     return *this;
 }
-scan_request &scan_request::operator=(scan_request &&other115)
-{
-    context_id = std::move(other115.context_id);
-    __isset = std::move(other115.__isset);
+aggregate_scan_response &aggregate_scan_response::operator=(aggregate_scan_response &&other210)
+{
+    error = std::move(other210.error);
+    row_count = std::move(other210.row_count);
+    hash_key_count = std::move(other210.hash_key_count);
+    hash_key_size = std::move(other210.hash_key_size);
+    sort_key_size = std::move(other210.sort_key_size);
+    value_size = std::move(other210.value_size);
+    row_size = std::move(other210.row_size);
+    top_rows = std::move(other210.top_rows);
+    context_id = std::move(other210.context_id);
+    app_id = std::move(other210.app_id);
+    partition_index = std::move(other210.partition_index);
+    server = std::move(other210.server);
+    __isset = std::move(other210.__isset);
     return *this;
 }
-void scan_request::printTo(std::ostream &out) const
+void aggregate_scan_response::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "scan_request(";
-    out << "context_id=" << to_string(context_id);
+    out << "aggregate_scan_response(";
+    out << "error=" << to_string(error);
+    out << ", "
+        << "row_count=" << to_string(row_count);
+    out << ", "
+        << "hash_key_count=" << to_string(hash_key_count);
+    out << ", "
+        << "hash_key_size=" << to_string(hash_key_size);
+    out << ", "
+        << "sort_key_size=" << to_string(sort_key_size);
+    out << ", "
+        << "value_size=" << to_string(value_size);
+    out << ", "
+        << "row_size=" << to_string(row_size);
+    out << ", "
+        << "top_rows=" << to_string(top_rows);
+    out << ", "
+        << "context_id=" << to_string(context_id);
+    out << ", "
+        << "app_id=" << to_string(app_id);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ", "
+        << "server=" << to_string(server);
     out << ")";
 }
 
-scan_response::~scan_response() throw() {}
-
-void scan_response::__set_error(const int32_t val) { this->error = val; }
-
-void scan_response::__set_kvs(const std::vector<key_value> &val) { this->kvs = val; }
-
-void scan_response::__set_context_id(const int64_t val) { this->context_id = val; }
+duplicate_entry::~duplicate_entry() throw() {}
 
-void scan_response::__set_app_id(const int32_t val) { this->app_id = val; }
+void duplicate_entry::__set_timestamp(const int64_t val)
+{
+    this->timestamp = val;
+    __isset.timestamp = true;
+}
 
-void scan_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
+void duplicate_entry::__set_task_code(const ::dsn::task_code &val)
+{
+    this->task_code = val;
+    __isset.task_code = true;
+}
 
-void scan_response::__set_server(const std::string &val) { this->server = val; }
+void duplicate_entry::__set_raw_message(const ::dsn::blob &val)
+{
+    this->raw_message = val;
+    __isset.raw_message = true;
+}
 
-uint32_t scan_response::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t duplicate_entry::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -4064,66 +6780,31 @@ uint32_t scan_response::read(::apache::thrift::protocol::TProtocol *iprot)
     using ::apache::thrift::protocol::TProtocolException;
 
     while (true) {
-        xfer += iprot->readFieldBegin(fname, ftype, fid);
-        if (ftype == ::apache::thrift::protocol::T_STOP) {
-            break;
-        }
-        switch (fid) {
-        case 1:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->error);
-                this->__isset.error = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 2:
-            if (ftype == ::apache::thrift::protocol::T_LIST) {
-                {
-                    this->kvs.clear();
-                    uint32_t _size116;
-                    ::apache::thrift::protocol::TType _etype119;
-                    xfer += iprot->readListBegin(_etype119, _size116);
-                    this->kvs.resize(_size116);
-                    uint32_t _i120;
-                    for (_i120 = 0; _i120 < _size116; ++_i120) {
-                        xfer += this->kvs[_i120].read(iprot);
-                    }
-                    xfer += iprot->readListEnd();
-                }
-                this->__isset.kvs = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 3:
-            if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->context_id);
-                this->__isset.context_id = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 4:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->app_id);
-                this->__isset.app_id = true;
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->timestamp);
+                this->__isset.timestamp = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 5:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->partition_index);
-                this->__isset.partition_index = true;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->task_code.read(iprot);
+                this->__isset.task_code = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 6:
-            if (ftype == ::apache::thrift::protocol::T_STRING) {
-                xfer += iprot->readString(this->server);
-                this->__isset.server = true;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->raw_message.read(iprot);
+                this->__isset.raw_message = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -4140,118 +6821,83 @@ uint32_t scan_response::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t scan_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t duplicate_entry::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("scan_response");
-
-    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
-    xfer += oprot->writeI32(this->error);
-    xfer += oprot->writeFieldEnd();
+    xfer += oprot->writeStructBegin("duplicate_entry");
 
-    xfer += oprot->writeFieldBegin("kvs", ::apache::thrift::protocol::T_LIST, 2);
-    {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
-                                      static_cast<uint32_t>(this->kvs.size()));
-        std::vector<key_value>::const_iterator _iter121;
-        for (_iter121 = this->kvs.begin(); _iter121 != this->kvs.end(); ++_iter121) {
-            xfer += (*_iter121).write(oprot);
-        }
-        xfer += oprot->writeListEnd();
+    if (this->__isset.timestamp) {
+        xfer += oprot->writeFieldBegin("timestamp", ::apache::thrift::protocol::T_I64, 1);
+        xfer += oprot->writeI64(this->timestamp);
+        xfer += oprot->writeFieldEnd();
+    }
+    if (this->__isset.task_code) {
+        xfer += oprot->writeFieldBegin("task_code", ::apache::thrift::protocol::T_STRUCT, 2);
+        xfer += this->task_code.write(oprot);
+        xfer += oprot->writeFieldEnd();
+    }
+    if (this->__isset.raw_message) {
+        xfer += oprot->writeFieldBegin("raw_message", ::apache::thrift::protocol::T_STRUCT, 3);
+        xfer += this->raw_message.write(oprot);
+        xfer += oprot->writeFieldEnd();
     }
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("context_id", ::apache::thrift::protocol::T_I64, 3);
-    xfer += oprot->writeI64(this->context_id);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 4);
-    xfer += oprot->writeI32(this->app_id);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 5);
-    xfer += oprot->writeI32(this->partition_index);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
-    xfer += oprot->writeString(this->server);
-    xfer += oprot->writeFieldEnd();
-
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
 }
 
-void swap(scan_response &a, scan_response &b)
+void swap(duplicate_entry &a, duplicate_entry &b)
 {
     using ::std::swap;
-    swap(a.error, b.error);
-    swap(a.kvs, b.kvs);
-    swap(a.context_id, b.context_id);
-    swap(a.app_id, b.app_id);
-    swap(a.partition_index, b.partition_index);
-    swap(a.server, b.server);
+    swap(a.timestamp, b.timestamp);
+    swap(a.task_code, b.task_code);
+    swap(a.raw_message, b.raw_message);
     swap(a.__isset, b.__isset);
 }
 
-scan_response::scan_response(const scan_response &other122)
+duplicate_entry::duplicate_entry(const duplicate_entry &other211)
 {
-    error = other122.error;
-    kvs = other122.kvs;
-    context_id = other122.context_id;
-    app_id = other122.app_id;
-    partition_index = other122.partition_index;
-    server = other122.server;
-    __isset = other122.__isset;
+    timestamp = other211.timestamp;
+    task_code = other211.task_code;
+    raw_message = other211.raw_message;
+    __isset = other211.__isset;
 }
-scan_response::scan_response(scan_response &&other123)
+duplicate_entry::duplicate_entry(duplicate_entry &&other212)
 {
-    error = std::move(other123.error);
-    kvs = std::move(other123.kvs);
-    context_id = std::move(other123.context_id);
-    app_id = std::move(other123.app_id);
-    partition_index = std::move(other123.partition_index);
-    server = std::move(other123.server);
-    __isset = std::move(other123.__isset);
+    timestamp = std::move(other212.timestamp);
+    task_code = std::move(other212.task_code);
+    raw_message = std::move(other212.raw_message);
+    __isset = std::move(other212.__isset);
 }
-scan_response &scan_response::operator=(const scan_response &other124)
+duplicate_entry &duplicate_entry::operator=(const duplicate_entry &other213)
 {
-    error = other124.error;
-    kvs = other124.kvs;
-    context_id = other124.context_id;
-    app_id = other124.app_id;
-    partition_index = other124.partition_index;
-    server = other124.server;
-    __isset = other124.__isset;
+    timestamp = other213.timestamp;
+    task_code = other213.task_code;
+    raw_message = other213.raw_message;
+    __isset = other213.__isset;
     return *this;
 }
-scan_response &scan_response::operator=(scan_response &&other125)
+duplicate_entry &duplicate_entry::operator=(duplicate_entry &&other214)
 {
-    error = std::move(other125.error);
-    kvs = std::move(other125.kvs);
-    context_id = std::move(other125.context_id);
-    app_id = std::move(other125.app_id);
-    partition_index = std::move(other125.partition_index);
-    server = std::move(other125.server);
-    __isset = std::move(other125.__isset);
+    timestamp = std::move(other214.timestamp);
+    task_code = std::move(other214.task_code);
+    raw_message = std::move(other214.raw_message);
+    __isset = std::move(other214.__isset);
     return *this;
 }
-void scan_response::printTo(std::ostream &out) const
+void duplicate_entry::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "scan_response(";
-    out << "error=" << to_string(error);
-    out << ", "
-        << "kvs=" << to_string(kvs);
-    out << ", "
-        << "context_id=" << to_string(context_id);
-    out << ", "
-        << "app_id=" << to_string(app_id);
+    out << "duplicate_entry(";
+    out << "timestamp=";
+    (__isset.timestamp ? (out << to_string(timestamp)) : (out << "<null>"));
     out << ", "
-        << "partition_index=" << to_string(partition_index);
+        << "task_code=";
+    (__isset.task_code ? (out << to_string(task_code)) : (out << "<null>"));
     out << ", "
-        << "server=" << to_string(server);
+        << "raw_message=";
+    (__isset.raw_message ? (out << to_string(raw_message)) : (out << "<null>"));
     out << ")";
 }
 
@@ -4287,6 +6933,12 @@ void duplicate_request::__set_verify_timetag(const bool val)
     __isset.verify_timetag = true;
 }
 
+void duplicate_request::__set_entries(const std::vector<duplicate_entry> &val)
+{
+    this->entries = val;
+    __isset.entries = true;
+}
+
 uint32_t duplicate_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
@@ -4346,6 +6998,25 @@ uint32_t duplicate_request::read(::apache::thrift::protocol::TProtocol *iprot)
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->entries.clear();
+                    uint32_t _size215;
+                    ::apache::thrift::protocol::TType _etype218;
+                    xfer += iprot->readListBegin(_etype218, _size215);
+                    this->entries.resize(_size215);
+                    uint32_t _i219;
+                    for (_i219 = 0; _i219 < _size215; ++_i219) {
+                        xfer += this->entries[_i219].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.entries = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -4389,6 +7060,19 @@ uint32_t duplicate_request::write(::apache::thrift::protocol::TProtocol *oprot)
         xfer += oprot->writeBool(this->verify_timetag);
         xfer += oprot->writeFieldEnd();
     }
+    if (this->__isset.entries) {
+        xfer += oprot->writeFieldBegin("entries", ::apache::thrift::protocol::T_LIST, 6);
+        {
+            xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                          static_cast<uint32_t>(this->entries.size()));
+            std::vector<duplicate_entry>::const_iterator _iter220;
+            for (_iter220 = this->entries.begin(); _iter220 != this->entries.end(); ++_iter220) {
+                xfer += (*_iter220).write(oprot);
+            }
+            xfer += oprot->writeListEnd();
+        }
+        xfer += oprot->writeFieldEnd();
+    }
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
@@ -4402,45 +7086,50 @@ void swap(duplicate_request &a, duplicate_request &b)
     swap(a.raw_message, b.raw_message);
     swap(a.cluster_id, b.cluster_id);
     swap(a.verify_timetag, b.verify_timetag);
+    swap(a.entries, b.entries);
     swap(a.__isset, b.__isset);
 }
 
-duplicate_request::duplicate_request(const duplicate_request &other126)
+duplicate_request::duplicate_request(const duplicate_request &other221)
 {
-    timestamp = other126.timestamp;
-    task_code = other126.task_code;
-    raw_message = other126.raw_message;
-    cluster_id = other126.cluster_id;
-    verify_timetag = other126.verify_timetag;
-    __isset = other126.__isset;
+    timestamp = other221.timestamp;
+    task_code = other221.task_code;
+    raw_message = other221.raw_message;
+    cluster_id = other221.cluster_id;
+    verify_timetag = other221.verify_timetag;
+    entries = other221.entries;
+    __isset = other221.__isset;
 }
-duplicate_request::duplicate_request(duplicate_request &&other127)
+duplicate_request::duplicate_request(duplicate_request &&other222)
 {
-    timestamp = std::move(other127.timestamp);
-    task_code = std::move(other127.task_code);
-    raw_message = std::move(other127.raw_message);
-    cluster_id = std::move(other127.cluster_id);
-    verify_timetag = std::move(other127.verify_timetag);
-    __isset = std::move(other127.__isset);
+    timestamp = std::move(other222.timestamp);
+    task_code = std::move(other222.task_code);
+    raw_message = std::move(other222.raw_message);
+    cluster_id = std::move(other222.cluster_id);
+    verify_timetag = std::move(other222.verify_timetag);
+    entries = std::move(other222.entries);
+    __isset = std::move(other222.__isset);
 }
-duplicate_request &duplicate_request::operator=(const duplicate_request &other128)
+duplicate_request &duplicate_request::operator=(const duplicate_request &other223)
 {
-    timestamp = other128.timestamp;
-    task_code = other128.task_code;
-    raw_message = other128.raw_message;
-    cluster_id = other128.cluster_id;
-    verify_timetag = other128.verify_timetag;
-    __isset = other128.__isset;
+    timestamp = other223.timestamp;
+    task_code = other223.task_code;
+    raw_message = other223.raw_message;
+    cluster_id = other223.cluster_id;
+    verify_timetag = other223.verify_timetag;
+    entries = other223.entries;
+    __isset = other223.__isset;
     return *this;
 }
-duplicate_request &duplicate_request::operator=(duplicate_request &&other129)
+duplicate_request &duplicate_request::operator=(duplicate_request &&other224)
 {
-    timestamp = std::move(other129.timestamp);
-    task_code = std::move(other129.task_code);
-    raw_message = std::move(other129.raw_message);
-    cluster_id = std::move(other129.cluster_id);
-    verify_timetag = std::move(other129.verify_timetag);
-    __isset = std::move(other129.__isset);
+    timestamp = std::move(other224.timestamp);
+    task_code = std::move(other224.task_code);
+    raw_message = std::move(other224.raw_message);
+    cluster_id = std::move(other224.cluster_id);
+    verify_timetag = std::move(other224.verify_timetag);
+    entries = std::move(other224.entries);
+    __isset = std::move(other224.__isset);
     return *this;
 }
 void duplicate_request::printTo(std::ostream &out) const
@@ -4461,6 +7150,9 @@ void duplicate_request::printTo(std::ostream &out) const
     out << ", "
         << "verify_timetag=";
     (__isset.verify_timetag ? (out << to_string(verify_timetag)) : (out << "<null>"));
+    out << ", "
+        << "entries=";
+    (__isset.entries ? (out << to_string(entries)) : (out << "<null>"));
     out << ")";
 }
 
@@ -4554,30 +7246,30 @@ void swap(duplicate_response &a, duplicate_response &b)
     swap(a.__isset, b.__isset);
 }
 
-duplicate_response::duplicate_response(const duplicate_response &other130)
+duplicate_response::duplicate_response(const duplicate_response &other225)
 {
-    error = other130.error;
-    error_hint = other130.error_hint;
-    __isset = other130.__isset;
+    error = other225.error;
+    error_hint = other225.error_hint;
+    __isset = other225.__isset;
 }
-duplicate_response::duplicate_response(duplicate_response &&other131)
+duplicate_response::duplicate_response(duplicate_response &&other226)
 {
-    error = std::move(other131.error);
-    error_hint = std::move(other131.error_hint);
-    __isset = std::move(other131.__isset);
+    error = std::move(other226.error);
+    error_hint = std::move(other226.error_hint);
+    __isset = std::move(other226.__isset);
 }
-duplicate_response &duplicate_response::operator=(const duplicate_response &other132)
+duplicate_response &duplicate_response::operator=(const duplicate_response &other227)
 {
-    error = other132.error;
-    error_hint = other132.error_hint;
-    __isset = other132.__isset;
+    error = other227.error;
+    error_hint = other227.error_hint;
+    __isset = other227.__isset;
     return *this;
 }
-duplicate_response &duplicate_response::operator=(duplicate_response &&other133)
+duplicate_response &duplicate_response::operator=(duplicate_response &&other228)
 {
-    error = std::move(other133.error);
-    error_hint = std::move(other133.error_hint);
-    __isset = std::move(other133.__isset);
+    error = std::move(other228.error);
+    error_hint = std::move(other228.error_hint);
+    __isset = std::move(other228.__isset);
     return *this;
 }
 void duplicate_response::printTo(std::ostream &out) const
@@ -4591,5 +7283,197 @@ void duplicate_response::printTo(std::ostream &out) const
     (__isset.error_hint ? (out << to_string(error_hint)) : (out << "<null>"));
     out << ")";
 }
+
+maintain_sortkey_count_request::~maintain_sortkey_count_request() throw() {}
+
+void maintain_sortkey_count_request::__set_maintained(const bool val) { this->maintained = val; }
+
+uint32_t maintain_sortkey_count_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->maintained);
+                this->__isset.maintained = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t maintain_sortkey_count_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("maintain_sortkey_count_request");
+
+    xfer += oprot->writeFieldBegin("maintained", ::apache::thrift::protocol::T_BOOL, 1);
+    xfer += oprot->writeBool(this->maintained);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(maintain_sortkey_count_request &a, maintain_sortkey_count_request &b)
+{
+    using ::std::swap;
+    swap(a.maintained, b.maintained);
+    swap(a.__isset, b.__isset);
+}
+
+maintain_sortkey_count_request::maintain_sortkey_count_request(const maintain_sortkey_count_request &other229)
+{
+    maintained = other229.maintained;
+    __isset = other229.__isset;
+}
+maintain_sortkey_count_request::maintain_sortkey_count_request(maintain_sortkey_count_request &&other230)
+{
+    maintained = std::move(other230.maintained);
+    __isset = std::move(other230.__isset);
+}
+maintain_sortkey_count_request &maintain_sortkey_count_request::
+operator=(const maintain_sortkey_count_request &other231)
+{
+    maintained = other231.maintained;
+    __isset = other231.__isset;
+    return *this;
+}
+maintain_sortkey_count_request &maintain_sortkey_count_request::
+operator=(maintain_sortkey_count_request &&other232)
+{
+    maintained = std::move(other232.maintained);
+    __isset = std::move(other232.__isset);
+    return *this;
+}
+void maintain_sortkey_count_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "maintain_sortkey_count_request(";
+    out << "maintained=" << to_string(maintained);
+    out << ")";
+}
+
+bulk_ingest_request::~bulk_ingest_request() throw() {}
+
+void bulk_ingest_request::__set_dir(const std::string &val) { this->dir = val; }
+
+uint32_t bulk_ingest_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->dir);
+                this->__isset.dir = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t bulk_ingest_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("bulk_ingest_request");
+
+    xfer += oprot->writeFieldBegin("dir", ::apache::thrift::protocol::T_STRING, 1);
+    xfer += oprot->writeString(this->dir);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(bulk_ingest_request &a, bulk_ingest_request &b)
+{
+    using ::std::swap;
+    swap(a.dir, b.dir);
+    swap(a.__isset, b.__isset);
+}
+
+bulk_ingest_request::bulk_ingest_request(const bulk_ingest_request &other233)
+{
+    dir = other233.dir;
+    __isset = other233.__isset;
+}
+bulk_ingest_request::bulk_ingest_request(bulk_ingest_request &&other234)
+{
+    dir = std::move(other234.dir);
+    __isset = std::move(other234.__isset);
+}
+bulk_ingest_request &bulk_ingest_request::operator=(const bulk_ingest_request &other235)
+{
+    dir = other235.dir;
+    __isset = other235.__isset;
+    return *this;
+}
+bulk_ingest_request &bulk_ingest_request::operator=(bulk_ingest_request &&other236)
+{
+    dir = std::move(other236.dir);
+    __isset = std::move(other236.__isset);
+    return *this;
+}
+void bulk_ingest_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "bulk_ingest_request(";
+    out << "dir=" << to_string(dir);
+    out << ")";
+}
 }
 } // namespace
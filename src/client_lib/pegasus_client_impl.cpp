@@ -320,6 +320,7 @@ void pegasus_client_impl::async_multi_get(const std::string &hash_key,
 
     ::dsn::apps::multi_get_request req;
     req.hash_key = ::dsn::blob(hash_key.data(), 0, hash_key.size());
+    req.deadline_ms = utils::unix_now_ms() + timeout_milliseconds;
     req.max_kv_count = max_fetch_count;
     req.max_kv_size = max_fetch_size;
     req.start_inclusive = true;
@@ -416,6 +417,7 @@ void pegasus_client_impl::async_multi_get(const std::string &hash_key,
 
     ::dsn::apps::multi_get_request req;
     req.hash_key = ::dsn::blob(hash_key.data(), 0, hash_key.size());
+    req.deadline_ms = utils::unix_now_ms() + timeout_milliseconds;
     req.start_sortkey = ::dsn::blob(start_sortkey.data(), 0, start_sortkey.size());
     req.stop_sortkey = ::dsn::blob(stop_sortkey.data(), 0, stop_sortkey.size());
     req.start_inclusive = options.start_inclusive;
@@ -427,6 +429,9 @@ void pegasus_client_impl::async_multi_get(const std::string &hash_key,
     req.sort_key_filter_type = (dsn::apps::filter_type::type)options.sort_key_filter_type;
     req.sort_key_filter_pattern = ::dsn::blob(
         options.sort_key_filter_pattern.data(), 0, options.sort_key_filter_pattern.size());
+    req.value_filter_type = (dsn::apps::filter_type::type)options.value_filter_type;
+    req.value_filter_pattern = ::dsn::blob(
+        options.value_filter_pattern.data(), 0, options.value_filter_pattern.size());
     ::dsn::blob tmp_key;
     pegasus_generate_key(tmp_key, req.hash_key, ::dsn::blob());
     auto partition_hash = pegasus_key_hash(tmp_key);
@@ -458,6 +463,185 @@ void pegasus_client_impl::async_multi_get(const std::string &hash_key,
                        partition_hash);
 }
 
+int pegasus_client_impl::batch_get(
+    const std::vector<std::pair<std::string, std::string>> &keys,
+    std::map<std::pair<std::string, std::string>, std::string> &values,
+    int timeout_milliseconds)
+{
+    ::dsn::utils::notify_event op_completed;
+    int ret = -1;
+    auto callback = [&](int err,
+                        std::map<std::pair<std::string, std::string>, std::string> &&_values) {
+        ret = err;
+        values = std::move(_values);
+        op_completed.notify();
+    };
+    async_batch_get(keys, std::move(callback), timeout_milliseconds);
+    op_completed.wait();
+    return ret;
+}
+
+void pegasus_client_impl::async_batch_get(
+    const std::vector<std::pair<std::string, std::string>> &keys,
+    async_batch_get_callback_t &&callback,
+    int timeout_milliseconds)
+{
+    // check params
+    if (keys.empty()) {
+        derror("invalid keys: keys should not be empty");
+        if (callback != nullptr)
+            callback(PERR_INVALID_ARGUMENT,
+                     std::map<std::pair<std::string, std::string>, std::string>());
+        return;
+    }
+    for (const auto &key : keys) {
+        if (key.first.empty()) {
+            derror("invalid hash key: hash key should not be empty");
+            if (callback != nullptr)
+                callback(PERR_INVALID_HASH_KEY,
+                         std::map<std::pair<std::string, std::string>, std::string>());
+            return;
+        }
+        if (key.first.size() >= UINT16_MAX) {
+            derror("invalid hash key: hash key length should be less than UINT16_MAX, but %d",
+                   (int)key.first.size());
+            if (callback != nullptr)
+                callback(PERR_INVALID_HASH_KEY,
+                         std::map<std::pair<std::string, std::string>, std::string>());
+            return;
+        }
+    }
+
+    if (_partition_count.load() > 0) {
+        batch_get_by_partition(keys, std::move(callback), timeout_milliseconds);
+        return;
+    }
+    async_query_partition_count(
+        timeout_milliseconds,
+        [ this, keys, user_callback = std::move(callback), timeout_milliseconds ](int err) mutable {
+            if (err != PERR_OK) {
+                if (user_callback != nullptr)
+                    user_callback(err,
+                                  std::map<std::pair<std::string, std::string>, std::string>());
+                return;
+            }
+            batch_get_by_partition(keys, std::move(user_callback), timeout_milliseconds);
+        });
+}
+
+struct pegasus_client_impl::batch_get_context
+{
+    async_batch_get_callback_t callback;
+    std::atomic<int> pending_count;
+    ::dsn::zlock lock;
+    int error;
+    std::map<std::pair<std::string, std::string>, std::string> values;
+};
+
+void pegasus_client_impl::batch_get_by_partition(
+    const std::vector<std::pair<std::string, std::string>> &keys,
+    async_batch_get_callback_t &&callback,
+    int timeout_milliseconds)
+{
+    int32_t partition_count = _partition_count.load();
+    dassert(partition_count > 0, "partition count should be queried before batch_get");
+
+    // group keys by partition index, which is computed in the same way as partition resolver
+    std::map<int32_t, ::dsn::apps::batch_get_request> requests;
+    std::map<int32_t, uint64_t> partition_hashes;
+    for (const auto &key : keys) {
+        ::dsn::blob raw_key;
+        pegasus_generate_key(raw_key, key.first, key.second);
+        uint64_t partition_hash = pegasus_key_hash(raw_key);
+        int32_t partition_index = static_cast<int32_t>(partition_hash % partition_count);
+        ::dsn::apps::full_key k;
+        k.hash_key = ::dsn::blob(key.first.data(), 0, key.first.size());
+        k.sort_key = ::dsn::blob(key.second.data(), 0, key.second.size());
+        requests[partition_index].keys.emplace_back(std::move(k));
+        partition_hashes[partition_index] = partition_hash;
+    }
+
+    auto ctx = std::make_shared<batch_get_context>();
+    ctx->callback = std::move(callback);
+    ctx->pending_count = requests.size();
+    ctx->error = PERR_OK;
+    for (auto &kv : requests) {
+        int32_t partition_index = kv.first;
+        auto new_callback = [this, ctx, partition_index](
+            ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+        {
+            ::dsn::apps::batch_get_response response;
+            int ret;
+            if (err == ::dsn::ERR_OK) {
+                ::unmarshall(resp, response);
+                ret = get_client_error(get_rocksdb_server_error(response.error));
+                if (ret == PERR_OK && response.partition_index != partition_index) {
+                    // partition count of the app has been changed, query it again next time
+                    derror("batch_get is served by partition %d, but expect %d",
+                           response.partition_index,
+                           partition_index);
+                    _partition_count.store(0);
+                    ret = PERR_SERVER_CHANGED;
+                }
+            } else {
+                ret = get_client_error(int(err));
+            }
+
+            {
+                ::dsn::zauto_lock l(ctx->lock);
+                if (ret != PERR_OK) {
+                    if (ctx->error == PERR_OK)
+                        ctx->error = ret;
+                } else {
+                    for (auto &data : response.data) {
+                        ctx->values.emplace(
+                            std::make_pair(data.hash_key.to_string(), data.sort_key.to_string()),
+                            data.value.to_string());
+                    }
+                }
+            }
+
+            if (--ctx->pending_count == 0 && ctx->callback != nullptr) {
+                if (ctx->error != PERR_OK)
+                    ctx->values.clear();
+                ctx->callback(ctx->error, std::move(ctx->values));
+            }
+        };
+        _client->batch_get(kv.second,
+                           std::move(new_callback),
+                           std::chrono::milliseconds(timeout_milliseconds),
+                           partition_hashes[partition_index]);
+    }
+}
+
+void pegasus_client_impl::async_query_partition_count(int timeout_milliseconds,
+                                                      std::function<void(int)> &&callback)
+{
+    auto new_callback = [ this, user_callback = std::move(callback) ](
+        ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+    {
+        configuration_query_by_index_response response;
+        if (err == ERR_OK) {
+            ::dsn::unmarshall(resp, response);
+            if (response.err == ERR_OK) {
+                _partition_count.store(response.partition_count);
+            }
+        }
+        user_callback(get_client_error(err == ERR_OK ? int(response.err) : int(err)));
+    };
+
+    configuration_query_by_index_request req;
+    req.app_name = _app_name;
+    ::dsn::rpc::call(_meta_server,
+                     RPC_CM_QUERY_PARTITION_CONFIG_BY_INDEX,
+                     req,
+                     nullptr,
+                     new_callback,
+                     std::chrono::milliseconds(timeout_milliseconds),
+                     0,
+                     0);
+}
+
 int pegasus_client_impl::multi_get_sortkeys(const std::string &hash_key,
                                             std::set<std::string> &sort_keys,
                                             int max_fetch_count,
@@ -503,6 +687,7 @@ void pegasus_client_impl::async_multi_get_sortkeys(const std::string &hash_key,
 
     ::dsn::apps::multi_get_request req;
     req.hash_key = ::dsn::blob(hash_key.data(), 0, hash_key.size());
+    req.deadline_ms = utils::unix_now_ms() + timeout_milliseconds;
     req.max_kv_count = max_fetch_count;
     req.max_kv_size = max_fetch_size;
     req.no_value = true;
@@ -736,7 +921,8 @@ int pegasus_client_impl::incr(const std::string &hash_key,
                               int64_t &new_value,
                               int timeout_milliseconds,
                               int ttl_seconds,
-                              internal_info *info)
+                              internal_info *info,
+                              bool blind)
 {
     ::dsn::utils::notify_event op_completed;
     int ret = -1;
@@ -747,8 +933,13 @@ int pegasus_client_impl::incr(const std::string &hash_key,
             (*info) = std::move(_info);
         op_completed.notify();
     };
-    async_incr(
-        hash_key, sort_key, increment, std::move(callback), timeout_milliseconds, ttl_seconds);
+    async_incr(hash_key,
+               sort_key,
+               increment,
+               std::move(callback),
+               timeout_milliseconds,
+               ttl_seconds,
+               blind);
     op_completed.wait();
     return ret;
 }
@@ -758,7 +949,8 @@ void pegasus_client_impl::async_incr(const std::string &hash_key,
                                      int64_t increment,
                                      async_incr_callback_t &&callback,
                                      int timeout_milliseconds,
-                                     int ttl_seconds)
+                                     int ttl_seconds,
+                                     bool blind)
 {
     // check params
     if (hash_key.size() >= UINT16_MAX) {
@@ -782,6 +974,8 @@ void pegasus_client_impl::async_incr(const std::string &hash_key,
         req.expire_ts_seconds = ttl_seconds;
     else
         req.expire_ts_seconds = ttl_seconds + utils::epoch_now();
+    if (blind)
+        req.__set_blind(true);
     auto partition_hash = pegasus_key_hash(req.key);
 
     auto new_callback = [user_callback = std::move(callback)](
@@ -809,6 +1003,104 @@ void pegasus_client_impl::async_incr(const std::string &hash_key,
                   partition_hash);
 }
 
+int pegasus_client_impl::multi_incr(const std::string &hash_key,
+                                    const std::vector<incr_item> &items,
+                                    std::vector<int64_t> &new_values,
+                                    int timeout_milliseconds,
+                                    internal_info *info,
+                                    bool blind)
+{
+    ::dsn::utils::notify_event op_completed;
+    int ret = -1;
+    auto callback = [&](int _err, std::vector<int64_t> &&_new_values, internal_info &&_info) {
+        ret = _err;
+        new_values = std::move(_new_values);
+        if (info != nullptr)
+            (*info) = std::move(_info);
+        op_completed.notify();
+    };
+    async_multi_incr(hash_key, items, std::move(callback), timeout_milliseconds, blind);
+    op_completed.wait();
+    return ret;
+}
+
+void pegasus_client_impl::async_multi_incr(const std::string &hash_key,
+                                           const std::vector<incr_item> &items,
+                                           async_multi_incr_callback_t &&callback,
+                                           int timeout_milliseconds,
+                                           bool blind)
+{
+    // check params
+    if (hash_key.size() == 0) {
+        derror("invalid hash key: hash key should not be empty for multi_incr");
+        if (callback != nullptr)
+            callback(PERR_INVALID_HASH_KEY, std::vector<int64_t>(), internal_info());
+        return;
+    }
+    if (hash_key.size() >= UINT16_MAX) {
+        derror("invalid hash key: hash key length should be less than UINT16_MAX, but %d",
+               (int)hash_key.size());
+        if (callback != nullptr)
+            callback(PERR_INVALID_HASH_KEY, std::vector<int64_t>(), internal_info());
+        return;
+    }
+    if (items.empty()) {
+        derror("invalid items: items should not be empty");
+        if (callback != nullptr)
+            callback(PERR_INVALID_ARGUMENT, std::vector<int64_t>(), internal_info());
+        return;
+    }
+
+    ::dsn::apps::multi_incr_request req;
+    req.hash_key = ::dsn::blob(hash_key.data(), 0, hash_key.size());
+    req.items.reserve(items.size());
+    for (const incr_item &item : items) {
+        if (item.ttl_seconds < -1) {
+            derror("invalid ttl seconds: should be no less than -1, but %d", item.ttl_seconds);
+            if (callback != nullptr)
+                callback(PERR_INVALID_ARGUMENT, std::vector<int64_t>(), internal_info());
+            return;
+        }
+        ::dsn::apps::incr_item req_item;
+        req_item.sort_key = ::dsn::blob(item.sort_key.data(), 0, item.sort_key.size());
+        req_item.increment = item.increment;
+        if (item.ttl_seconds <= 0)
+            req_item.expire_ts_seconds = item.ttl_seconds;
+        else
+            req_item.expire_ts_seconds = item.ttl_seconds + utils::epoch_now();
+        req.items.emplace_back(std::move(req_item));
+    }
+    if (blind)
+        req.__set_blind(true);
+
+    ::dsn::blob tmp_key;
+    pegasus_generate_key(tmp_key, req.hash_key, ::dsn::blob());
+    auto partition_hash = pegasus_key_hash(tmp_key);
+    auto new_callback = [user_callback = std::move(callback)](
+        ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+    {
+        if (user_callback == nullptr) {
+            return;
+        }
+        ::dsn::apps::multi_incr_response response;
+        internal_info info;
+        if (err == ::dsn::ERR_OK) {
+            ::dsn::unmarshall(resp, response);
+            info.app_id = response.app_id;
+            info.partition_index = response.partition_index;
+            info.decree = response.decree;
+            info.server = response.server;
+        }
+        int ret =
+            get_client_error(err == ERR_OK ? get_rocksdb_server_error(response.error) : int(err));
+        user_callback(ret, std::move(response.new_values), std::move(info));
+    };
+    _client->multi_incr(req,
+                        std::move(new_callback),
+                        std::chrono::milliseconds(timeout_milliseconds),
+                        partition_hash);
+}
+
 int pegasus_client_impl::check_and_set(const std::string &hash_key,
                                        const std::string &check_sort_key,
                                        cas_check_type check_type,
@@ -1244,6 +1536,145 @@ int pegasus_client_impl::get_unordered_scanners(int max_split_count,
     return ret;
 }
 
+int pegasus_client_impl::aggregate_partition(int partition_index,
+                                             const aggregate_options &options,
+                                             aggregate_results &results,
+                                             internal_info *info)
+{
+    ::dsn::utils::notify_event op_completed;
+    int ret = -1;
+    auto callback = [&](int err, aggregate_results &&_results, internal_info &&_info) {
+        ret = err;
+        if (info != nullptr)
+            (*info) = std::move(_info);
+        results = std::move(_results);
+        op_completed.notify();
+    };
+    async_aggregate_partition(partition_index, options, std::move(callback));
+    op_completed.wait();
+    return ret;
+}
+
+struct pegasus_client_impl::aggregate_context
+{
+    int partition_index;
+    aggregate_options options;
+    async_aggregate_partition_callback_t callback;
+    int64_t context_id;
+    aggregate_results results;
+};
+
+static void merge_size_histogram(pegasus_client::size_histogram &to,
+                                 const ::dsn::apps::size_histogram &from)
+{
+    pegasus_client::size_histogram h;
+    h.count = from.count;
+    h.sum = from.sum;
+    h.max = from.max;
+    h.buckets = from.buckets;
+    to.merge(h);
+}
+
+void pegasus_client_impl::async_aggregate_partition(int partition_index,
+                                                    const aggregate_options &options,
+                                                    async_aggregate_partition_callback_t &&callback)
+{
+    // check params
+    if (partition_index < 0) {
+        derror("invalid partition index: %d", partition_index);
+        if (callback != nullptr)
+            callback(PERR_INVALID_ARGUMENT, aggregate_results(), internal_info());
+        return;
+    }
+    if (options.batch_size <= 0) {
+        derror("invalid batch size: %d", options.batch_size);
+        if (callback != nullptr)
+            callback(PERR_INVALID_ARGUMENT, aggregate_results(), internal_info());
+        return;
+    }
+
+    auto ctx = std::make_shared<aggregate_context>();
+    ctx->partition_index = partition_index;
+    ctx->options = options;
+    ctx->callback = std::move(callback);
+    ctx->context_id = SCAN_CONTEXT_ID_NOT_EXIST;
+    aggregate_next(std::move(ctx));
+}
+
+void pegasus_client_impl::aggregate_next(std::shared_ptr<aggregate_context> ctx)
+{
+    const aggregate_options &o = ctx->options;
+    ::dsn::apps::aggregate_scan_request req;
+    req.context_id = ctx->context_id;
+    if (ctx->context_id == SCAN_CONTEXT_ID_NOT_EXIST) {
+        // iterate the whole partition, same as the key range of unordered scanners
+        static const char holder[] = {'\x00', '\x00', '\xFF', '\xFF'};
+        req.start_key = ::dsn::blob(holder, 0, 2);
+        req.stop_key = ::dsn::blob(holder, 2, 2);
+        req.start_inclusive = true;
+        req.stop_inclusive = false;
+        req.batch_size = o.batch_size;
+        req.hash_key_filter_type = (dsn::apps::filter_type::type)o.hash_key_filter_type;
+        req.hash_key_filter_pattern = ::dsn::blob(
+            o.hash_key_filter_pattern.data(), 0, o.hash_key_filter_pattern.size());
+        req.sort_key_filter_type = (dsn::apps::filter_type::type)o.sort_key_filter_type;
+        req.sort_key_filter_pattern = ::dsn::blob(
+            o.sort_key_filter_pattern.data(), 0, o.sort_key_filter_pattern.size());
+        req.value_filter_type = (dsn::apps::filter_type::type)o.value_filter_type;
+        req.value_filter_pattern =
+            ::dsn::blob(o.value_filter_pattern.data(), 0, o.value_filter_pattern.size());
+        req.stat_size = o.stat_size;
+        req.top_count = o.top_count;
+    }
+
+    _client->aggregate_scan(
+        req,
+        [this, ctx](::dsn::error_code err, dsn::message_ex *req, dsn::message_ex *resp) {
+            internal_info info;
+            ::dsn::apps::aggregate_scan_response response;
+            if (err == ::dsn::ERR_OK) {
+                ::unmarshall(resp, response);
+                info.app_id = response.app_id;
+                info.partition_index = response.partition_index;
+                info.server = response.server;
+            }
+            int ret = get_client_error(err == ERR_OK ? get_rocksdb_server_error(response.error)
+                                                     : int(err));
+            if (ret != PERR_OK) {
+                if (ctx->callback != nullptr)
+                    ctx->callback(ret, aggregate_results(), std::move(info));
+                return;
+            }
+
+            aggregate_results &results = ctx->results;
+            results.row_count += response.row_count;
+            // the server counts a hash key spanning several batches only once
+            results.hash_key_count += response.hash_key_count;
+            merge_size_histogram(results.hash_key_size, response.hash_key_size);
+            merge_size_histogram(results.sort_key_size, response.sort_key_size);
+            merge_size_histogram(results.value_size, response.value_size);
+            merge_size_histogram(results.row_size, response.row_size);
+
+            if (response.context_id >= SCAN_CONTEXT_ID_VALID_MIN) {
+                ctx->context_id = response.context_id;
+                aggregate_next(ctx);
+                return;
+            }
+
+            for (auto &row : response.top_rows) {
+                top_row r;
+                r.hash_key.assign(row.hash_key.data(), row.hash_key.length());
+                r.sort_key.assign(row.sort_key.data(), row.sort_key.length());
+                r.row_size = row.row_size;
+                results.top_rows.emplace_back(std::move(r));
+            }
+            if (ctx->callback != nullptr)
+                ctx->callback(PERR_OK, std::move(results), std::move(info));
+        },
+        std::chrono::milliseconds(o.timeout_ms),
+        ctx->partition_index);
+}
+
 void pegasus_client_impl::async_duplicate(dsn::apps::duplicate_rpc rpc,
                                           std::function<void(dsn::error_code)> &&callback,
                                           dsn::task_tracker *tracker)
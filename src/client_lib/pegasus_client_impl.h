@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <pegasus/client.h>
 #include <rrdb/rrdb.client.h>
@@ -95,6 +96,14 @@ public:
                                  int max_fetch_size = 1000000,
                                  int timeout_milliseconds = 5000) override;
 
+    virtual int batch_get(const std::vector<std::pair<std::string, std::string>> &keys,
+                          std::map<std::pair<std::string, std::string>, std::string> &values,
+                          int timeout_milliseconds = 5000) override;
+
+    virtual void async_batch_get(const std::vector<std::pair<std::string, std::string>> &keys,
+                                 async_batch_get_callback_t &&callback = nullptr,
+                                 int timeout_milliseconds = 5000) override;
+
     virtual int multi_get_sortkeys(const std::string &hashkey,
                                    std::set<std::string> &sortkeys,
                                    int max_fetch_count = 100,
@@ -145,14 +154,29 @@ public:
                      int64_t &new_value,
                      int timeout_milliseconds = 5000,
                      int ttl_seconds = 0,
-                     internal_info *info = nullptr) override;
+                     internal_info *info = nullptr,
+                     bool blind = false) override;
 
     virtual void async_incr(const std::string &hashkey,
                             const std::string &sortkey,
                             int64_t increment,
                             async_incr_callback_t &&callback = nullptr,
                             int timeout_milliseconds = 5000,
-                            int ttl_seconds = 0) override;
+                            int ttl_seconds = 0,
+                            bool blind = false) override;
+
+    virtual int multi_incr(const std::string &hashkey,
+                           const std::vector<incr_item> &items,
+                           std::vector<int64_t> &new_values,
+                           int timeout_milliseconds = 5000,
+                           internal_info *info = nullptr,
+                           bool blind = false) override;
+
+    virtual void async_multi_incr(const std::string &hashkey,
+                                  const std::vector<incr_item> &items,
+                                  async_multi_incr_callback_t &&callback = nullptr,
+                                  int timeout_milliseconds = 5000,
+                                  bool blind = false) override;
 
     virtual int check_and_set(const std::string &hash_key,
                               const std::string &check_sort_key,
@@ -221,6 +245,16 @@ public:
                                  const scan_options &options,
                                  async_get_unordered_scanners_callback_t &&callback) override;
 
+    virtual int aggregate_partition(int partition_index,
+                                    const aggregate_options &options,
+                                    aggregate_results &results,
+                                    internal_info *info = nullptr) override;
+
+    virtual void
+    async_aggregate_partition(int partition_index,
+                              const aggregate_options &options,
+                              async_aggregate_partition_callback_t &&callback) override;
+
     /// \internal
     /// This is an internal function for duplication.
     /// \see pegasus::server::pegasus_mutation_duplicator
@@ -308,11 +342,27 @@ private:
         }
     };
 
+private:
+    // query partition count of the app from meta server, the result is cached in
+    // _partition_count, and will be queried again after it is reset to 0
+    void async_query_partition_count(int timeout_milliseconds,
+                                     std::function<void(int /*error_code*/)> &&callback);
+
+    struct batch_get_context;
+    void batch_get_by_partition(const std::vector<std::pair<std::string, std::string>> &keys,
+                                async_batch_get_callback_t &&callback,
+                                int timeout_milliseconds);
+
+    struct aggregate_context;
+    // send the next aggregate_scan request of the partition, and merge the response into ctx
+    void aggregate_next(std::shared_ptr<aggregate_context> ctx);
+
 private:
     std::string _cluster_name;
     std::string _app_name;
     ::dsn::rpc_address _meta_server;
     ::dsn::apps::rrdb_client *_client;
+    std::atomic<int32_t> _partition_count{0};
 
     ///
     /// \brief _client_error_to_string
@@ -165,6 +165,7 @@ void pegasus_client_impl::pegasus_scanner_impl::_next_batch()
 {
     ::dsn::apps::scan_request req;
     req.context_id = _context;
+    req.deadline_ms = utils::unix_now_ms() + _options.timeout_ms;
 
     dassert(!_rpc_started, "");
     _rpc_started = true;
@@ -179,23 +180,36 @@ void pegasus_client_impl::pegasus_scanner_impl::_next_batch()
 void pegasus_client_impl::pegasus_scanner_impl::_start_scan()
 {
     ::dsn::apps::get_scanner_request req;
-    if (_kvs.empty()) {
-        req.start_key = _start_key;
-        req.start_inclusive = _options.start_inclusive;
-    } else {
-        req.start_key = _kvs.back().key;
-        req.start_inclusive = false;
-    }
+    req.start_key = _start_key;
+    req.start_inclusive = _options.start_inclusive;
     req.stop_key = _stop_key;
     req.stop_inclusive = _options.stop_inclusive;
+    if (!_kvs.empty()) {
+        // continue from the last key got, which is the new bound of the iterating direction
+        if (_options.reverse) {
+            req.stop_key = _kvs.back().key;
+            req.stop_inclusive = false;
+        } else {
+            req.start_key = _kvs.back().key;
+            req.start_inclusive = false;
+        }
+    }
     req.batch_size = _options.batch_size;
+    req.max_batch_bytes = _options.max_batch_bytes;
+    req.max_batch_time_us = _options.max_batch_time_us;
     req.hash_key_filter_type = (dsn::apps::filter_type::type)_options.hash_key_filter_type;
     req.hash_key_filter_pattern = ::dsn::blob(
         _options.hash_key_filter_pattern.data(), 0, _options.hash_key_filter_pattern.size());
     req.sort_key_filter_type = (dsn::apps::filter_type::type)_options.sort_key_filter_type;
     req.sort_key_filter_pattern = ::dsn::blob(
         _options.sort_key_filter_pattern.data(), 0, _options.sort_key_filter_pattern.size());
+    req.value_filter_type = (dsn::apps::filter_type::type)_options.value_filter_type;
+    req.value_filter_pattern = ::dsn::blob(
+        _options.value_filter_pattern.data(), 0, _options.value_filter_pattern.size());
     req.no_value = _options.no_value;
+    req.prefetch = _options.prefetch;
+    req.reverse = _options.reverse;
+    req.deadline_ms = utils::unix_now_ms() + _options.timeout_ms;
 
     dassert(!_rpc_started, "");
     _rpc_started = true;
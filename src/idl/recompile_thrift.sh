@@ -1,9 +1,19 @@
 #!/bin/bash
 # recommand thrift-0.9.3
+#
+# USAGE: ./recompile_thrift.sh [--check]
+#   --check  regenerate into a temporary dir and compare with the committed files, fail if
+#            they differ, which means the generated files are modified by hand or rrdb.thrift
+#            is changed without recompiling
 
 cd `dirname $0`
 DSN_ROOT=../../rdsn
 
+CHECK=false
+if [ "$1" == "--check" ]; then
+  CHECK=true
+fi
+
 if [ ! -d "$DSN_ROOT" ]; then
   echo "ERROR: DSN_ROOT not set"
   exit 1
@@ -14,9 +24,38 @@ rm -rf $TMP_DIR
 
 mkdir -p $TMP_DIR
 $DSN_ROOT/bin/Linux/thrift --gen cpp:moveable_types -out $TMP_DIR rrdb.thrift
+if [ $? -ne 0 ]; then
+  echo "ERROR: compile rrdb.thrift failed"
+  rm -rf $TMP_DIR
+  exit 1
+fi
+
+sed 's/#include "dsn_types.h"/#include <dsn\/service_api_cpp.h>/' $TMP_DIR/rrdb_types.h > $TMP_DIR/rrdb_types.h.out
+sed 's/#include "rrdb_types.h"/#include <rrdb\/rrdb_types.h>/' $TMP_DIR/rrdb_types.cpp > $TMP_DIR/rrdb_types.cpp.out
+mv $TMP_DIR/rrdb_types.h.out $TMP_DIR/rrdb_types.h
+mv $TMP_DIR/rrdb_types.cpp.out $TMP_DIR/rrdb_types.cpp
+# the same as scripts/format_files.sh, so that the committed files are kept formatted
+clang-format-3.9 -i -style=file $TMP_DIR/rrdb_types.h $TMP_DIR/rrdb_types.cpp
+
+if [ "$CHECK" == "true" ]; then
+  ret=0
+  if ! diff -q $TMP_DIR/rrdb_types.h ../include/rrdb/rrdb_types.h >/dev/null; then
+    echo "ERROR: src/include/rrdb/rrdb_types.h is not generated from rrdb.thrift"
+    ret=1
+  fi
+  if ! diff -q $TMP_DIR/rrdb_types.cpp ../base/rrdb_types.cpp >/dev/null; then
+    echo "ERROR: src/base/rrdb_types.cpp is not generated from rrdb.thrift"
+    ret=1
+  fi
+  rm -rf $TMP_DIR
+  if [ $ret -ne 0 ]; then
+    echo "please run src/idl/recompile_thrift.sh instead of modifying the generated files"
+  fi
+  exit $ret
+fi
 
-sed 's/#include "dsn_types.h"/#include <dsn\/service_api_cpp.h>/' $TMP_DIR/rrdb_types.h > ../include/rrdb/rrdb_types.h
-sed 's/#include "rrdb_types.h"/#include <rrdb\/rrdb_types.h>/' $TMP_DIR/rrdb_types.cpp > ../base/rrdb_types.cpp
+cp $TMP_DIR/rrdb_types.h ../include/rrdb/rrdb_types.h
+cp $TMP_DIR/rrdb_types.cpp ../base/rrdb_types.cpp
 
 rm -rf $TMP_DIR
 
@@ -133,6 +133,9 @@ struct multi_get_request
     10:filter_type  sort_key_filter_type;
     11:dsn.blob     sort_key_filter_pattern;
     12:bool         reverse; // if search in reverse direction
+    13:filter_type  value_filter_type;
+    14:dsn.blob     value_filter_pattern;
+    15:i64          deadline_ms; // client deadline in milliseconds since unix epoch, <= 0 means no deadline
 }
 
 struct multi_get_response
@@ -142,6 +145,38 @@ struct multi_get_response
     3:i32           app_id;
     4:i32           partition_index;
     6:string        server;
+
+    // hints on the reason why this request failed or was incomplete, such as being past
+    // the client deadline.
+    7:optional string error_hint;
+}
+
+struct full_key
+{
+    1:dsn.blob      hash_key;
+    2:dsn.blob      sort_key;
+}
+
+// all keys should belong to the same partition
+struct batch_get_request
+{
+    1:list<full_key> keys;
+}
+
+struct full_data
+{
+    1:dsn.blob      hash_key;
+    2:dsn.blob      sort_key;
+    3:dsn.blob      value;
+}
+
+struct batch_get_response
+{
+    1:i32           error;
+    2:list<full_data> data; // only contains the keys found, in order of request keys
+    3:i32           app_id;
+    4:i32           partition_index;
+    6:string        server;
 }
 
 struct incr_request
@@ -151,6 +186,9 @@ struct incr_request
     3:i32           expire_ts_seconds; // 0 means keep original ttl
                                        // >0 means reset to new ttl
                                        // <0 means reset to no ttl
+    // if true, the increment is written blindly as a merge operand instead of reading the
+    // old value, and new_value of the response is always 0.
+    4:optional bool blind;
 }
 
 struct incr_response
@@ -163,6 +201,31 @@ struct incr_response
     6:string        server;
 }
 
+struct incr_item
+{
+    1:dsn.blob      sort_key;
+    2:i64           increment;
+    3:i32           expire_ts_seconds; // the same as incr_request.expire_ts_seconds
+}
+
+// the items are applied atomically in order, a sort key may appear more than once
+struct multi_incr_request
+{
+    1:dsn.blob      hash_key;
+    2:list<incr_item> items;
+    3:optional bool blind; // the same as incr_request.blind, new_values are always 0
+}
+
+struct multi_incr_response
+{
+    1:i32           error;
+    2:list<i64>     new_values; // in order of request items
+    3:i32           app_id;
+    4:i32           partition_index;
+    5:i64           decree;
+    6:string        server;
+}
+
 struct check_and_set_request
 {
     1:dsn.blob       hash_key;
@@ -234,11 +297,19 @@ struct get_scanner_request
     8:dsn.blob     hash_key_filter_pattern;
     9:filter_type  sort_key_filter_type;
     10:dsn.blob    sort_key_filter_pattern;
+    11:filter_type value_filter_type;
+    12:dsn.blob    value_filter_pattern;
+    13:i64         max_batch_bytes; // max total size of k-v returned in one batch, <= 0 means no limit
+    14:i64         max_batch_time_us; // max time spent on iterating one batch, <= 0 means no limit
+    15:bool        prefetch; // if iterate the next batch in advance after replying one batch
+    16:bool        reverse; // if iterate from stop_key to start_key in descending order
+    17:i64         deadline_ms; // client deadline in milliseconds since unix epoch, <= 0 means no deadline
 }
 
 struct scan_request
 {
     1:i64           context_id;
+    2:i64           deadline_ms; // client deadline in milliseconds since unix epoch, <= 0 means no deadline
 }
 
 struct scan_response
@@ -249,6 +320,73 @@ struct scan_response
     4:i32           app_id;
     5:i32           partition_index;
     6:string        server;
+
+    // hints on the reason why this request failed or was incomplete, such as being past
+    // the client deadline.
+    7:optional string error_hint;
+}
+
+// sizes are counted into buckets by their bit width, that is, buckets[0] is the count
+// of size 0, and buckets[i] (i > 0) is the count of sizes in range [2^(i-1), 2^i).
+struct size_histogram
+{
+    1:i64           count;
+    2:i64           sum;
+    3:i64           max;
+    4:list<i64>     buckets;
+}
+
+struct row_size_item
+{
+    1:dsn.blob      hash_key;
+    2:dsn.blob      sort_key;
+    3:i64           row_size;
+}
+
+struct aggregate_scan_request
+{
+    1:dsn.blob     start_key;
+    2:dsn.blob     stop_key;
+    3:bool         start_inclusive;
+    4:bool         stop_inclusive;
+    5:i32          batch_size; // max count of records iterated by one rpc
+    6:filter_type  hash_key_filter_type;
+    7:dsn.blob     hash_key_filter_pattern;
+    8:filter_type  sort_key_filter_type;
+    9:dsn.blob     sort_key_filter_pattern;
+    10:filter_type value_filter_type;
+    11:dsn.blob    value_filter_pattern;
+    12:bool        stat_size; // if collect size histograms and top rows
+    13:i32         top_count; // count of the largest rows to return, only valid if stat_size
+    14:i64         context_id; // SCAN_CONTEXT_ID_NOT_EXIST means start a new aggregation, else
+                               // continue the aggregation with the context_id of last response,
+                               // in which case only batch_size is used
+}
+
+// statistics are the increment of this batch, except that top_rows is only returned
+// along with the last batch
+struct aggregate_scan_response
+{
+    1:i32           error;
+    2:i64           row_count;
+    3:i64           hash_key_count;
+    4:size_histogram hash_key_size;
+    5:size_histogram sort_key_size;
+    6:size_histogram value_size;
+    7:size_histogram row_size;
+    8:list<row_size_item> top_rows;
+    9:i64           context_id;
+    10:i32          app_id;
+    11:i32          partition_index;
+    12:string       server;
+}
+
+// One write carried by duplicate_request.entries.
+struct duplicate_entry
+{
+    1: optional i64 timestamp
+    2: optional dsn.task_code task_code
+    3: optional dsn.blob raw_message
 }
 
 struct duplicate_request
@@ -267,6 +405,10 @@ struct duplicate_request
 
     // Whether to compare the timetag of old value with the new write's.
     5: optional bool verify_timetag
+
+    // The writes of the same hash, which are applied in order in one write batch.
+    // If set, field 1-3 are ignored.
+    6: optional list<duplicate_entry> entries
 }
 
 struct duplicate_response
@@ -277,6 +419,22 @@ struct duplicate_response
     2: optional string error_hint;
 }
 
+// Switches whether the sortkey_count metadata is maintained by the write path. It is sent by
+// the primary to itself when 'replica.sortkey_count_mode' changes, and applied as a write, so
+// that all the replicas switch at the same decree.
+struct maintain_sortkey_count_request
+{
+    1: bool maintained;
+}
+
+// Ingests the sst files in `dir` built by pegasus_sst_builder. It is sent by the primary to
+// itself when 'replica.bulk_ingest.dir' changes, and applied as a write, so that all the
+// replicas ingest the files at the same decree.
+struct bulk_ingest_request
+{
+    1: string dir;
+}
+
 service rrdb
 {
     update_response put(1:update_request update);
@@ -284,15 +442,19 @@ service rrdb
     update_response remove(1:dsn.blob key);
     multi_remove_response multi_remove(1:multi_remove_request request);
     incr_response incr(1:incr_request request);
+    multi_incr_response multi_incr(1:multi_incr_request request);
     check_and_set_response check_and_set(1:check_and_set_request request);
     check_and_mutate_response check_and_mutate(1:check_and_mutate_request request);
     read_response get(1:dsn.blob key);
     multi_get_response multi_get(1:multi_get_request request);
+    batch_get_response batch_get(1:batch_get_request request);
     count_response sortkey_count(1:dsn.blob hash_key);
     ttl_response ttl(1:dsn.blob key);
 
     scan_response get_scanner(1:get_scanner_request request);
     scan_response scan(1:scan_request request);
     oneway void clear_scanner(1:i64 context_id);
+
+    aggregate_scan_response aggregate_scan(1:aggregate_scan_request request);
 }
 
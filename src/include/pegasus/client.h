@@ -79,12 +79,15 @@ public:
         bool stop_inclusive;
         filter_type sort_key_filter_type;
         std::string sort_key_filter_pattern;
+        filter_type value_filter_type; // filter on server side, FT_MATCH_EXACT is not supported
+        std::string value_filter_pattern;
         bool no_value; // only fetch hash_key and sort_key, but not fetch value
         bool reverse;  // if search in reverse direction
         multi_get_options()
             : start_inclusive(true),
               stop_inclusive(false),
               sort_key_filter_type(FT_NO_FILTER),
+              value_filter_type(FT_NO_FILTER),
               no_value(false),
               reverse(false)
         {
@@ -94,6 +97,8 @@ public:
               stop_inclusive(o.stop_inclusive),
               sort_key_filter_type(o.sort_key_filter_type),
               sort_key_filter_pattern(o.sort_key_filter_pattern),
+              value_filter_type(o.value_filter_type),
+              value_filter_pattern(o.value_filter_pattern),
               no_value(o.no_value),
               reverse(o.reverse)
         {
@@ -130,6 +135,18 @@ public:
         CT_VALUE_INT_GREATER = 17           // int compare: value > operand
     };
 
+    struct incr_item
+    {
+        std::string sort_key;
+        int64_t increment;
+        int ttl_seconds; // the same as `ttl_seconds' of incr().
+        incr_item() : increment(0), ttl_seconds(0) {}
+        incr_item(const std::string &sort_key, int64_t increment, int ttl_seconds = 0)
+            : sort_key(sort_key), increment(increment), ttl_seconds(ttl_seconds)
+        {
+        }
+    };
+
     struct check_and_set_options
     {
         int set_value_ttl_seconds; // time to live in seconds of the set value, 0 means no ttl.
@@ -227,39 +244,137 @@ public:
 
     struct scan_options
     {
-        int timeout_ms;       // RPC call timeout param, in milliseconds
-        int batch_size;       // max k-v count one RPC call
-        bool start_inclusive; // will be ingored when get_unordered_scanners()
-        bool stop_inclusive;  // will be ingored when get_unordered_scanners()
+        int timeout_ms;            // RPC call timeout param, in milliseconds
+        int batch_size;            // max k-v count one RPC call
+        int64_t max_batch_bytes;   // max k-v bytes one RPC call, <= 0 means no limit
+        int64_t max_batch_time_us; // max server iterating time one RPC call, <= 0 means no limit
+        bool start_inclusive;      // will be ingored when get_unordered_scanners()
+        bool stop_inclusive;       // will be ingored when get_unordered_scanners()
         filter_type hash_key_filter_type;
         std::string hash_key_filter_pattern;
         filter_type sort_key_filter_type;
         std::string sort_key_filter_pattern;
+        filter_type value_filter_type; // filter on server side, FT_MATCH_EXACT is not supported
+        std::string value_filter_pattern;
         bool no_value; // only fetch hash_key and sort_key, but not fetch value
+        bool prefetch; // let server iterate the next batch in advance, useful for long scans
+        bool reverse;  // iterate from stop key to start key, that is, in descending order
         scan_options()
             : timeout_ms(5000),
               batch_size(100),
+              max_batch_bytes(0),
+              max_batch_time_us(0),
               start_inclusive(true),
               stop_inclusive(false),
               hash_key_filter_type(FT_NO_FILTER),
               sort_key_filter_type(FT_NO_FILTER),
-              no_value(false)
+              value_filter_type(FT_NO_FILTER),
+              no_value(false),
+              prefetch(false),
+              reverse(false)
         {
         }
         scan_options(const scan_options &o)
             : timeout_ms(o.timeout_ms),
               batch_size(o.batch_size),
+              max_batch_bytes(o.max_batch_bytes),
+              max_batch_time_us(o.max_batch_time_us),
               start_inclusive(o.start_inclusive),
               stop_inclusive(o.stop_inclusive),
               hash_key_filter_type(o.hash_key_filter_type),
               hash_key_filter_pattern(o.hash_key_filter_pattern),
               sort_key_filter_type(o.sort_key_filter_type),
               sort_key_filter_pattern(o.sort_key_filter_pattern),
-              no_value(o.no_value)
+              value_filter_type(o.value_filter_type),
+              value_filter_pattern(o.value_filter_pattern),
+              no_value(o.no_value),
+              prefetch(o.prefetch),
+              reverse(o.reverse)
         {
         }
     };
 
+    struct aggregate_options
+    {
+        int timeout_ms; // RPC call timeout param, in milliseconds
+        int batch_size; // max k-v count iterated on server side in one RPC call
+        filter_type hash_key_filter_type;
+        std::string hash_key_filter_pattern;
+        filter_type sort_key_filter_type;
+        std::string sort_key_filter_pattern;
+        filter_type value_filter_type; // FT_MATCH_EXACT is not supported
+        std::string value_filter_pattern;
+        bool stat_size; // if collect the size histograms and top rows
+        int top_count;  // count of the largest rows to return, used only when stat_size is true
+        aggregate_options()
+            : timeout_ms(5000),
+              batch_size(1000),
+              hash_key_filter_type(FT_NO_FILTER),
+              sort_key_filter_type(FT_NO_FILTER),
+              value_filter_type(FT_NO_FILTER),
+              stat_size(false),
+              top_count(0)
+        {
+        }
+        aggregate_options(const aggregate_options &o)
+            : timeout_ms(o.timeout_ms),
+              batch_size(o.batch_size),
+              hash_key_filter_type(o.hash_key_filter_type),
+              hash_key_filter_pattern(o.hash_key_filter_pattern),
+              sort_key_filter_type(o.sort_key_filter_type),
+              sort_key_filter_pattern(o.sort_key_filter_pattern),
+              value_filter_type(o.value_filter_type),
+              value_filter_pattern(o.value_filter_pattern),
+              stat_size(o.stat_size),
+              top_count(o.top_count)
+        {
+        }
+    };
+
+    struct size_histogram
+    {
+        int64_t count;
+        int64_t sum;
+        int64_t max;
+        // buckets[i] is the count of sizes in [2^(i-1), 2^i), buckets[0] is the count of 0
+        std::vector<int64_t> buckets;
+        size_histogram() : count(0), sum(0), max(0) {}
+
+        // add the sizes counted by another histogram into this one
+        void merge(const size_histogram &o)
+        {
+            count += o.count;
+            sum += o.sum;
+            if (max < o.max)
+                max = o.max;
+            if (buckets.size() < o.buckets.size())
+                buckets.resize(o.buckets.size(), 0);
+            for (size_t i = 0; i < o.buckets.size(); i++)
+                buckets[i] += o.buckets[i];
+        }
+    };
+
+    struct top_row
+    {
+        std::string hash_key;
+        std::string sort_key;
+        int64_t row_size;
+        top_row() : row_size(0) {}
+    };
+
+    struct aggregate_results
+    {
+        int64_t row_count;
+        int64_t hash_key_count;
+        // the histograms and top_rows are filled only when stat_size is set in options
+        size_histogram hash_key_size;
+        size_histogram sort_key_size;
+        size_histogram value_size;
+        size_histogram row_size;
+        std::vector<top_row> top_rows; // in descending order of row_size
+        aggregate_results() : row_count(0), hash_key_count(0) {}
+    };
+
     class pegasus_scanner;
 
     // define callback function types for asynchronous operations.
@@ -273,6 +388,10 @@ public:
                                std::map<std::string, std::string> && /*values*/,
                                internal_info && /*info*/)>
         async_multi_get_callback_t;
+    typedef std::function<void(
+        int /*error_code*/,
+        std::map<std::pair<std::string, std::string>, std::string> && /*values*/)>
+        async_batch_get_callback_t;
     typedef std::function<void(
         int /*error_code*/, std::set<std::string> && /*sortkeys*/, internal_info && /*info*/)>
         async_multi_get_sortkeys_callback_t;
@@ -283,6 +402,9 @@ public:
     typedef std::function<void(
         int /*error_code*/, int64_t /*new_value*/, internal_info && /*info*/)>
         async_incr_callback_t;
+    typedef std::function<void(
+        int /*error_code*/, std::vector<int64_t> && /*new_values*/, internal_info && /*info*/)>
+        async_multi_incr_callback_t;
     typedef std::function<void(
         int /*error_code*/, check_and_set_results && /*results*/, internal_info && /*info*/)>
         async_check_and_set_callback_t;
@@ -299,6 +421,9 @@ public:
         async_get_scanner_callback_t;
     typedef std::function<void(int /*error_code*/, std::vector<pegasus_scanner *> && /*scanners*/)>
         async_get_unordered_scanners_callback_t;
+    typedef std::function<void(
+        int /*error_code*/, aggregate_results && /*results*/, internal_info && /*info*/)>
+        async_aggregate_partition_callback_t;
 
     class abstract_pegasus_scanner
     {
@@ -642,6 +767,44 @@ public:
                                  int max_fetch_size = 1000000,
                                  int timeout_milliseconds = 5000) = 0;
 
+    ///
+    /// \brief batch_get
+    ///     get values of multiple keys from the cluster, the keys may have different hash keys.
+    ///     keys are grouped by partition, and one request is sent to each partition in parallel.
+    /// \param keys
+    /// the <hashkey,sortkey> pairs to get, hashkey should not be empty.
+    /// \param values
+    /// the returned <<hashkey,sortkey>,value> pairs will be put into it.
+    /// if data is not found for some <hashkey,sortkey>, then it will not appear in the map.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    /// returns PERR_OK if fetch done, even no data is returned.
+    /// if any partition fails, the error of it is returned and values will be empty.
+    ///
+    virtual int batch_get(const std::vector<std::pair<std::string, std::string>> &keys,
+                          std::map<std::pair<std::string, std::string>, std::string> &values,
+                          int timeout_milliseconds = 5000) = 0;
+
+    ///
+    /// \brief asynchronous batch_get
+    ///     get values of multiple keys from the cluster, the keys may have different hash keys.
+    ///     will not be blocked, return immediately.
+    /// \param keys
+    /// the <hashkey,sortkey> pairs to get, hashkey should not be empty.
+    /// \param callback
+    /// the callback function will be invoked after all partitions finished or error occurred.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// void.
+    ///
+    virtual void async_batch_get(const std::vector<std::pair<std::string, std::string>> &keys,
+                                 async_batch_get_callback_t &&callback = nullptr,
+                                 int timeout_milliseconds = 5000) = 0;
+
     ///
     /// \brief multi_get_sortkeys
     ///     get multiple sort keys by hash key from the cluster.
@@ -842,6 +1005,12 @@ public:
     /// if wait longer than this value, will return time out error
     /// \param ttl_seconds
     /// time to live of this value.
+    /// \param blind
+    /// if true, the increment is written without reading the old value, which is much cheaper
+    /// for write-heavy counters, and is folded into the value on reads and compactions. the
+    /// new value is not returned, `new_value' is always 0. the increment is ignored instead
+    /// of being rejected if the old value is not an integer or the new value is out of range,
+    /// and the table level default ttl is applied by compaction instead of by incr.
     /// \return
     /// int, the error indicates whether or not the operation is succeeded.
     /// this error can be converted to a string using get_error_string().
@@ -852,7 +1021,8 @@ public:
                      int64_t &new_value,
                      int timeout_milliseconds = 5000,
                      int ttl_seconds = 0,
-                     internal_info *info = nullptr) = 0;
+                     internal_info *info = nullptr,
+                     bool blind = false) = 0;
 
     ///
     /// \brief asynchronous incr
@@ -884,6 +1054,8 @@ public:
     /// if wait longer than this value, will return time out error
     /// \param ttl_seconds
     /// time to live of this value.
+    /// \param blind
+    /// the same as `blind' of incr().
     /// \return
     /// void.
     ///
@@ -892,7 +1064,64 @@ public:
                             int64_t increment,
                             async_incr_callback_t &&callback = nullptr,
                             int timeout_milliseconds = 5000,
-                            int ttl_seconds = 0) = 0;
+                            int ttl_seconds = 0,
+                            bool blind = false) = 0;
+
+    ///
+    /// \brief multi_incr
+    ///     atomically increment values of multiple sort keys under one hash key, in a single
+    ///     write of the cluster, which is much cheaper than calling incr() for each of them.
+    ///
+    ///     the items are applied in order, with the same semantic as incr(), and a sort key
+    ///     may appear more than once. if any of them fails, then none of them is applied, and
+    ///     PERR_INVALID_ARGUMENT is returned.
+    ///
+    /// \param hashkey
+    /// used to decide which partition to put this k-v
+    /// \param items
+    /// the sort keys and the increments, should not be empty.
+    /// \param new_values
+    /// out param to return the new values if increment succeed, in order of `items'.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \param blind
+    /// the same as `blind' of incr(), `new_values' are always 0 if true.
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    ///
+    virtual int multi_incr(const std::string &hashkey,
+                           const std::vector<incr_item> &items,
+                           std::vector<int64_t> &new_values,
+                           int timeout_milliseconds = 5000,
+                           internal_info *info = nullptr,
+                           bool blind = false) = 0;
+
+    ///
+    /// \brief asynchronous multi_incr
+    ///     atomically increment values of multiple sort keys under one hash key.
+    ///     will not be blocked, return immediately.
+    ///
+    ///     the semantic is the same as multi_incr().
+    ///
+    /// \param hashkey
+    /// used to decide which partition to put this k-v
+    /// \param items
+    /// the sort keys and the increments, should not be empty.
+    /// \param callback
+    /// the callback function will be invoked after operation finished or error occurred.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \param blind
+    /// the same as `blind' of incr().
+    /// \return
+    /// void.
+    ///
+    virtual void async_multi_incr(const std::string &hashkey,
+                                  const std::vector<incr_item> &items,
+                                  async_multi_incr_callback_t &&callback = nullptr,
+                                  int timeout_milliseconds = 5000,
+                                  bool blind = false) = 0;
 
     ///
     /// \brief check_and_set
@@ -1138,6 +1367,40 @@ public:
                                  const scan_options &options,
                                  async_get_unordered_scanners_callback_t &&callback) = 0;
 
+    ///
+    /// \brief aggregate statistics of all k-v in one partition on server side,
+    ///        without transferring the k-v to client
+    /// \param partition_index
+    /// the index of partition to aggregate, should be in [0, partition_count)
+    /// \param options
+    /// which used to indicate aggregate options, like filters and whether to stat size
+    /// \param results
+    /// out param, the statistics of this partition
+    /// \param info
+    /// the internal information of the partition
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string()
+    ///
+    virtual int aggregate_partition(int partition_index,
+                                    const aggregate_options &options,
+                                    aggregate_results &results,
+                                    internal_info *info = nullptr) = 0;
+
+    ///
+    /// \brief asynchronous aggregate statistics of all k-v in one partition on server side
+    /// \param partition_index
+    /// the index of partition to aggregate, should be in [0, partition_count)
+    /// \param options
+    /// which used to indicate aggregate options, like filters and whether to stat size
+    /// \param callback
+    /// the callback function will be invoked after the whole partition is aggregated or error
+    /// occurred
+    ///
+    virtual void async_aggregate_partition(int partition_index,
+                                           const aggregate_options &options,
+                                           async_aggregate_partition_callback_t &&callback) = 0;
+
     ///
     /// \brief get_error_string
     /// get error string
@@ -162,6 +162,32 @@ public:
                                   reply_thread_hash);
     }
 
+    // ---------- call RPC_RRDB_RRDB_MULTI_INCR ------------
+    // - synchronous
+    std::pair<::dsn::error_code, multi_incr_response> multi_incr_sync(
+        const multi_incr_request &args, std::chrono::milliseconds timeout, uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<multi_incr_response>(_resolver->call_op(
+            RPC_RRDB_RRDB_MULTI_INCR, args, &_tracker, empty_rpc_handler, timeout, partition_hash));
+    }
+
+    // - asynchronous with on-stack multi_incr_request and multi_incr_response
+    template <typename TCallback>
+    ::dsn::task_ptr multi_incr(const multi_incr_request &args,
+                               TCallback &&callback,
+                               std::chrono::milliseconds timeout,
+                               uint64_t request_partition_hash,
+                               int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_MULTI_INCR,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
     // ---------- call RPC_RRDB_RRDB_CHECK_AND_SET ------------
     // - synchronous
     std::pair<::dsn::error_code, check_and_set_response>
@@ -280,6 +306,32 @@ public:
                                   reply_thread_hash);
     }
 
+    // ---------- call RPC_RRDB_RRDB_BATCH_GET ------------
+    // - synchronous
+    std::pair<::dsn::error_code, batch_get_response> batch_get_sync(
+        const batch_get_request &args, std::chrono::milliseconds timeout, uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<batch_get_response>(_resolver->call_op(
+            RPC_RRDB_RRDB_BATCH_GET, args, &_tracker, empty_rpc_handler, timeout, partition_hash));
+    }
+
+    // - asynchronous with on-stack batch_get_request and batch_get_response
+    template <typename TCallback>
+    ::dsn::task_ptr batch_get(const batch_get_request &args,
+                              TCallback &&callback,
+                              std::chrono::milliseconds timeout,
+                              uint64_t request_partition_hash,
+                              int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_BATCH_GET,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
     // ---------- call RPC_RRDB_RRDB_SORTKEY_COUNT ------------
     // - synchronous
     std::pair<::dsn::error_code, count_response> sortkey_count_sync(
@@ -408,6 +460,39 @@ public:
                            partition_hash);
     }
 
+    // ---------- call RPC_RRDB_RRDB_AGGREGATE_SCAN ------------
+    // - synchronous
+    std::pair<::dsn::error_code, aggregate_scan_response>
+    aggregate_scan_sync(const aggregate_scan_request &args,
+                        std::chrono::milliseconds timeout,
+                        uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<aggregate_scan_response>(
+            _resolver->call_op(RPC_RRDB_RRDB_AGGREGATE_SCAN,
+                               args,
+                               &_tracker,
+                               empty_rpc_handler,
+                               timeout,
+                               partition_hash));
+    }
+
+    // - asynchronous with on-stack aggregate_scan_request and aggregate_scan_response
+    template <typename TCallback>
+    ::dsn::task_ptr aggregate_scan(const aggregate_scan_request &args,
+                                   TCallback &&callback,
+                                   std::chrono::milliseconds timeout,
+                                   uint64_t request_partition_hash,
+                                   int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_AGGREGATE_SCAN,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
     // ---------- call RPC_RRDB_RRDB_DUPLICATE ------------
 
     // - asynchronous with on-stack duplicate_request and duplicate_response
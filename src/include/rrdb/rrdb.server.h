@@ -57,6 +57,14 @@ protected:
         incr_response resp;
         reply(resp);
     }
+    // RPC_RRDB_RRDB_MULTI_INCR
+    virtual void on_multi_incr(const multi_incr_request &args,
+                               ::dsn::rpc_replier<multi_incr_response> &reply)
+    {
+        std::cout << "... exec RPC_RRDB_RRDB_MULTI_INCR ... (not implemented) " << std::endl;
+        multi_incr_response resp;
+        reply(resp);
+    }
     // RPC_RRDB_RRDB_CHECK_AND_SET
     virtual void on_check_and_set(const check_and_set_request &args,
                                   ::dsn::rpc_replier<check_and_set_response> &reply)
@@ -88,6 +96,14 @@ protected:
         multi_get_response resp;
         reply(resp);
     }
+    // RPC_RRDB_RRDB_BATCH_GET
+    virtual void on_batch_get(const batch_get_request &args,
+                              ::dsn::rpc_replier<batch_get_response> &reply)
+    {
+        std::cout << "... exec RPC_RRDB_RRDB_BATCH_GET ... (not implemented) " << std::endl;
+        batch_get_response resp;
+        reply(resp);
+    }
     // RPC_RRDB_RRDB_SORTKEY_COUNT
     virtual void on_sortkey_count(const ::dsn::blob &args,
                                   ::dsn::rpc_replier<count_response> &reply)
@@ -123,6 +139,14 @@ protected:
     {
         std::cout << "... exec RPC_RRDB_RRDB_CLEAR_SCANNER ... (not implemented) " << std::endl;
     }
+    // RPC_RRDB_RRDB_AGGREGATE_SCAN
+    virtual void on_aggregate_scan(const aggregate_scan_request &args,
+                                   ::dsn::rpc_replier<aggregate_scan_response> &reply)
+    {
+        std::cout << "... exec RPC_RRDB_RRDB_AGGREGATE_SCAN ... (not implemented) " << std::endl;
+        aggregate_scan_response resp;
+        reply(resp);
+    }
 
     static void register_rpc_handlers()
     {
@@ -130,16 +154,20 @@ protected:
         register_async_rpc_handler(RPC_RRDB_RRDB_MULTI_PUT, "multi_put", on_multi_put);
         register_async_rpc_handler(RPC_RRDB_RRDB_REMOVE, "remove", on_multi_remove);
         register_async_rpc_handler(RPC_RRDB_RRDB_INCR, "incr", on_incr);
+        register_async_rpc_handler(RPC_RRDB_RRDB_MULTI_INCR, "multi_incr", on_multi_incr);
         register_async_rpc_handler(RPC_RRDB_RRDB_CHECK_AND_SET, "check_and_set", on_check_and_set);
         register_async_rpc_handler(
             RPC_RRDB_RRDB_CHECK_AND_MUTATE, "check_and_mutate", on_check_and_mutate);
         register_async_rpc_handler(RPC_RRDB_RRDB_GET, "get", on_get);
         register_async_rpc_handler(RPC_RRDB_RRDB_MULTI_GET, "multi_get", on_multi_get);
+        register_async_rpc_handler(RPC_RRDB_RRDB_BATCH_GET, "batch_get", on_batch_get);
         register_async_rpc_handler(RPC_RRDB_RRDB_SORTKEY_COUNT, "sortkey_count", on_sortkey_count);
         register_async_rpc_handler(RPC_RRDB_RRDB_TTL, "ttl", on_ttl);
         register_async_rpc_handler(RPC_RRDB_RRDB_GET_SCANNER, "get_scanner", on_get_scanner);
         register_async_rpc_handler(RPC_RRDB_RRDB_SCAN, "scan", on_scan);
         register_async_rpc_handler(RPC_RRDB_RRDB_CLEAR_SCANNER, "clear_scanner", on_clear_scanner);
+        register_async_rpc_handler(
+            RPC_RRDB_RRDB_AGGREGATE_SCAN, "aggregate_scan", on_aggregate_scan);
     }
 
 private:
@@ -172,6 +200,12 @@ private:
     {
         svc->on_incr(args, reply);
     }
+    static void on_multi_incr(rrdb_service *svc,
+                              const multi_incr_request &args,
+                              ::dsn::rpc_replier<multi_incr_response> &reply)
+    {
+        svc->on_multi_incr(args, reply);
+    }
     static void on_check_and_set(rrdb_service *svc,
                                  const check_and_set_request &args,
                                  ::dsn::rpc_replier<check_and_set_response> &reply)
@@ -195,6 +229,12 @@ private:
     {
         svc->on_multi_get(args, reply);
     }
+    static void on_batch_get(rrdb_service *svc,
+                             const batch_get_request &args,
+                             ::dsn::rpc_replier<batch_get_response> &reply)
+    {
+        svc->on_batch_get(args, reply);
+    }
     static void on_sortkey_count(rrdb_service *svc,
                                  const ::dsn::blob &args,
                                  ::dsn::rpc_replier<count_response> &reply)
@@ -221,6 +261,12 @@ private:
     {
         svc->on_clear_scanner(args);
     }
+    static void on_aggregate_scan(rrdb_service *svc,
+                                  const aggregate_scan_request &args,
+                                  ::dsn::rpc_replier<aggregate_scan_response> &reply)
+    {
+        svc->on_aggregate_scan(args, reply);
+    }
 };
 } // namespace apps
 } // namespace dsn
@@ -93,10 +93,24 @@ class multi_get_request;
 
 class multi_get_response;
 
+class full_key;
+
+class batch_get_request;
+
+class full_data;
+
+class batch_get_response;
+
 class incr_request;
 
 class incr_response;
 
+class incr_item;
+
+class multi_incr_request;
+
+class multi_incr_response;
+
 class check_and_set_request;
 
 class check_and_set_response;
@@ -113,10 +127,24 @@ class scan_request;
 
 class scan_response;
 
+class size_histogram;
+
+class row_size_item;
+
+class aggregate_scan_request;
+
+class aggregate_scan_response;
+
+class duplicate_entry;
+
 class duplicate_request;
 
 class duplicate_response;
 
+class maintain_sortkey_count_request;
+
+class bulk_ingest_request;
+
 typedef struct _update_request__isset
 {
     _update_request__isset() : key(false), value(false), expire_ts_seconds(false) {}
@@ -735,7 +763,10 @@ typedef struct _multi_get_request__isset
           stop_inclusive(false),
           sort_key_filter_type(false),
           sort_key_filter_pattern(false),
-          reverse(false)
+          reverse(false),
+          value_filter_type(false),
+          value_filter_pattern(false),
+          deadline_ms(false)
     {
     }
     bool hash_key : 1;
@@ -750,6 +781,9 @@ typedef struct _multi_get_request__isset
     bool sort_key_filter_type : 1;
     bool sort_key_filter_pattern : 1;
     bool reverse : 1;
+    bool value_filter_type : 1;
+    bool value_filter_pattern : 1;
+    bool deadline_ms : 1;
 } _multi_get_request__isset;
 
 class multi_get_request
@@ -766,7 +800,9 @@ public:
           start_inclusive(0),
           stop_inclusive(0),
           sort_key_filter_type((filter_type::type)0),
-          reverse(0)
+          reverse(0),
+          value_filter_type((filter_type::type)0),
+          deadline_ms(0)
     {
     }
 
@@ -783,6 +819,9 @@ public:
     filter_type::type sort_key_filter_type;
     ::dsn::blob sort_key_filter_pattern;
     bool reverse;
+    filter_type::type value_filter_type;
+    ::dsn::blob value_filter_pattern;
+    int64_t deadline_ms;
 
     _multi_get_request__isset __isset;
 
@@ -810,6 +849,12 @@ public:
 
     void __set_reverse(const bool val);
 
+    void __set_value_filter_type(const filter_type::type val);
+
+    void __set_value_filter_pattern(const ::dsn::blob &val);
+
+    void __set_deadline_ms(const int64_t val);
+
     bool operator==(const multi_get_request &rhs) const
     {
         if (!(hash_key == rhs.hash_key))
@@ -836,6 +881,12 @@ public:
             return false;
         if (!(reverse == rhs.reverse))
             return false;
+        if (!(value_filter_type == rhs.value_filter_type))
+            return false;
+        if (!(value_filter_pattern == rhs.value_filter_pattern))
+            return false;
+        if (!(deadline_ms == rhs.deadline_ms))
+            return false;
         return true;
     }
     bool operator!=(const multi_get_request &rhs) const { return !(*this == rhs); }
@@ -859,7 +910,12 @@ inline std::ostream &operator<<(std::ostream &out, const multi_get_request &obj)
 typedef struct _multi_get_response__isset
 {
     _multi_get_response__isset()
-        : error(false), kvs(false), app_id(false), partition_index(false), server(false)
+        : error(false),
+          kvs(false),
+          app_id(false),
+          partition_index(false),
+          server(false),
+          error_hint(false)
     {
     }
     bool error : 1;
@@ -867,6 +923,7 @@ typedef struct _multi_get_response__isset
     bool app_id : 1;
     bool partition_index : 1;
     bool server : 1;
+    bool error_hint : 1;
 } _multi_get_response__isset;
 
 class multi_get_response
@@ -876,7 +933,7 @@ public:
     multi_get_response(multi_get_response &&);
     multi_get_response &operator=(const multi_get_response &);
     multi_get_response &operator=(multi_get_response &&);
-    multi_get_response() : error(0), app_id(0), partition_index(0), server() {}
+    multi_get_response() : error(0), app_id(0), partition_index(0), server(), error_hint() {}
 
     virtual ~multi_get_response() throw();
     int32_t error;
@@ -884,6 +941,7 @@ public:
     int32_t app_id;
     int32_t partition_index;
     std::string server;
+    std::string error_hint;
 
     _multi_get_response__isset __isset;
 
@@ -897,6 +955,8 @@ public:
 
     void __set_server(const std::string &val);
 
+    void __set_error_hint(const std::string &val);
+
     bool operator==(const multi_get_response &rhs) const
     {
         if (!(error == rhs.error))
@@ -909,6 +969,10 @@ public:
             return false;
         if (!(server == rhs.server))
             return false;
+        if (__isset.error_hint != rhs.__isset.error_hint)
+            return false;
+        else if (__isset.error_hint && !(error_hint == rhs.error_hint))
+            return false;
         return true;
     }
     bool operator!=(const multi_get_response &rhs) const { return !(*this == rhs); }
@@ -929,12 +993,242 @@ inline std::ostream &operator<<(std::ostream &out, const multi_get_response &obj
     return out;
 }
 
+typedef struct _full_key__isset
+{
+    _full_key__isset() : hash_key(false), sort_key(false) {}
+    bool hash_key : 1;
+    bool sort_key : 1;
+} _full_key__isset;
+
+class full_key
+{
+public:
+    full_key(const full_key &);
+    full_key(full_key &&);
+    full_key &operator=(const full_key &);
+    full_key &operator=(full_key &&);
+    full_key() {}
+
+    virtual ~full_key() throw();
+    ::dsn::blob hash_key;
+    ::dsn::blob sort_key;
+
+    _full_key__isset __isset;
+
+    void __set_hash_key(const ::dsn::blob &val);
+
+    void __set_sort_key(const ::dsn::blob &val);
+
+    bool operator==(const full_key &rhs) const
+    {
+        if (!(hash_key == rhs.hash_key))
+            return false;
+        if (!(sort_key == rhs.sort_key))
+            return false;
+        return true;
+    }
+    bool operator!=(const full_key &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const full_key &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(full_key &a, full_key &b);
+
+inline std::ostream &operator<<(std::ostream &out, const full_key &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _batch_get_request__isset
+{
+    _batch_get_request__isset() : keys(false) {}
+    bool keys : 1;
+} _batch_get_request__isset;
+
+class batch_get_request
+{
+public:
+    batch_get_request(const batch_get_request &);
+    batch_get_request(batch_get_request &&);
+    batch_get_request &operator=(const batch_get_request &);
+    batch_get_request &operator=(batch_get_request &&);
+    batch_get_request() {}
+
+    virtual ~batch_get_request() throw();
+    std::vector<full_key> keys;
+
+    _batch_get_request__isset __isset;
+
+    void __set_keys(const std::vector<full_key> &val);
+
+    bool operator==(const batch_get_request &rhs) const
+    {
+        if (!(keys == rhs.keys))
+            return false;
+        return true;
+    }
+    bool operator!=(const batch_get_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const batch_get_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(batch_get_request &a, batch_get_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const batch_get_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _full_data__isset
+{
+    _full_data__isset() : hash_key(false), sort_key(false), value(false) {}
+    bool hash_key : 1;
+    bool sort_key : 1;
+    bool value : 1;
+} _full_data__isset;
+
+class full_data
+{
+public:
+    full_data(const full_data &);
+    full_data(full_data &&);
+    full_data &operator=(const full_data &);
+    full_data &operator=(full_data &&);
+    full_data() {}
+
+    virtual ~full_data() throw();
+    ::dsn::blob hash_key;
+    ::dsn::blob sort_key;
+    ::dsn::blob value;
+
+    _full_data__isset __isset;
+
+    void __set_hash_key(const ::dsn::blob &val);
+
+    void __set_sort_key(const ::dsn::blob &val);
+
+    void __set_value(const ::dsn::blob &val);
+
+    bool operator==(const full_data &rhs) const
+    {
+        if (!(hash_key == rhs.hash_key))
+            return false;
+        if (!(sort_key == rhs.sort_key))
+            return false;
+        if (!(value == rhs.value))
+            return false;
+        return true;
+    }
+    bool operator!=(const full_data &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const full_data &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(full_data &a, full_data &b);
+
+inline std::ostream &operator<<(std::ostream &out, const full_data &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _batch_get_response__isset
+{
+    _batch_get_response__isset()
+        : error(false), data(false), app_id(false), partition_index(false), server(false)
+    {
+    }
+    bool error : 1;
+    bool data : 1;
+    bool app_id : 1;
+    bool partition_index : 1;
+    bool server : 1;
+} _batch_get_response__isset;
+
+class batch_get_response
+{
+public:
+    batch_get_response(const batch_get_response &);
+    batch_get_response(batch_get_response &&);
+    batch_get_response &operator=(const batch_get_response &);
+    batch_get_response &operator=(batch_get_response &&);
+    batch_get_response() : error(0), app_id(0), partition_index(0), server() {}
+
+    virtual ~batch_get_response() throw();
+    int32_t error;
+    std::vector<full_data> data;
+    int32_t app_id;
+    int32_t partition_index;
+    std::string server;
+
+    _batch_get_response__isset __isset;
+
+    void __set_error(const int32_t val);
+
+    void __set_data(const std::vector<full_data> &val);
+
+    void __set_app_id(const int32_t val);
+
+    void __set_partition_index(const int32_t val);
+
+    void __set_server(const std::string &val);
+
+    bool operator==(const batch_get_response &rhs) const
+    {
+        if (!(error == rhs.error))
+            return false;
+        if (!(data == rhs.data))
+            return false;
+        if (!(app_id == rhs.app_id))
+            return false;
+        if (!(partition_index == rhs.partition_index))
+            return false;
+        if (!(server == rhs.server))
+            return false;
+        return true;
+    }
+    bool operator!=(const batch_get_response &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const batch_get_response &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(batch_get_response &a, batch_get_response &b);
+
+inline std::ostream &operator<<(std::ostream &out, const batch_get_response &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
 typedef struct _incr_request__isset
 {
-    _incr_request__isset() : key(false), increment(false), expire_ts_seconds(false) {}
+    _incr_request__isset() : key(false), increment(false), expire_ts_seconds(false), blind(false) {}
     bool key : 1;
     bool increment : 1;
     bool expire_ts_seconds : 1;
+    bool blind : 1;
 } _incr_request__isset;
 
 class incr_request
@@ -944,12 +1238,13 @@ public:
     incr_request(incr_request &&);
     incr_request &operator=(const incr_request &);
     incr_request &operator=(incr_request &&);
-    incr_request() : increment(0), expire_ts_seconds(0) {}
+    incr_request() : increment(0), expire_ts_seconds(0), blind(0) {}
 
     virtual ~incr_request() throw();
     ::dsn::blob key;
     int64_t increment;
     int32_t expire_ts_seconds;
+    bool blind;
 
     _incr_request__isset __isset;
 
@@ -959,6 +1254,8 @@ public:
 
     void __set_expire_ts_seconds(const int32_t val);
 
+    void __set_blind(const bool val);
+
     bool operator==(const incr_request &rhs) const
     {
         if (!(key == rhs.key))
@@ -967,6 +1264,10 @@ public:
             return false;
         if (!(expire_ts_seconds == rhs.expire_ts_seconds))
             return false;
+        if (__isset.blind != rhs.__isset.blind)
+            return false;
+        else if (__isset.blind && !(blind == rhs.blind))
+            return false;
         return true;
     }
     bool operator!=(const incr_request &rhs) const { return !(*this == rhs); }
@@ -1071,72 +1372,274 @@ inline std::ostream &operator<<(std::ostream &out, const incr_response &obj)
     return out;
 }
 
-typedef struct _check_and_set_request__isset
+typedef struct _incr_item__isset
 {
-    _check_and_set_request__isset()
-        : hash_key(false),
-          check_sort_key(false),
-          check_type(false),
-          check_operand(false),
-          set_diff_sort_key(false),
-          set_sort_key(false),
-          set_value(false),
-          set_expire_ts_seconds(false),
-          return_check_value(false)
-    {
-    }
-    bool hash_key : 1;
-    bool check_sort_key : 1;
-    bool check_type : 1;
-    bool check_operand : 1;
-    bool set_diff_sort_key : 1;
-    bool set_sort_key : 1;
-    bool set_value : 1;
-    bool set_expire_ts_seconds : 1;
-    bool return_check_value : 1;
-} _check_and_set_request__isset;
+    _incr_item__isset() : sort_key(false), increment(false), expire_ts_seconds(false) {}
+    bool sort_key : 1;
+    bool increment : 1;
+    bool expire_ts_seconds : 1;
+} _incr_item__isset;
 
-class check_and_set_request
+class incr_item
 {
 public:
-    check_and_set_request(const check_and_set_request &);
-    check_and_set_request(check_and_set_request &&);
-    check_and_set_request &operator=(const check_and_set_request &);
-    check_and_set_request &operator=(check_and_set_request &&);
-    check_and_set_request()
-        : check_type((cas_check_type::type)0),
-          set_diff_sort_key(0),
-          set_expire_ts_seconds(0),
-          return_check_value(0)
-    {
-    }
-
-    virtual ~check_and_set_request() throw();
-    ::dsn::blob hash_key;
-    ::dsn::blob check_sort_key;
-    cas_check_type::type check_type;
-    ::dsn::blob check_operand;
-    bool set_diff_sort_key;
-    ::dsn::blob set_sort_key;
-    ::dsn::blob set_value;
-    int32_t set_expire_ts_seconds;
-    bool return_check_value;
+    incr_item(const incr_item &);
+    incr_item(incr_item &&);
+    incr_item &operator=(const incr_item &);
+    incr_item &operator=(incr_item &&);
+    incr_item() : increment(0), expire_ts_seconds(0) {}
 
-    _check_and_set_request__isset __isset;
-
-    void __set_hash_key(const ::dsn::blob &val);
-
-    void __set_check_sort_key(const ::dsn::blob &val);
+    virtual ~incr_item() throw();
+    ::dsn::blob sort_key;
+    int64_t increment;
+    int32_t expire_ts_seconds;
 
-    void __set_check_type(const cas_check_type::type val);
+    _incr_item__isset __isset;
 
-    void __set_check_operand(const ::dsn::blob &val);
+    void __set_sort_key(const ::dsn::blob &val);
 
-    void __set_set_diff_sort_key(const bool val);
+    void __set_increment(const int64_t val);
 
-    void __set_set_sort_key(const ::dsn::blob &val);
+    void __set_expire_ts_seconds(const int32_t val);
 
-    void __set_set_value(const ::dsn::blob &val);
+    bool operator==(const incr_item &rhs) const
+    {
+        if (!(sort_key == rhs.sort_key))
+            return false;
+        if (!(increment == rhs.increment))
+            return false;
+        if (!(expire_ts_seconds == rhs.expire_ts_seconds))
+            return false;
+        return true;
+    }
+    bool operator!=(const incr_item &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const incr_item &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(incr_item &a, incr_item &b);
+
+inline std::ostream &operator<<(std::ostream &out, const incr_item &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _multi_incr_request__isset
+{
+    _multi_incr_request__isset() : hash_key(false), items(false), blind(false) {}
+    bool hash_key : 1;
+    bool items : 1;
+    bool blind : 1;
+} _multi_incr_request__isset;
+
+class multi_incr_request
+{
+public:
+    multi_incr_request(const multi_incr_request &);
+    multi_incr_request(multi_incr_request &&);
+    multi_incr_request &operator=(const multi_incr_request &);
+    multi_incr_request &operator=(multi_incr_request &&);
+    multi_incr_request() : blind(0) {}
+
+    virtual ~multi_incr_request() throw();
+    ::dsn::blob hash_key;
+    std::vector<incr_item> items;
+    bool blind;
+
+    _multi_incr_request__isset __isset;
+
+    void __set_hash_key(const ::dsn::blob &val);
+
+    void __set_items(const std::vector<incr_item> &val);
+
+    void __set_blind(const bool val);
+
+    bool operator==(const multi_incr_request &rhs) const
+    {
+        if (!(hash_key == rhs.hash_key))
+            return false;
+        if (!(items == rhs.items))
+            return false;
+        if (__isset.blind != rhs.__isset.blind)
+            return false;
+        else if (__isset.blind && !(blind == rhs.blind))
+            return false;
+        return true;
+    }
+    bool operator!=(const multi_incr_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const multi_incr_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(multi_incr_request &a, multi_incr_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const multi_incr_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _multi_incr_response__isset
+{
+    _multi_incr_response__isset()
+        : error(false),
+          new_values(false),
+          app_id(false),
+          partition_index(false),
+          decree(false),
+          server(false)
+    {
+    }
+    bool error : 1;
+    bool new_values : 1;
+    bool app_id : 1;
+    bool partition_index : 1;
+    bool decree : 1;
+    bool server : 1;
+} _multi_incr_response__isset;
+
+class multi_incr_response
+{
+public:
+    multi_incr_response(const multi_incr_response &);
+    multi_incr_response(multi_incr_response &&);
+    multi_incr_response &operator=(const multi_incr_response &);
+    multi_incr_response &operator=(multi_incr_response &&);
+    multi_incr_response() : error(0), app_id(0), partition_index(0), decree(0), server() {}
+
+    virtual ~multi_incr_response() throw();
+    int32_t error;
+    std::vector<int64_t> new_values;
+    int32_t app_id;
+    int32_t partition_index;
+    int64_t decree;
+    std::string server;
+
+    _multi_incr_response__isset __isset;
+
+    void __set_error(const int32_t val);
+
+    void __set_new_values(const std::vector<int64_t> &val);
+
+    void __set_app_id(const int32_t val);
+
+    void __set_partition_index(const int32_t val);
+
+    void __set_decree(const int64_t val);
+
+    void __set_server(const std::string &val);
+
+    bool operator==(const multi_incr_response &rhs) const
+    {
+        if (!(error == rhs.error))
+            return false;
+        if (!(new_values == rhs.new_values))
+            return false;
+        if (!(app_id == rhs.app_id))
+            return false;
+        if (!(partition_index == rhs.partition_index))
+            return false;
+        if (!(decree == rhs.decree))
+            return false;
+        if (!(server == rhs.server))
+            return false;
+        return true;
+    }
+    bool operator!=(const multi_incr_response &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const multi_incr_response &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(multi_incr_response &a, multi_incr_response &b);
+
+inline std::ostream &operator<<(std::ostream &out, const multi_incr_response &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _check_and_set_request__isset
+{
+    _check_and_set_request__isset()
+        : hash_key(false),
+          check_sort_key(false),
+          check_type(false),
+          check_operand(false),
+          set_diff_sort_key(false),
+          set_sort_key(false),
+          set_value(false),
+          set_expire_ts_seconds(false),
+          return_check_value(false)
+    {
+    }
+    bool hash_key : 1;
+    bool check_sort_key : 1;
+    bool check_type : 1;
+    bool check_operand : 1;
+    bool set_diff_sort_key : 1;
+    bool set_sort_key : 1;
+    bool set_value : 1;
+    bool set_expire_ts_seconds : 1;
+    bool return_check_value : 1;
+} _check_and_set_request__isset;
+
+class check_and_set_request
+{
+public:
+    check_and_set_request(const check_and_set_request &);
+    check_and_set_request(check_and_set_request &&);
+    check_and_set_request &operator=(const check_and_set_request &);
+    check_and_set_request &operator=(check_and_set_request &&);
+    check_and_set_request()
+        : check_type((cas_check_type::type)0),
+          set_diff_sort_key(0),
+          set_expire_ts_seconds(0),
+          return_check_value(0)
+    {
+    }
+
+    virtual ~check_and_set_request() throw();
+    ::dsn::blob hash_key;
+    ::dsn::blob check_sort_key;
+    cas_check_type::type check_type;
+    ::dsn::blob check_operand;
+    bool set_diff_sort_key;
+    ::dsn::blob set_sort_key;
+    ::dsn::blob set_value;
+    int32_t set_expire_ts_seconds;
+    bool return_check_value;
+
+    _check_and_set_request__isset __isset;
+
+    void __set_hash_key(const ::dsn::blob &val);
+
+    void __set_check_sort_key(const ::dsn::blob &val);
+
+    void __set_check_type(const cas_check_type::type val);
+
+    void __set_check_operand(const ::dsn::blob &val);
+
+    void __set_set_diff_sort_key(const bool val);
+
+    void __set_set_sort_key(const ::dsn::blob &val);
+
+    void __set_set_value(const ::dsn::blob &val);
 
     void __set_set_expire_ts_seconds(const int32_t val);
 
@@ -1558,7 +2061,14 @@ typedef struct _get_scanner_request__isset
           hash_key_filter_type(false),
           hash_key_filter_pattern(false),
           sort_key_filter_type(false),
-          sort_key_filter_pattern(false)
+          sort_key_filter_pattern(false),
+          value_filter_type(false),
+          value_filter_pattern(false),
+          max_batch_bytes(false),
+          max_batch_time_us(false),
+          prefetch(false),
+          reverse(false),
+          deadline_ms(false)
     {
     }
     bool start_key : 1;
@@ -1571,6 +2081,13 @@ typedef struct _get_scanner_request__isset
     bool hash_key_filter_pattern : 1;
     bool sort_key_filter_type : 1;
     bool sort_key_filter_pattern : 1;
+    bool value_filter_type : 1;
+    bool value_filter_pattern : 1;
+    bool max_batch_bytes : 1;
+    bool max_batch_time_us : 1;
+    bool prefetch : 1;
+    bool reverse : 1;
+    bool deadline_ms : 1;
 } _get_scanner_request__isset;
 
 class get_scanner_request
@@ -1586,7 +2103,13 @@ public:
           batch_size(0),
           no_value(0),
           hash_key_filter_type((filter_type::type)0),
-          sort_key_filter_type((filter_type::type)0)
+          sort_key_filter_type((filter_type::type)0),
+          value_filter_type((filter_type::type)0),
+          max_batch_bytes(0),
+          max_batch_time_us(0),
+          prefetch(0),
+          reverse(0),
+          deadline_ms(0)
     {
     }
 
@@ -1601,6 +2124,13 @@ public:
     ::dsn::blob hash_key_filter_pattern;
     filter_type::type sort_key_filter_type;
     ::dsn::blob sort_key_filter_pattern;
+    filter_type::type value_filter_type;
+    ::dsn::blob value_filter_pattern;
+    int64_t max_batch_bytes;
+    int64_t max_batch_time_us;
+    bool prefetch;
+    bool reverse;
+    int64_t deadline_ms;
 
     _get_scanner_request__isset __isset;
 
@@ -1624,6 +2154,20 @@ public:
 
     void __set_sort_key_filter_pattern(const ::dsn::blob &val);
 
+    void __set_value_filter_type(const filter_type::type val);
+
+    void __set_value_filter_pattern(const ::dsn::blob &val);
+
+    void __set_max_batch_bytes(const int64_t val);
+
+    void __set_max_batch_time_us(const int64_t val);
+
+    void __set_prefetch(const bool val);
+
+    void __set_reverse(const bool val);
+
+    void __set_deadline_ms(const int64_t val);
+
     bool operator==(const get_scanner_request &rhs) const
     {
         if (!(start_key == rhs.start_key))
@@ -1646,6 +2190,20 @@ public:
             return false;
         if (!(sort_key_filter_pattern == rhs.sort_key_filter_pattern))
             return false;
+        if (!(value_filter_type == rhs.value_filter_type))
+            return false;
+        if (!(value_filter_pattern == rhs.value_filter_pattern))
+            return false;
+        if (!(max_batch_bytes == rhs.max_batch_bytes))
+            return false;
+        if (!(max_batch_time_us == rhs.max_batch_time_us))
+            return false;
+        if (!(prefetch == rhs.prefetch))
+            return false;
+        if (!(reverse == rhs.reverse))
+            return false;
+        if (!(deadline_ms == rhs.deadline_ms))
+            return false;
         return true;
     }
     bool operator!=(const get_scanner_request &rhs) const { return !(*this == rhs); }
@@ -1668,8 +2226,9 @@ inline std::ostream &operator<<(std::ostream &out, const get_scanner_request &ob
 
 typedef struct _scan_request__isset
 {
-    _scan_request__isset() : context_id(false) {}
+    _scan_request__isset() : context_id(false), deadline_ms(false) {}
     bool context_id : 1;
+    bool deadline_ms : 1;
 } _scan_request__isset;
 
 class scan_request
@@ -1679,19 +2238,24 @@ public:
     scan_request(scan_request &&);
     scan_request &operator=(const scan_request &);
     scan_request &operator=(scan_request &&);
-    scan_request() : context_id(0) {}
+    scan_request() : context_id(0), deadline_ms(0) {}
 
     virtual ~scan_request() throw();
     int64_t context_id;
+    int64_t deadline_ms;
 
     _scan_request__isset __isset;
 
     void __set_context_id(const int64_t val);
 
+    void __set_deadline_ms(const int64_t val);
+
     bool operator==(const scan_request &rhs) const
     {
         if (!(context_id == rhs.context_id))
             return false;
+        if (!(deadline_ms == rhs.deadline_ms))
+            return false;
         return true;
     }
     bool operator!=(const scan_request &rhs) const { return !(*this == rhs); }
@@ -1720,7 +2284,8 @@ typedef struct _scan_response__isset
           context_id(false),
           app_id(false),
           partition_index(false),
-          server(false)
+          server(false),
+          error_hint(false)
     {
     }
     bool error : 1;
@@ -1729,6 +2294,7 @@ typedef struct _scan_response__isset
     bool app_id : 1;
     bool partition_index : 1;
     bool server : 1;
+    bool error_hint : 1;
 } _scan_response__isset;
 
 class scan_response
@@ -1738,7 +2304,9 @@ public:
     scan_response(scan_response &&);
     scan_response &operator=(const scan_response &);
     scan_response &operator=(scan_response &&);
-    scan_response() : error(0), context_id(0), app_id(0), partition_index(0), server() {}
+    scan_response() : error(0), context_id(0), app_id(0), partition_index(0), server(), error_hint()
+    {
+    }
 
     virtual ~scan_response() throw();
     int32_t error;
@@ -1747,6 +2315,7 @@ public:
     int32_t app_id;
     int32_t partition_index;
     std::string server;
+    std::string error_hint;
 
     _scan_response__isset __isset;
 
@@ -1762,6 +2331,8 @@ public:
 
     void __set_server(const std::string &val);
 
+    void __set_error_hint(const std::string &val);
+
     bool operator==(const scan_response &rhs) const
     {
         if (!(error == rhs.error))
@@ -1776,6 +2347,10 @@ public:
             return false;
         if (!(server == rhs.server))
             return false;
+        if (__isset.error_hint != rhs.__isset.error_hint)
+            return false;
+        else if (__isset.error_hint && !(error_hint == rhs.error_hint))
+            return false;
         return true;
     }
     bool operator!=(const scan_response &rhs) const { return !(*this == rhs); }
@@ -1796,50 +2371,527 @@ inline std::ostream &operator<<(std::ostream &out, const scan_response &obj)
     return out;
 }
 
-typedef struct _duplicate_request__isset
+typedef struct _size_histogram__isset
 {
-    _duplicate_request__isset()
-        : timestamp(false),
-          task_code(false),
-          raw_message(false),
-          cluster_id(false),
-          verify_timetag(false)
-    {
-    }
-    bool timestamp : 1;
-    bool task_code : 1;
-    bool raw_message : 1;
-    bool cluster_id : 1;
-    bool verify_timetag : 1;
-} _duplicate_request__isset;
+    _size_histogram__isset() : count(false), sum(false), max(false), buckets(false) {}
+    bool count : 1;
+    bool sum : 1;
+    bool max : 1;
+    bool buckets : 1;
+} _size_histogram__isset;
 
-class duplicate_request
+class size_histogram
 {
 public:
-    duplicate_request(const duplicate_request &);
-    duplicate_request(duplicate_request &&);
-    duplicate_request &operator=(const duplicate_request &);
-    duplicate_request &operator=(duplicate_request &&);
-    duplicate_request() : timestamp(0), cluster_id(0), verify_timetag(0) {}
-
-    virtual ~duplicate_request() throw();
-    int64_t timestamp;
-    ::dsn::task_code task_code;
-    ::dsn::blob raw_message;
-    int8_t cluster_id;
-    bool verify_timetag;
+    size_histogram(const size_histogram &);
+    size_histogram(size_histogram &&);
+    size_histogram &operator=(const size_histogram &);
+    size_histogram &operator=(size_histogram &&);
+    size_histogram() : count(0), sum(0), max(0) {}
 
-    _duplicate_request__isset __isset;
+    virtual ~size_histogram() throw();
+    int64_t count;
+    int64_t sum;
+    int64_t max;
+    std::vector<int64_t> buckets;
 
-    void __set_timestamp(const int64_t val);
+    _size_histogram__isset __isset;
 
-    void __set_task_code(const ::dsn::task_code &val);
+    void __set_count(const int64_t val);
 
-    void __set_raw_message(const ::dsn::blob &val);
+    void __set_sum(const int64_t val);
 
-    void __set_cluster_id(const int8_t val);
+    void __set_max(const int64_t val);
 
-    void __set_verify_timetag(const bool val);
+    void __set_buckets(const std::vector<int64_t> &val);
+
+    bool operator==(const size_histogram &rhs) const
+    {
+        if (!(count == rhs.count))
+            return false;
+        if (!(sum == rhs.sum))
+            return false;
+        if (!(max == rhs.max))
+            return false;
+        if (!(buckets == rhs.buckets))
+            return false;
+        return true;
+    }
+    bool operator!=(const size_histogram &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const size_histogram &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(size_histogram &a, size_histogram &b);
+
+inline std::ostream &operator<<(std::ostream &out, const size_histogram &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _row_size_item__isset
+{
+    _row_size_item__isset() : hash_key(false), sort_key(false), row_size(false) {}
+    bool hash_key : 1;
+    bool sort_key : 1;
+    bool row_size : 1;
+} _row_size_item__isset;
+
+class row_size_item
+{
+public:
+    row_size_item(const row_size_item &);
+    row_size_item(row_size_item &&);
+    row_size_item &operator=(const row_size_item &);
+    row_size_item &operator=(row_size_item &&);
+    row_size_item() : row_size(0) {}
+
+    virtual ~row_size_item() throw();
+    ::dsn::blob hash_key;
+    ::dsn::blob sort_key;
+    int64_t row_size;
+
+    _row_size_item__isset __isset;
+
+    void __set_hash_key(const ::dsn::blob &val);
+
+    void __set_sort_key(const ::dsn::blob &val);
+
+    void __set_row_size(const int64_t val);
+
+    bool operator==(const row_size_item &rhs) const
+    {
+        if (!(hash_key == rhs.hash_key))
+            return false;
+        if (!(sort_key == rhs.sort_key))
+            return false;
+        if (!(row_size == rhs.row_size))
+            return false;
+        return true;
+    }
+    bool operator!=(const row_size_item &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const row_size_item &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(row_size_item &a, row_size_item &b);
+
+inline std::ostream &operator<<(std::ostream &out, const row_size_item &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _aggregate_scan_request__isset
+{
+    _aggregate_scan_request__isset()
+        : start_key(false),
+          stop_key(false),
+          start_inclusive(false),
+          stop_inclusive(false),
+          batch_size(false),
+          hash_key_filter_type(false),
+          hash_key_filter_pattern(false),
+          sort_key_filter_type(false),
+          sort_key_filter_pattern(false),
+          value_filter_type(false),
+          value_filter_pattern(false),
+          stat_size(false),
+          top_count(false),
+          context_id(false)
+    {
+    }
+    bool start_key : 1;
+    bool stop_key : 1;
+    bool start_inclusive : 1;
+    bool stop_inclusive : 1;
+    bool batch_size : 1;
+    bool hash_key_filter_type : 1;
+    bool hash_key_filter_pattern : 1;
+    bool sort_key_filter_type : 1;
+    bool sort_key_filter_pattern : 1;
+    bool value_filter_type : 1;
+    bool value_filter_pattern : 1;
+    bool stat_size : 1;
+    bool top_count : 1;
+    bool context_id : 1;
+} _aggregate_scan_request__isset;
+
+class aggregate_scan_request
+{
+public:
+    aggregate_scan_request(const aggregate_scan_request &);
+    aggregate_scan_request(aggregate_scan_request &&);
+    aggregate_scan_request &operator=(const aggregate_scan_request &);
+    aggregate_scan_request &operator=(aggregate_scan_request &&);
+    aggregate_scan_request()
+        : start_inclusive(0),
+          stop_inclusive(0),
+          batch_size(0),
+          hash_key_filter_type((filter_type::type)0),
+          sort_key_filter_type((filter_type::type)0),
+          value_filter_type((filter_type::type)0),
+          stat_size(0),
+          top_count(0),
+          context_id(0)
+    {
+    }
+
+    virtual ~aggregate_scan_request() throw();
+    ::dsn::blob start_key;
+    ::dsn::blob stop_key;
+    bool start_inclusive;
+    bool stop_inclusive;
+    int32_t batch_size;
+    filter_type::type hash_key_filter_type;
+    ::dsn::blob hash_key_filter_pattern;
+    filter_type::type sort_key_filter_type;
+    ::dsn::blob sort_key_filter_pattern;
+    filter_type::type value_filter_type;
+    ::dsn::blob value_filter_pattern;
+    bool stat_size;
+    int32_t top_count;
+    int64_t context_id;
+
+    _aggregate_scan_request__isset __isset;
+
+    void __set_start_key(const ::dsn::blob &val);
+
+    void __set_stop_key(const ::dsn::blob &val);
+
+    void __set_start_inclusive(const bool val);
+
+    void __set_stop_inclusive(const bool val);
+
+    void __set_batch_size(const int32_t val);
+
+    void __set_hash_key_filter_type(const filter_type::type val);
+
+    void __set_hash_key_filter_pattern(const ::dsn::blob &val);
+
+    void __set_sort_key_filter_type(const filter_type::type val);
+
+    void __set_sort_key_filter_pattern(const ::dsn::blob &val);
+
+    void __set_value_filter_type(const filter_type::type val);
+
+    void __set_value_filter_pattern(const ::dsn::blob &val);
+
+    void __set_stat_size(const bool val);
+
+    void __set_top_count(const int32_t val);
+
+    void __set_context_id(const int64_t val);
+
+    bool operator==(const aggregate_scan_request &rhs) const
+    {
+        if (!(start_key == rhs.start_key))
+            return false;
+        if (!(stop_key == rhs.stop_key))
+            return false;
+        if (!(start_inclusive == rhs.start_inclusive))
+            return false;
+        if (!(stop_inclusive == rhs.stop_inclusive))
+            return false;
+        if (!(batch_size == rhs.batch_size))
+            return false;
+        if (!(hash_key_filter_type == rhs.hash_key_filter_type))
+            return false;
+        if (!(hash_key_filter_pattern == rhs.hash_key_filter_pattern))
+            return false;
+        if (!(sort_key_filter_type == rhs.sort_key_filter_type))
+            return false;
+        if (!(sort_key_filter_pattern == rhs.sort_key_filter_pattern))
+            return false;
+        if (!(value_filter_type == rhs.value_filter_type))
+            return false;
+        if (!(value_filter_pattern == rhs.value_filter_pattern))
+            return false;
+        if (!(stat_size == rhs.stat_size))
+            return false;
+        if (!(top_count == rhs.top_count))
+            return false;
+        if (!(context_id == rhs.context_id))
+            return false;
+        return true;
+    }
+    bool operator!=(const aggregate_scan_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const aggregate_scan_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(aggregate_scan_request &a, aggregate_scan_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const aggregate_scan_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _aggregate_scan_response__isset
+{
+    _aggregate_scan_response__isset()
+        : error(false),
+          row_count(false),
+          hash_key_count(false),
+          hash_key_size(false),
+          sort_key_size(false),
+          value_size(false),
+          row_size(false),
+          top_rows(false),
+          context_id(false),
+          app_id(false),
+          partition_index(false),
+          server(false)
+    {
+    }
+    bool error : 1;
+    bool row_count : 1;
+    bool hash_key_count : 1;
+    bool hash_key_size : 1;
+    bool sort_key_size : 1;
+    bool value_size : 1;
+    bool row_size : 1;
+    bool top_rows : 1;
+    bool context_id : 1;
+    bool app_id : 1;
+    bool partition_index : 1;
+    bool server : 1;
+} _aggregate_scan_response__isset;
+
+class aggregate_scan_response
+{
+public:
+    aggregate_scan_response(const aggregate_scan_response &);
+    aggregate_scan_response(aggregate_scan_response &&);
+    aggregate_scan_response &operator=(const aggregate_scan_response &);
+    aggregate_scan_response &operator=(aggregate_scan_response &&);
+    aggregate_scan_response()
+        : error(0),
+          row_count(0),
+          hash_key_count(0),
+          context_id(0),
+          app_id(0),
+          partition_index(0),
+          server()
+    {
+    }
+
+    virtual ~aggregate_scan_response() throw();
+    int32_t error;
+    int64_t row_count;
+    int64_t hash_key_count;
+    size_histogram hash_key_size;
+    size_histogram sort_key_size;
+    size_histogram value_size;
+    size_histogram row_size;
+    std::vector<row_size_item> top_rows;
+    int64_t context_id;
+    int32_t app_id;
+    int32_t partition_index;
+    std::string server;
+
+    _aggregate_scan_response__isset __isset;
+
+    void __set_error(const int32_t val);
+
+    void __set_row_count(const int64_t val);
+
+    void __set_hash_key_count(const int64_t val);
+
+    void __set_hash_key_size(const size_histogram &val);
+
+    void __set_sort_key_size(const size_histogram &val);
+
+    void __set_value_size(const size_histogram &val);
+
+    void __set_row_size(const size_histogram &val);
+
+    void __set_top_rows(const std::vector<row_size_item> &val);
+
+    void __set_context_id(const int64_t val);
+
+    void __set_app_id(const int32_t val);
+
+    void __set_partition_index(const int32_t val);
+
+    void __set_server(const std::string &val);
+
+    bool operator==(const aggregate_scan_response &rhs) const
+    {
+        if (!(error == rhs.error))
+            return false;
+        if (!(row_count == rhs.row_count))
+            return false;
+        if (!(hash_key_count == rhs.hash_key_count))
+            return false;
+        if (!(hash_key_size == rhs.hash_key_size))
+            return false;
+        if (!(sort_key_size == rhs.sort_key_size))
+            return false;
+        if (!(value_size == rhs.value_size))
+            return false;
+        if (!(row_size == rhs.row_size))
+            return false;
+        if (!(top_rows == rhs.top_rows))
+            return false;
+        if (!(context_id == rhs.context_id))
+            return false;
+        if (!(app_id == rhs.app_id))
+            return false;
+        if (!(partition_index == rhs.partition_index))
+            return false;
+        if (!(server == rhs.server))
+            return false;
+        return true;
+    }
+    bool operator!=(const aggregate_scan_response &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const aggregate_scan_response &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(aggregate_scan_response &a, aggregate_scan_response &b);
+
+inline std::ostream &operator<<(std::ostream &out, const aggregate_scan_response &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _duplicate_entry__isset
+{
+    _duplicate_entry__isset() : timestamp(false), task_code(false), raw_message(false) {}
+    bool timestamp : 1;
+    bool task_code : 1;
+    bool raw_message : 1;
+} _duplicate_entry__isset;
+
+class duplicate_entry
+{
+public:
+    duplicate_entry(const duplicate_entry &);
+    duplicate_entry(duplicate_entry &&);
+    duplicate_entry &operator=(const duplicate_entry &);
+    duplicate_entry &operator=(duplicate_entry &&);
+    duplicate_entry() : timestamp(0) {}
+
+    virtual ~duplicate_entry() throw();
+    int64_t timestamp;
+    ::dsn::task_code task_code;
+    ::dsn::blob raw_message;
+
+    _duplicate_entry__isset __isset;
+
+    void __set_timestamp(const int64_t val);
+
+    void __set_task_code(const ::dsn::task_code &val);
+
+    void __set_raw_message(const ::dsn::blob &val);
+
+    bool operator==(const duplicate_entry &rhs) const
+    {
+        if (__isset.timestamp != rhs.__isset.timestamp)
+            return false;
+        else if (__isset.timestamp && !(timestamp == rhs.timestamp))
+            return false;
+        if (__isset.task_code != rhs.__isset.task_code)
+            return false;
+        else if (__isset.task_code && !(task_code == rhs.task_code))
+            return false;
+        if (__isset.raw_message != rhs.__isset.raw_message)
+            return false;
+        else if (__isset.raw_message && !(raw_message == rhs.raw_message))
+            return false;
+        return true;
+    }
+    bool operator!=(const duplicate_entry &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const duplicate_entry &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(duplicate_entry &a, duplicate_entry &b);
+
+inline std::ostream &operator<<(std::ostream &out, const duplicate_entry &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _duplicate_request__isset
+{
+    _duplicate_request__isset()
+        : timestamp(false),
+          task_code(false),
+          raw_message(false),
+          cluster_id(false),
+          verify_timetag(false),
+          entries(false)
+    {
+    }
+    bool timestamp : 1;
+    bool task_code : 1;
+    bool raw_message : 1;
+    bool cluster_id : 1;
+    bool verify_timetag : 1;
+    bool entries : 1;
+} _duplicate_request__isset;
+
+class duplicate_request
+{
+public:
+    duplicate_request(const duplicate_request &);
+    duplicate_request(duplicate_request &&);
+    duplicate_request &operator=(const duplicate_request &);
+    duplicate_request &operator=(duplicate_request &&);
+    duplicate_request() : timestamp(0), cluster_id(0), verify_timetag(0) {}
+
+    virtual ~duplicate_request() throw();
+    int64_t timestamp;
+    ::dsn::task_code task_code;
+    ::dsn::blob raw_message;
+    int8_t cluster_id;
+    bool verify_timetag;
+    std::vector<duplicate_entry> entries;
+
+    _duplicate_request__isset __isset;
+
+    void __set_timestamp(const int64_t val);
+
+    void __set_task_code(const ::dsn::task_code &val);
+
+    void __set_raw_message(const ::dsn::blob &val);
+
+    void __set_cluster_id(const int8_t val);
+
+    void __set_verify_timetag(const bool val);
+
+    void __set_entries(const std::vector<duplicate_entry> &val);
 
     bool operator==(const duplicate_request &rhs) const
     {
@@ -1863,6 +2915,10 @@ public:
             return false;
         else if (__isset.verify_timetag && !(verify_timetag == rhs.verify_timetag))
             return false;
+        if (__isset.entries != rhs.__isset.entries)
+            return false;
+        else if (__isset.entries && !(entries == rhs.entries))
+            return false;
         return true;
     }
     bool operator!=(const duplicate_request &rhs) const { return !(*this == rhs); }
@@ -1938,6 +2994,98 @@ inline std::ostream &operator<<(std::ostream &out, const duplicate_response &obj
     obj.printTo(out);
     return out;
 }
+
+typedef struct _maintain_sortkey_count_request__isset
+{
+    _maintain_sortkey_count_request__isset() : maintained(false) {}
+    bool maintained : 1;
+} _maintain_sortkey_count_request__isset;
+
+class maintain_sortkey_count_request
+{
+public:
+    maintain_sortkey_count_request(const maintain_sortkey_count_request &);
+    maintain_sortkey_count_request(maintain_sortkey_count_request &&);
+    maintain_sortkey_count_request &operator=(const maintain_sortkey_count_request &);
+    maintain_sortkey_count_request &operator=(maintain_sortkey_count_request &&);
+    maintain_sortkey_count_request() : maintained(0) {}
+
+    virtual ~maintain_sortkey_count_request() throw();
+    bool maintained;
+
+    _maintain_sortkey_count_request__isset __isset;
+
+    void __set_maintained(const bool val);
+
+    bool operator==(const maintain_sortkey_count_request &rhs) const
+    {
+        if (!(maintained == rhs.maintained))
+            return false;
+        return true;
+    }
+    bool operator!=(const maintain_sortkey_count_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const maintain_sortkey_count_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(maintain_sortkey_count_request &a, maintain_sortkey_count_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const maintain_sortkey_count_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _bulk_ingest_request__isset
+{
+    _bulk_ingest_request__isset() : dir(false) {}
+    bool dir : 1;
+} _bulk_ingest_request__isset;
+
+class bulk_ingest_request
+{
+public:
+    bulk_ingest_request(const bulk_ingest_request &);
+    bulk_ingest_request(bulk_ingest_request &&);
+    bulk_ingest_request &operator=(const bulk_ingest_request &);
+    bulk_ingest_request &operator=(bulk_ingest_request &&);
+    bulk_ingest_request() : dir() {}
+
+    virtual ~bulk_ingest_request() throw();
+    std::string dir;
+
+    _bulk_ingest_request__isset __isset;
+
+    void __set_dir(const std::string &val);
+
+    bool operator==(const bulk_ingest_request &rhs) const
+    {
+        if (!(dir == rhs.dir))
+            return false;
+        return true;
+    }
+    bool operator!=(const bulk_ingest_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const bulk_ingest_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(bulk_ingest_request &a, bulk_ingest_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const bulk_ingest_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
 }
 } // namespace
 
@@ -82,6 +82,20 @@ void capacity_unit_calculator::add_multi_get_cu(int32_t status,
     add_read_cu(data_size);
 }
 
+void capacity_unit_calculator::add_batch_get_cu(int32_t status,
+                                                const std::vector<::dsn::apps::full_data> &data)
+{
+    if (status != rocksdb::Status::kOk && status != rocksdb::Status::kNotFound &&
+        status != rocksdb::Status::kInvalidArgument) {
+        return;
+    }
+    int64_t data_size = 0;
+    for (const auto &d : data) {
+        data_size += d.hash_key.size() + d.sort_key.size() + d.value.size();
+    }
+    add_read_cu(data_size);
+}
+
 void capacity_unit_calculator::add_scan_cu(int32_t status,
                                            const std::vector<::dsn::apps::key_value> &kvs)
 {
@@ -96,6 +110,15 @@ void capacity_unit_calculator::add_scan_cu(int32_t status,
     add_read_cu(data_size);
 }
 
+void capacity_unit_calculator::add_aggregate_scan_cu(int32_t status, int64_t read_data_size)
+{
+    if (status != rocksdb::Status::kOk && status != rocksdb::Status::kNotFound &&
+        status != rocksdb::Status::kIncomplete && status != rocksdb::Status::kInvalidArgument) {
+        return;
+    }
+    add_read_cu(read_data_size);
+}
+
 void capacity_unit_calculator::add_sortkey_count_cu(int32_t status)
 {
     if (status != rocksdb::Status::kOk) {
@@ -167,6 +190,22 @@ void capacity_unit_calculator::add_incr_cu(int32_t status)
     add_read_cu(1);
 }
 
+void capacity_unit_calculator::add_multi_incr_cu(int32_t status,
+                                                 const std::vector<::dsn::apps::incr_item> &items)
+{
+    if (status != rocksdb::Status::kOk && status != rocksdb::Status::kInvalidArgument) {
+        return;
+    }
+    int64_t data_size = 0;
+    for (const auto &item : items) {
+        data_size += item.sort_key.size() + sizeof(item.increment);
+    }
+    if (status == rocksdb::Status::kOk) {
+        add_write_cu(data_size);
+    }
+    add_read_cu(data_size);
+}
+
 void capacity_unit_calculator::add_check_and_set_cu(int32_t status,
                                                     const dsn::blob &key,
                                                     const dsn::blob &value)
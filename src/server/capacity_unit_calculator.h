@@ -18,7 +18,9 @@ public:
 
     void add_get_cu(int32_t status, const dsn::blob &value);
     void add_multi_get_cu(int32_t status, const std::vector<::dsn::apps::key_value> &kvs);
+    void add_batch_get_cu(int32_t status, const std::vector<::dsn::apps::full_data> &data);
     void add_scan_cu(int32_t status, const std::vector<::dsn::apps::key_value> &kvs);
+    void add_aggregate_scan_cu(int32_t status, int64_t read_data_size);
     void add_sortkey_count_cu(int32_t status);
     void add_ttl_cu(int32_t status);
 
@@ -27,6 +29,7 @@ public:
     void add_multi_put_cu(int32_t status, const std::vector<::dsn::apps::key_value> &kvs);
     void add_multi_remove_cu(int32_t status, const std::vector<::dsn::blob> &sort_keys);
     void add_incr_cu(int32_t status);
+    void add_multi_incr_cu(int32_t status, const std::vector<::dsn::apps::incr_item> &items);
     void add_check_and_set_cu(int32_t status, const dsn::blob &key, const dsn::blob &value);
     void add_check_and_mutate_cu(int32_t status,
                                  const std::vector<::dsn::apps::mutate> &mutate_list);
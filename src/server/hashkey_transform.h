@@ -32,6 +32,11 @@ public:
 
         // hash_key_len is in big endian
         uint16_t hash_key_len = be16toh(*(int16_t *)(src.data()));
+        if (hash_key_len == UINT16_MAX) {
+            // metadata records of server, see sortkey_count_meta. No key used this length
+            // before, so the results of existing keys are not changed.
+            return rocksdb::Slice(src.data(), 2);
+        }
         dassert(src.size() >= 2 + hash_key_len,
                 "key length must be no less than (2 + hash_key_len)");
         return rocksdb::Slice(src.data(), 2 + hash_key_len);
@@ -181,11 +181,13 @@ info_collector::app_stat_counters *info_collector::get_app_counters(const std::s
 
     INIT_COUNTER(get_qps);
     INIT_COUNTER(multi_get_qps);
+    INIT_COUNTER(batch_get_qps);
     INIT_COUNTER(put_qps);
     INIT_COUNTER(multi_put_qps);
     INIT_COUNTER(remove_qps);
     INIT_COUNTER(multi_remove_qps);
     INIT_COUNTER(incr_qps);
+    INIT_COUNTER(multi_incr_qps);
     INIT_COUNTER(check_and_set_qps);
     INIT_COUNTER(check_and_mutate_qps);
     INIT_COUNTER(scan_qps);
@@ -199,6 +201,7 @@ info_collector::app_stat_counters *info_collector::get_app_counters(const std::s
     INIT_COUNTER(storage_mb);
     INIT_COUNTER(storage_count);
     INIT_COUNTER(rdb_block_cache_hit_rate);
+    INIT_COUNTER(rdb_row_cache_hit_rate);
     INIT_COUNTER(rdb_index_and_filter_blocks_mem_usage);
     INIT_COUNTER(rdb_memtable_mem_usage);
     INIT_COUNTER(rdb_estimate_num_keys);
@@ -35,11 +35,13 @@ public:
         {
             get_qps->set(row_stats.total_get_qps);
             multi_get_qps->set(row_stats.total_multi_get_qps);
+            batch_get_qps->set(row_stats.total_batch_get_qps);
             put_qps->set(row_stats.total_put_qps);
             multi_put_qps->set(row_stats.total_multi_put_qps);
             remove_qps->set(row_stats.total_remove_qps);
             multi_remove_qps->set(row_stats.total_multi_remove_qps);
             incr_qps->set(row_stats.total_incr_qps);
+            multi_incr_qps->set(row_stats.total_multi_incr_qps);
             check_and_set_qps->set(row_stats.total_check_and_set_qps);
             check_and_mutate_qps->set(row_stats.total_check_and_mutate_qps);
             scan_qps->set(row_stats.total_scan_qps);
@@ -59,6 +61,11 @@ public:
                     ? 0
                     : row_stats.total_rdb_block_cache_hit_count /
                           row_stats.total_rdb_block_cache_total_count * 1000000);
+            rdb_row_cache_hit_rate->set(
+                std::abs(row_stats.total_rdb_row_cache_total_count) < 1e-6
+                    ? 0
+                    : row_stats.total_rdb_row_cache_hit_count /
+                          row_stats.total_rdb_row_cache_total_count * 1000000);
             rdb_index_and_filter_blocks_mem_usage->set(
                 row_stats.total_rdb_index_and_filter_blocks_mem_usage);
             rdb_memtable_mem_usage->set(row_stats.total_rdb_memtable_mem_usage);
@@ -69,11 +76,13 @@ public:
 
         ::dsn::perf_counter_wrapper get_qps;
         ::dsn::perf_counter_wrapper multi_get_qps;
+        ::dsn::perf_counter_wrapper batch_get_qps;
         ::dsn::perf_counter_wrapper put_qps;
         ::dsn::perf_counter_wrapper multi_put_qps;
         ::dsn::perf_counter_wrapper remove_qps;
         ::dsn::perf_counter_wrapper multi_remove_qps;
         ::dsn::perf_counter_wrapper incr_qps;
+        ::dsn::perf_counter_wrapper multi_incr_qps;
         ::dsn::perf_counter_wrapper check_and_set_qps;
         ::dsn::perf_counter_wrapper check_and_mutate_qps;
         ::dsn::perf_counter_wrapper scan_qps;
@@ -88,6 +97,7 @@ public:
         ::dsn::perf_counter_wrapper storage_count;
         ::dsn::perf_counter_wrapper rdb_block_cache_hit_rate;
         ::dsn::perf_counter_wrapper rdb_block_cache_mem_usage;
+        ::dsn::perf_counter_wrapper rdb_row_cache_hit_rate;
         ::dsn::perf_counter_wrapper rdb_index_and_filter_blocks_mem_usage;
         ::dsn::perf_counter_wrapper rdb_memtable_mem_usage;
         ::dsn::perf_counter_wrapper rdb_estimate_num_keys;
@@ -9,8 +9,10 @@
 #include <rocksdb/compaction_filter.h>
 #include <rocksdb/merge_operator.h>
 
+#include "base/pegasus_key_schema.h"
 #include "base/pegasus_utils.h"
 #include "base/pegasus_value_schema.h"
+#include "sortkey_count_meta.h"
 
 namespace pegasus {
 namespace server {
@@ -18,8 +20,20 @@ namespace server {
 class KeyWithTTLCompactionFilter : public rocksdb::CompactionFilter
 {
 public:
-    KeyWithTTLCompactionFilter(uint32_t pegasus_data_version, uint32_t default_ttl, bool enabled)
-        : _pegasus_data_version(pegasus_data_version), _default_ttl(default_ttl), _enabled(enabled)
+    KeyWithTTLCompactionFilter(uint32_t pegasus_data_version,
+                               uint32_t default_ttl,
+                               bool enabled,
+                               int32_t partition_index,
+                               int32_t partition_version,
+                               bool validate_partition_hash,
+                               uint64_t sortkey_count_generation)
+        : _pegasus_data_version(pegasus_data_version),
+          _default_ttl(default_ttl),
+          _enabled(enabled),
+          _partition_index(partition_index),
+          _partition_version(partition_version),
+          _validate_partition_hash(validate_partition_hash),
+          _sortkey_count_generation(sortkey_count_generation)
     {
     }
 
@@ -33,6 +47,15 @@ public:
             return false;
         }
 
+        if (_validate_partition_hash && _partition_version >= 0 && !check_partition_hash(key)) {
+            // the record belongs to another partition after partition split
+            return true;
+        }
+
+        if (sortkey_count_meta::is_meta_key(key)) {
+            return filter_sortkey_count_meta(key, existing_value, new_value, value_changed);
+        }
+
         uint32_t expire_ts =
             pegasus_extract_expire_ts(_pegasus_data_version, utils::to_string_view(existing_value));
         if (_default_ttl != 0 && expire_ts == 0) {
@@ -48,10 +71,61 @@ public:
 
     const char *Name() const override { return "KeyWithTTLCompactionFilter"; }
 
+private:
+    // The sortkey_count metadata of former generations are dropped. When default ttl is set,
+    // ttl is added to the records without updating the metadata, so the metadata counting no
+    // record with ttl is invalidated, and the hash key is recounted by the next write.
+    bool filter_sortkey_count_meta(const rocksdb::Slice &key,
+                                   const rocksdb::Slice &existing_value,
+                                   std::string *new_value,
+                                   bool *value_changed) const
+    {
+        dsn::string_view hash_key;
+        sortkey_count_meta meta;
+        if (!sortkey_count_meta::extract_hash_key(key, hash_key) || !meta.decode(existing_value)) {
+            return false;
+        }
+        if (meta.generation < _sortkey_count_generation) {
+            return true;
+        }
+        if (_default_ttl == 0 || meta.min_expire_ts != 0) {
+            return false;
+        }
+        // expired since the beginning of the epoch
+        meta.min_expire_ts = 1;
+        std::string encoded;
+        meta.encode(encoded);
+        new_value->assign(existing_value.data(),
+                          existing_value.size() - sortkey_count_meta::ENCODED_SIZE);
+        new_value->append(encoded);
+        *value_changed = true;
+        return false;
+    }
+
+    // Only the records of user keys are validated. The records whose keys are not in the form
+    // of [hash_key_len][hash_key][sort_key] are always kept, such as the empty record written by
+    // empty_put() to advance the decree, and the reserved records prefixed by 0xFFFF.
+    bool check_partition_hash(const rocksdb::Slice &key) const
+    {
+        if (key.size() < 2 || sortkey_count_meta::is_meta_key(key)) {
+            return true;
+        }
+        uint16_t hash_key_len = be16toh(*(int16_t *)(key.data()));
+        if (key.size() < 2 + hash_key_len) {
+            return true;
+        }
+        uint64_t key_hash = pegasus_key_hash(::dsn::blob(key.data(), 0, key.size()));
+        return check_pegasus_key_hash(key_hash, _partition_index, _partition_version);
+    }
+
 private:
     uint32_t _pegasus_data_version;
     uint32_t _default_ttl;
     bool _enabled; // only process filtering when _enabled == true
+    int32_t _partition_index;
+    int32_t _partition_version;
+    bool _validate_partition_hash;
+    uint64_t _sortkey_count_generation;
     mutable pegasus_value_generator _gen;
 };
 
@@ -64,8 +138,14 @@ public:
     std::unique_ptr<rocksdb::CompactionFilter>
     CreateCompactionFilter(const rocksdb::CompactionFilter::Context & /*context*/) override
     {
-        return std::unique_ptr<KeyWithTTLCompactionFilter>(new KeyWithTTLCompactionFilter(
-            _pegasus_data_version.load(), _default_ttl.load(), _enabled.load()));
+        return std::unique_ptr<KeyWithTTLCompactionFilter>(
+            new KeyWithTTLCompactionFilter(_pegasus_data_version.load(),
+                                           _default_ttl.load(),
+                                           _enabled.load(),
+                                           _partition_index.load(),
+                                           _partition_version.load(),
+                                           _validate_partition_hash.load(),
+                                           _sortkey_count_generation.load()));
     }
     const char *Name() const override { return "KeyWithTTLCompactionFilterFactory"; }
 
@@ -75,11 +155,33 @@ public:
     }
     void EnableFilter() { _enabled.store(true, std::memory_order_release); }
     void SetDefaultTTL(uint32_t ttl) { _default_ttl.store(ttl, std::memory_order_release); }
+    void SetPartitionIndex(int32_t pidx)
+    {
+        _partition_index.store(pidx, std::memory_order_release);
+    }
+    void SetPartitionVersion(int32_t partition_version)
+    {
+        _partition_version.store(partition_version, std::memory_order_release);
+    }
+    void EnablePartitionHashValidation()
+    {
+        _validate_partition_hash.store(true, std::memory_order_release);
+    }
+    void SetSortkeyCountGeneration(uint64_t generation)
+    {
+        _sortkey_count_generation.store(generation, std::memory_order_release);
+    }
 
 private:
     std::atomic<uint32_t> _pegasus_data_version;
     std::atomic<uint32_t> _default_ttl;
     std::atomic_bool _enabled; // only process filtering when _enabled == true
+    std::atomic<int32_t> _partition_index{0};
+    // records not belonging to this partition are dropped only if the version is valid
+    std::atomic<int32_t> _partition_version{-1};
+    std::atomic_bool _validate_partition_hash{false};
+    // the sortkey_count metadata of former generations are dropped, see sortkey_count_state
+    std::atomic<uint64_t> _sortkey_count_generation{0};
 };
 
 } // namespace server
@@ -212,7 +212,7 @@ void pegasus_manual_compact_service::extract_manual_compact_opts(
         int32_t target_level;
         if (dsn::buf2int32(find->second, target_level) &&
             (target_level == -1 ||
-             (target_level >= 1 && target_level <= _app->_data_cf_opts.num_levels))) {
+             (target_level >= 0 && target_level <= _app->_data_cf_opts.num_levels))) {
             options.target_level = target_level;
         } else {
             dwarn_replica("{}={} is invalid, use default value {}",
@@ -0,0 +1,171 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <rocksdb/merge_operator.h>
+#include <rocksdb/slice.h>
+#include <dsn/utility/endians.h>
+#include <dsn/utility/string_conv.h>
+
+#include "base/pegasus_utils.h"
+#include "base/pegasus_value_schema.h"
+
+namespace pegasus {
+namespace server {
+
+// Merge operand of the blind incr, see incr_request.blind.
+//
+// rocksdb value = [data_version(uint32)] [timetag(uint64)] [increment(int64)]
+//                 [expire_ts_seconds(int32)]
+// The operand is not a pegasus value, it is only read by the merge operator, which produces a
+// normal pegasus value of `data_version` from the operands. `expire_ts_seconds` has the same
+// meaning as in dsn::apps::incr_request. The timestamp of `timetag` is the time of the mutation,
+// which is the same on all the replicas.
+struct incr_operand
+{
+    uint32_t data_version{0};
+    uint64_t timetag{0};
+    int64_t increment{0};
+    int32_t expire_ts_seconds{0};
+
+    static constexpr size_t ENCODED_SIZE =
+        sizeof(uint32_t) + sizeof(uint64_t) + sizeof(int64_t) + sizeof(int32_t);
+
+    bool decode(const rocksdb::Slice &value)
+    {
+        if (value.size() != ENCODED_SIZE) {
+            return false;
+        }
+        dsn::data_input input(utils::to_string_view(value));
+        data_version = input.read_u32();
+        timetag = input.read_u64();
+        increment = static_cast<int64_t>(input.read_u64());
+        expire_ts_seconds = static_cast<int32_t>(input.read_u32());
+        return data_version <= PEGASUS_DATA_VERSION_MAX;
+    }
+
+    void encode(std::string &buf) const
+    {
+        buf.resize(ENCODED_SIZE);
+        dsn::data_output output(buf);
+        output.write_u32(data_version);
+        output.write_u64(timetag);
+        output.write_u64(static_cast<uint64_t>(increment));
+        output.write_u32(static_cast<uint32_t>(expire_ts_seconds));
+    }
+
+    // The time of the mutation in seconds since utils::epoch_begin, 0 if unknown.
+    uint32_t write_epoch() const
+    {
+        uint64_t seconds = extract_timestamp_from_timetag(timetag) / 1000000;
+        return seconds > utils::epoch_begin ? static_cast<uint32_t>(seconds - utils::epoch_begin)
+                                            : 0;
+    }
+
+    // Applies `operands` in order to the pegasus value `base` (nullptr if not exist), the same
+    // as applying the incr requests one by one, and writes the result pegasus value into
+    // `result`. An increment is ignored if it is rejected by the normal incr, that is, if the
+    // old value is not an integer or the new value is out of range.
+    // Whether the old value is expired is judged at the write time of each operand rather than
+    // the time of merging, so that the result is the same whenever and wherever it is merged.
+    // Return false if any operand is corrupted.
+    static bool merge(const rocksdb::Slice *base,
+                      const std::vector<rocksdb::Slice> &operands,
+                      std::string &result)
+    {
+        std::vector<incr_operand> ops(operands.size());
+        for (size_t i = 0; i < operands.size(); ++i) {
+            if (!ops[i].decode(operands[i])) {
+                return false;
+            }
+        }
+        if (ops.empty()) {
+            return false;
+        }
+        const uint32_t version = ops.back().data_version;
+
+        int64_t value = 0;
+        uint32_t expire_ts = 0;
+        // the base value is not an integer, it is kept until it expires
+        bool keep_base = false;
+        if (base != nullptr) {
+            dsn::string_view base_view = utils::to_string_view(*base);
+            expire_ts = pegasus_extract_expire_ts(version, base_view);
+            dsn::string_view old_value = pegasus_extract_user_data_view(version, base_view);
+            keep_base = old_value.length() > 0 && !dsn::buf2int64(old_value, value);
+        }
+
+        for (const incr_operand &op : ops) {
+            // the expiration can not be judged without the write time
+            uint32_t write_epoch = op.write_epoch();
+            if (write_epoch > 0 && check_if_ts_expired(write_epoch, expire_ts)) {
+                value = 0;
+                expire_ts = 0;
+                keep_base = false;
+            }
+            if (keep_base) {
+                continue;
+            }
+
+            int64_t new_value = value + op.increment;
+            if ((op.increment > 0 && new_value < value) ||
+                (op.increment < 0 && new_value > value)) {
+                continue;
+            }
+            value = new_value;
+            if (op.expire_ts_seconds > 0) {
+                expire_ts = static_cast<uint32_t>(op.expire_ts_seconds);
+            } else if (op.expire_ts_seconds < 0) {
+                expire_ts = 0;
+            }
+        }
+
+        if (keep_base) {
+            result.assign(base->data(), base->size());
+            return true;
+        }
+
+        std::string user_data = std::to_string(value);
+        pegasus_value_generator gen;
+        rocksdb::SliceParts sparts =
+            gen.generate_value(version, user_data, expire_ts, ops.back().timetag);
+        result.clear();
+        for (int i = 0; i < sparts.num_parts; ++i) {
+            result.append(sparts.parts[i].data(), sparts.parts[i].size());
+        }
+        return true;
+    }
+};
+
+// The merge operator of the data column family, which merges the operands of blind incr. It is
+// installed only if blind incr is enabled, see the config 'enable_blind_incr'.
+class pegasus_merge_operator : public rocksdb::MergeOperator
+{
+public:
+    bool FullMergeV2(const MergeOperationInput &merge_in,
+                     MergeOperationOutput *merge_out) const override
+    {
+        return incr_operand::merge(
+            merge_in.existing_value, merge_in.operand_list, merge_out->new_value);
+    }
+
+    // Incr operands are not merged partially, because an increment may be ignored depending
+    // on the base value.
+    bool PartialMerge(const rocksdb::Slice &key,
+                      const rocksdb::Slice &left_operand,
+                      const rocksdb::Slice &right_operand,
+                      std::string *new_value,
+                      rocksdb::Logger *logger) const override
+    {
+        return false;
+    }
+
+    const char *Name() const override { return "pegasus.MergeOperator"; }
+};
+
+} // namespace server
+} // namespace pegasus
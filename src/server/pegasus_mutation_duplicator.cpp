@@ -73,6 +73,13 @@ pegasus_mutation_duplicator::pegasus_mutation_duplicator(dsn::replication::repli
                     ret.get_error());
     _remote_cluster_id = static_cast<uint8_t>(ret.get_value());
 
+    _batch_bytes = dsn_config_get_value_uint64(
+        "pegasus.server",
+        "duplication_batch_bytes",
+        0,
+        "max bytes of the writes of the same hash carried by one DUPLICATE request, "
+        "0 means one write per request");
+
     ddebug_replica("initialize mutation duplicator for local cluster [id:{}], "
                    "remote cluster [id:{}, addr:{}]",
                    get_current_cluster_id(),
@@ -131,9 +138,10 @@ void pegasus_mutation_duplicator::on_duplicate_reply(uint64_t hash,
         // errors are acceptable.
         // TODO(wutao1): print the entire request for future debugging.
         if (dsn::rand::next_double01() <= 0.01) {
+            const auto &req = rpc.request();
             derror_replica("duplicate_rpc failed: {} [code:{}, timestamp:{}]",
                            err == dsn::ERR_OK ? _client->get_error_string(perr) : err.to_string(),
-                           rpc.request().timestamp);
+                           req.__isset.entries ? req.entries.front().timestamp : req.timestamp);
         }
         // duplicating an illegal write to server is unacceptable, fail fast.
         dassert_replica(perr != PERR_INVALID_ARGUMENT, rpc.response().error_hint);
@@ -169,28 +177,57 @@ void pegasus_mutation_duplicator::duplicate(mutation_tuple_set muts, callback cb
 {
     _total_shipped_size = 0;
 
+    // hash -> requests, the rpcs are created after the requests are completed, because
+    // the request is marshalled once its rpc is created.
+    std::map<uint64_t, std::vector<std::unique_ptr<dsn::apps::duplicate_request>>> requests;
+    std::map<uint64_t, uint64_t> batch_sizes; // hash -> bytes of the last request
     for (auto mut : muts) {
         // mut: 0=timestamp, 1=rpc_code, 2=raw_message
 
         dsn::task_code rpc_code = std::get<1>(mut);
         dsn::blob raw_message = std::get<2>(mut);
-        auto dreq = dsn::make_unique<dsn::apps::duplicate_request>();
-        uint64_t hash = get_hash_from_request(rpc_code, raw_message);
-
         if (rpc_code == dsn::apps::RPC_RRDB_RRDB_DUPLICATE) {
             // ignore if it is a DUPLICATE
-        } else {
+            continue;
+        }
+        uint64_t hash = get_hash_from_request(rpc_code, raw_message);
+        auto &reqs = requests[hash];
+
+        if (_batch_bytes == 0) {
+            auto dreq = dsn::make_unique<dsn::apps::duplicate_request>();
             dreq->__set_raw_message(raw_message);
             dreq->__set_task_code(rpc_code);
             dreq->__set_timestamp(std::get<0>(mut));
             dreq->__set_cluster_id(get_current_cluster_id());
+            reqs.emplace_back(std::move(dreq));
+            continue;
+        }
+
+        // a request carries one write at least, even if the write exceeds the budget.
+        uint64_t &batch_size = batch_sizes[hash];
+        if (reqs.empty() || batch_size + raw_message.length() > _batch_bytes) {
+            auto dreq = dsn::make_unique<dsn::apps::duplicate_request>();
+            dreq->__set_cluster_id(get_current_cluster_id());
+            dreq->__isset.entries = true;
+            reqs.emplace_back(std::move(dreq));
+            batch_size = 0;
         }
+        dsn::apps::duplicate_entry entry;
+        entry.__set_timestamp(std::get<0>(mut));
+        entry.__set_task_code(rpc_code);
+        entry.__set_raw_message(raw_message);
+        reqs.back()->entries.emplace_back(std::move(entry));
+        batch_size += raw_message.length();
+    }
 
-        duplicate_rpc rpc(std::move(dreq),
-                          dsn::apps::RPC_RRDB_RRDB_DUPLICATE,
-                          10_s, // TODO(wutao1): configurable timeout.
-                          hash);
-        _inflights[hash].push_back(std::move(rpc));
+    for (auto &kv : requests) {
+        for (auto &dreq : kv.second) {
+            duplicate_rpc rpc(std::move(dreq),
+                              dsn::apps::RPC_RRDB_RRDB_DUPLICATE,
+                              10_s, // TODO(wutao1): configurable timeout.
+                              kv.first);
+            _inflights[kv.first].push_back(std::move(rpc));
+        }
     }
 
     if (_inflights.empty()) {
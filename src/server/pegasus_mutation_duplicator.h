@@ -44,9 +44,14 @@ private:
     uint8_t _remote_cluster_id{0};
     std::string _remote_cluster;
 
+    // Max bytes of the writes carried by one duplicate_rpc, 0 means one write per rpc.
+    uint64_t _batch_bytes{0};
+
     // The duplicate_rpc are isolated by their hash value from hash key.
     // Writes with the same hash are duplicated in mutation order to preserve data consistency,
     // otherwise they are duplicated concurrently to improve performance.
+    // If batching is enabled, consecutive writes with the same hash are carried by one
+    // duplicate_rpc, and applied by the remote in one write batch.
     std::map<uint64_t, std::deque<duplicate_rpc>> _inflights; // hash -> duplicate_rpc
     dsn::zlock _lock;
 
@@ -0,0 +1,155 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <dsn/utility/string_view.h>
+#include <rrdb/rrdb_types.h>
+
+namespace pegasus {
+namespace server {
+
+// Accumulates the statistics of records iterated by aggregate_scan on one partition.
+// Row count, hash key count and size histograms are collected per batch, while
+// the top rows are collected through the whole aggregation.
+class pegasus_scan_aggregator
+{
+public:
+    pegasus_scan_aggregator(bool stat_size, int32_t top_count)
+        : _stat_size(stat_size), _top_count(stat_size ? top_count : 0)
+    {
+        reset_batch();
+    }
+
+    void add(const ::dsn::blob &hash_key, const ::dsn::blob &sort_key, size_t value_size)
+    {
+        _row_count++;
+
+        // records are iterated in order of key, so records with the same hash key are adjacent
+        if (!_has_last_hash_key || dsn::string_view(hash_key) != _last_hash_key) {
+            _hash_key_count++;
+            _last_hash_key.assign(hash_key.data(), hash_key.length());
+            _has_last_hash_key = true;
+        }
+
+        if (!_stat_size) {
+            return;
+        }
+
+        int64_t row_size = hash_key.length() + sort_key.length() + value_size;
+        add_to_histogram(_hash_key_size, hash_key.length());
+        add_to_histogram(_sort_key_size, sort_key.length());
+        add_to_histogram(_value_size, value_size);
+        add_to_histogram(_row_size, row_size);
+
+        if (_top_count <= 0) {
+            return;
+        }
+        if (_top_rows.size() < _top_count) {
+            _top_rows.push(make_top_row(hash_key, sort_key, row_size));
+        } else if (_top_rows.top().row_size < row_size) {
+            _top_rows.pop();
+            _top_rows.push(make_top_row(hash_key, sort_key, row_size));
+        }
+    }
+
+    // Moves the statistics of the current batch into `resp`, and the top rows are
+    // moved only if this is the last batch.
+    void fill_response(::dsn::apps::aggregate_scan_response &resp, bool last_batch)
+    {
+        resp.row_count = _row_count;
+        resp.hash_key_count = _hash_key_count;
+        if (_stat_size) {
+            resp.hash_key_size = std::move(_hash_key_size);
+            resp.sort_key_size = std::move(_sort_key_size);
+            resp.value_size = std::move(_value_size);
+            resp.row_size = std::move(_row_size);
+        }
+        if (last_batch) {
+            resp.top_rows.resize(_top_rows.size());
+            // the heap pops the smallest row first, fill from back to make it descending
+            for (int i = static_cast<int>(resp.top_rows.size()) - 1; i >= 0; i--) {
+                resp.top_rows[i] = _top_rows.top();
+                _top_rows.pop();
+            }
+        }
+        reset_batch();
+    }
+
+    // Bucket index of `size` in ::dsn::apps::size_histogram.
+    static int histogram_bucket(int64_t size)
+    {
+        return size <= 0 ? 0 : 64 - __builtin_clzll(static_cast<uint64_t>(size));
+    }
+
+private:
+    struct top_row_compare
+    {
+        bool operator()(const ::dsn::apps::row_size_item &l,
+                        const ::dsn::apps::row_size_item &r) const
+        {
+            return l.row_size > r.row_size;
+        }
+    };
+
+    static ::dsn::apps::row_size_item
+    make_top_row(const ::dsn::blob &hash_key, const ::dsn::blob &sort_key, int64_t row_size)
+    {
+        ::dsn::apps::row_size_item item;
+        item.hash_key = ::dsn::blob::create_from_bytes(hash_key.data(), hash_key.length());
+        item.sort_key = ::dsn::blob::create_from_bytes(sort_key.data(), sort_key.length());
+        item.row_size = row_size;
+        return item;
+    }
+
+    static void add_to_histogram(::dsn::apps::size_histogram &h, int64_t size)
+    {
+        int bucket = histogram_bucket(size);
+        if (h.buckets.size() <= bucket) {
+            h.buckets.resize(bucket + 1, 0);
+        }
+        h.buckets[bucket]++;
+        h.count++;
+        h.sum += size;
+        if (size > h.max) {
+            h.max = size;
+        }
+    }
+
+    void reset_batch()
+    {
+        _row_count = 0;
+        _hash_key_count = 0;
+        _hash_key_size = ::dsn::apps::size_histogram();
+        _sort_key_size = ::dsn::apps::size_histogram();
+        _value_size = ::dsn::apps::size_histogram();
+        _row_size = ::dsn::apps::size_histogram();
+    }
+
+private:
+    const bool _stat_size;
+    const int32_t _top_count;
+
+    bool _has_last_hash_key{false};
+    std::string _last_hash_key;
+
+    int64_t _row_count;
+    int64_t _hash_key_count;
+    ::dsn::apps::size_histogram _hash_key_size;
+    ::dsn::apps::size_histogram _sort_key_size;
+    ::dsn::apps::size_histogram _value_size;
+    ::dsn::apps::size_histogram _row_size;
+
+    std::priority_queue<::dsn::apps::row_size_item,
+                        std::vector<::dsn::apps::row_size_item>,
+                        top_row_compare>
+        _top_rows;
+};
+
+} // namespace server
+} // namespace pegasus
@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <list>
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <rocksdb/db.h>
 #include <dsn/tool_api.h>
 #include <dsn/utility/rand.h>
@@ -12,10 +16,93 @@
 
 #include "base/pegasus_const.h"
 #include "base/pegasus_utils.h"
+#include "base/pegasus_value_schema.h"
+#include "pegasus_scan_aggregator.h"
 
 namespace pegasus {
 namespace server {
 
+// Records iterated in one scan batch.
+struct pegasus_scan_batch
+{
+    std::vector<::dsn::apps::key_value> kvs;
+    rocksdb::Status status;
+    bool complete{false}; // the iterator has reached the stop key or the end
+    uint64_t expire_count{0};
+    uint64_t filter_count{0};
+    int64_t bytes{0};      // total size of keys and values in `kvs`
+    bool truncated{false}; // stopped as the request has been past the client deadline
+    // expire_ts of each record in `kvs`, only recorded for the prefetched batch, whose records
+    // may expire before being replied
+    std::vector<uint32_t> expire_ts;
+
+    // Remove the records expired since the batch is prefetched.
+    void remove_expired(uint32_t epoch_now)
+    {
+        size_t j = 0;
+        for (size_t i = 0; i < kvs.size(); ++i) {
+            if (check_if_ts_expired(epoch_now, expire_ts[i])) {
+                bytes -= kvs[i].key.length() + kvs[i].value.length();
+                expire_count++;
+                continue;
+            }
+            if (j != i) {
+                kvs[j] = std::move(kvs[i]);
+                expire_ts[j] = expire_ts[i];
+            }
+            j++;
+        }
+        kvs.resize(j);
+        expire_ts.resize(j);
+    }
+};
+
+// Limits the memory of scan batches prefetched by one replica. The bytes of a batch are
+// reserved before it is prefetched, and the unused part is released once it is done, so the
+// used bytes never exceed the limit.
+class pegasus_scan_prefetch_quota
+{
+public:
+    pegasus_scan_prefetch_quota() : _max_bytes(0), _used_bytes(0), _wasted_count(0) {}
+
+    // 0 means prefetch is disabled
+    void set_max_bytes(int64_t max_bytes) { _max_bytes = max_bytes; }
+
+    bool enabled() const { return _max_bytes > 0; }
+
+    // 
+eturn false if `bytes` can not be reserved within the limit.
+    bool try_acquire(int64_t bytes)
+    {
+        int64_t used = _used_bytes.load();
+        do {
+            if (used + bytes > _max_bytes) {
+                return false;
+            }
+        } while (!_used_bytes.compare_exchange_weak(used, used + bytes));
+        return true;
+    }
+
+    // `wasted` is true if the prefetched batch is dropped without being returned to client
+    void release(int64_t bytes, bool wasted)
+    {
+        _used_bytes -= bytes;
+        if (wasted) {
+            _wasted_count++;
+        }
+    }
+
+    int64_t used_bytes() const { return _used_bytes.load(); }
+
+    // \return the count of wasted batches since last call.
+    uint64_t fetch_wasted_count() { return _wasted_count.exchange(0); }
+
+private:
+    int64_t _max_bytes;
+    std::atomic<int64_t> _used_bytes;
+    std::atomic<uint64_t> _wasted_count;
+};
+
 struct pegasus_scan_context
 {
     pegasus_scan_context(std::unique_ptr<rocksdb::Iterator> &&iterator_,
@@ -25,11 +112,17 @@ struct pegasus_scan_context
                          const std::string &&hash_key_filter_pattern_,
                          ::dsn::apps::filter_type::type sort_key_filter_type_,
                          const std::string &&sort_key_filter_pattern_,
+                         ::dsn::apps::filter_type::type value_filter_type_,
+                         const std::string &&value_filter_pattern_,
                          int32_t batch_size_,
-                         bool no_value_)
+                         int64_t max_batch_bytes_,
+                         int64_t max_batch_time_us_,
+                         bool no_value_,
+                         bool reverse_)
         : _stop_holder(std::move(stop_)),
           _hash_key_filter_pattern_holder(std::move(hash_key_filter_pattern_)),
           _sort_key_filter_pattern_holder(std::move(sort_key_filter_pattern_)),
+          _value_filter_pattern_holder(std::move(value_filter_pattern_)),
           iterator(std::move(iterator_)),
           stop(_stop_holder.data(), _stop_holder.size()),
           stop_inclusive(stop_inclusive_),
@@ -39,15 +132,29 @@ struct pegasus_scan_context
           sort_key_filter_type(sort_key_filter_type_),
           sort_key_filter_pattern(
               _sort_key_filter_pattern_holder.data(), 0, _sort_key_filter_pattern_holder.length()),
+          value_filter_type(value_filter_type_),
+          value_filter_pattern(
+              _value_filter_pattern_holder.data(), 0, _value_filter_pattern_holder.length()),
           batch_size(batch_size_),
-          no_value(no_value_)
+          max_batch_bytes(max_batch_bytes_),
+          max_batch_time_us(max_batch_time_us_),
+          no_value(no_value_),
+          reverse(reverse_)
+    {
+    }
+
+    ~pegasus_scan_context()
     {
+        if (prefetched) {
+            prefetch_quota->release(prefetched->bytes, true);
+        }
     }
 
 private:
     std::string _stop_holder;
     std::string _hash_key_filter_pattern_holder;
     std::string _sort_key_filter_pattern_holder;
+    std::string _value_filter_pattern_holder;
 
 public:
     std::unique_ptr<rocksdb::Iterator> iterator;
@@ -57,14 +164,33 @@ public:
     dsn::blob hash_key_filter_pattern;
     ::dsn::apps::filter_type::type sort_key_filter_type;
     dsn::blob sort_key_filter_pattern;
+    ::dsn::apps::filter_type::type value_filter_type;
+    dsn::blob value_filter_pattern;
     int32_t batch_size;
+    int64_t max_batch_bytes;   // <= 0 means no limit
+    int64_t max_batch_time_us; // <= 0 means no limit
     bool no_value;
+    // iterate in descending order, in which case `stop` is the smallest key of the range
+    bool reverse;
+    // only set for aggregate_scan
+    std::unique_ptr<pegasus_scan_aggregator> aggregator;
+
+    // the following are only used when prefetch is enabled for this context, which is shared
+    // with the prefetch task until the task is done, `prefetching` and `prefetched` are
+    // protected by `prefetch_lock`
+    std::shared_ptr<pegasus_scan_prefetch_quota> prefetch_quota;
+    ::dsn::utils::ex_lock_nr_spin prefetch_lock;
+    bool prefetching{false};
+    std::unique_ptr<pegasus_scan_batch> prefetched;
 };
 
+// Cache of scan contexts, which is sharded to reduce lock contention between concurrent scans.
+// Each shard keeps its contexts in order of put time, so the expired contexts can be swept from
+// the tail by a periodic task, and the oldest contexts will be evicted if the count exceeds limit.
 class pegasus_context_cache
 {
 public:
-    pegasus_context_cache()
+    pegasus_context_cache() : _max_count_per_shard(0), _expire_ms(5 * 60 * 1000)
     {
         // some comments:
         // 1. we should keep the context id unique when the server restarts, so as to prevent
@@ -77,39 +203,138 @@ public:
         //
         // however, currently the implementation is not 100% correct.
         //
-        _counter = dsn::rand::next_u64(0, 2L << 31);
-        _counter <<= 32;
+        int64_t counter = dsn::rand::next_u64(0, 2L << 31);
+        _counter = counter << 32;
+    }
+
+    // `max_count` is the max count of contexts in this cache, 0 means no limit.
+    void set_limits(uint32_t max_count, uint32_t expire_seconds)
+    {
+        _max_count_per_shard = (max_count + SHARD_COUNT - 1) / SHARD_COUNT;
+        _expire_ms = expire_seconds * 1000ULL;
     }
 
     void clear()
     {
-        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
-        _map.clear();
+        for (shard &s : _shards) {
+            std::unordered_map<int64_t, entry> m;
+            {
+                ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+                m.swap(s.map);
+                s.lru.clear();
+            }
+        }
     }
 
-    int64_t put(std::unique_ptr<pegasus_scan_context> context)
+    int64_t put(std::shared_ptr<pegasus_scan_context> context)
     {
-        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
         int64_t handle = _counter++;
-        _map[handle] = std::move(context);
+        shard &s = get_shard(handle);
+        std::vector<std::shared_ptr<pegasus_scan_context>> evicted;
+        {
+            ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+            s.lru.push_front(handle);
+            entry &e = s.map[handle];
+            e.context = std::move(context);
+            e.expire_time_ms = dsn_now_ms() + _expire_ms;
+            e.lru_it = s.lru.begin();
+
+            uint32_t max_count = _max_count_per_shard.load(std::memory_order_relaxed);
+            while (max_count > 0 && s.map.size() > max_count) {
+                evicted.emplace_back(pop_oldest(s));
+            }
+        }
+        _evict_count += evicted.size();
+        // the evicted contexts are destroyed out of the lock, because releasing the rocksdb
+        // iterators may be time-consuming
         return handle;
     }
 
-    std::unique_ptr<pegasus_scan_context> fetch(int64_t handle)
+    std::shared_ptr<pegasus_scan_context> fetch(int64_t handle)
     {
-        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
-        auto kv = _map.find(handle);
-        if (kv == _map.end())
+        shard &s = get_shard(handle);
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+        auto kv = s.map.find(handle);
+        if (kv == s.map.end())
             return nullptr;
-        std::unique_ptr<pegasus_scan_context> ret = std::move(kv->second);
-        _map.erase(kv);
+        std::shared_ptr<pegasus_scan_context> ret = std::move(kv->second.context);
+        s.lru.erase(kv->second.lru_it);
+        s.map.erase(kv);
+        return ret;
+    }
+
+    // Removes the contexts which have not been fetched for `expire_seconds`.
+    // \return the count of removed contexts.
+    uint64_t sweep_expired()
+    {
+        uint64_t now_ms = dsn_now_ms();
+        uint64_t count = 0;
+        for (shard &s : _shards) {
+            std::vector<std::shared_ptr<pegasus_scan_context>> expired;
+            {
+                ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+                while (!s.lru.empty() &&
+                       s.map.find(s.lru.back())->second.expire_time_ms <= now_ms) {
+                    expired.emplace_back(pop_oldest(s));
+                }
+            }
+            count += expired.size();
+        }
+        return count;
+    }
+
+    size_t size()
+    {
+        size_t count = 0;
+        for (shard &s : _shards) {
+            ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+            count += s.map.size();
+        }
+        return count;
+    }
+
+    // \return the count of contexts evicted since last call.
+    uint64_t fetch_evict_count() { return _evict_count.exchange(0); }
+
+private:
+    static const int SHARD_COUNT = 16;
+
+    struct entry
+    {
+        std::shared_ptr<pegasus_scan_context> context;
+        uint64_t expire_time_ms;
+        std::list<int64_t>::iterator lru_it;
+    };
+
+    struct shard
+    {
+        ::dsn::utils::ex_lock_nr_spin lock;
+        std::unordered_map<int64_t, entry> map;
+        // handles in order of put time, the front is the latest
+        std::list<int64_t> lru;
+    };
+
+    shard &get_shard(int64_t handle)
+    {
+        return _shards[static_cast<uint64_t>(handle) % SHARD_COUNT];
+    }
+
+    // requires the lock of `s` being held
+    static std::shared_ptr<pegasus_scan_context> pop_oldest(shard &s)
+    {
+        auto kv = s.map.find(s.lru.back());
+        std::shared_ptr<pegasus_scan_context> ret = std::move(kv->second.context);
+        s.map.erase(kv);
+        s.lru.pop_back();
         return ret;
     }
 
 private:
-    int64_t _counter;
-    std::unordered_map<int64_t, std::unique_ptr<pegasus_scan_context>> _map;
-    ::dsn::utils::ex_lock_nr_spin _lock;
+    std::atomic<int64_t> _counter;
+    std::atomic<uint32_t> _max_count_per_shard;
+    uint64_t _expire_ms;
+    std::atomic<uint64_t> _evict_count{0};
+    shard _shards[SHARD_COUNT];
 };
 }
 }
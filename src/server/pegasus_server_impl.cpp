@@ -5,6 +5,7 @@
 #include "pegasus_server_impl.h"
 
 #include <algorithm>
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/lexical_cast.hpp>
 #include <rocksdb/convenience.h>
 #include <rocksdb/utilities/checkpoint.h>
@@ -19,10 +20,15 @@
 #include "base/pegasus_key_schema.h"
 #include "base/pegasus_value_schema.h"
 #include "base/pegasus_utils.h"
+#include "base/pegasus_sst_builder.h"
 #include "capacity_unit_calculator.h"
 #include "hashkey_transform.h"
 #include "pegasus_event_listener.h"
+#include "pegasus_merge_operator.h"
 #include "pegasus_server_write.h"
+#include "sortkey_count_meta.h"
+#include "ttl_table_properties_collector.h"
+#include "read_perf_context.h"
 
 using namespace dsn::literals::chrono_literals;
 
@@ -30,6 +36,7 @@ namespace pegasus {
 namespace server {
 
 DEFINE_TASK_CODE(LPC_PEGASUS_SERVER_DELAY, TASK_PRIORITY_COMMON, ::dsn::THREAD_POOL_DEFAULT)
+DEFINE_TASK_CODE(LPC_PEGASUS_SCAN_PREFETCH, TASK_PRIORITY_LOW, THREAD_POOL_LOCAL_APP)
 
 static std::string chkpt_get_dir_name(int64_t decree)
 {
@@ -45,9 +52,41 @@ static bool chkpt_init_from_dir(const char *name, int64_t &decree)
 }
 
 std::shared_ptr<rocksdb::Cache> pegasus_server_impl::_s_block_cache;
+std::shared_ptr<rocksdb::Cache> pegasus_server_impl::_s_row_cache;
+std::shared_ptr<rocksdb::PersistentCache> pegasus_server_impl::_s_persistent_cache;
+double pegasus_server_impl::_s_block_cache_high_pri_pool_ratio = 0;
+uint64_t pegasus_server_impl::_s_block_cache_capacity = 0;
+std::mutex pegasus_server_impl::_s_app_block_caches_lock;
+std::map<int32_t, pegasus_server_impl::app_block_cache> pegasus_server_impl::_s_app_block_caches;
+uint64_t pegasus_server_impl::_s_app_block_caches_capacity = 0;
 ::dsn::task_ptr pegasus_server_impl::_update_server_rdb_stat;
 ::dsn::perf_counter_wrapper pegasus_server_impl::_pfc_rdb_block_cache_mem_usage;
+::dsn::perf_counter_wrapper pegasus_server_impl::_pfc_rdb_block_cache_pinned_usage;
+::dsn::perf_counter_wrapper pegasus_server_impl::_pfc_rdb_row_cache_mem_usage;
+::dsn::perf_counter_wrapper pegasus_server_impl::_pfc_rdb_persistent_cache_write_bytes;
 const std::string pegasus_server_impl::COMPRESSION_HEADER = "per_level:";
+const int64_t pegasus_server_impl::DEADLINE_CHECK_INTERVAL = 64;
+const std::string pegasus_server_impl::DEADLINE_ERROR_HINT = "past the client deadline";
+
+void pegasus_server_impl::init_batch_write_codes()
+{
+    // Batching is decided by the primary, and the batched mutations are applied by all the
+    // replicas, so it can be enabled only after all the servers are upgraded to handle them.
+    bool batch_multi_writes_and_incr = dsn_config_get_value_bool(
+        "pegasus.server",
+        "batch_multi_writes_and_incr",
+        false,
+        "whether to batch MULTI_PUT, MULTI_REMOVE, INCR and MULTI_INCR with other writes "
+        "into one mutation, enable it only after all the replica servers are upgraded");
+    if (batch_multi_writes_and_incr) {
+        for (dsn::task_code code : {dsn::apps::RPC_RRDB_RRDB_MULTI_PUT,
+                                    dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE,
+                                    dsn::apps::RPC_RRDB_RRDB_INCR,
+                                    dsn::apps::RPC_RRDB_RRDB_MULTI_INCR}) {
+            dsn::task_spec::get(code)->rpc_request_is_write_allow_batch = true;
+        }
+    }
+}
 
 pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
     : dsn::apps::rrdb_service(r),
@@ -55,9 +94,10 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
       _is_open(false),
       _pegasus_data_version(PEGASUS_DATA_VERSION_MAX),
       _last_durable_decree(0),
+      _last_applied_write_time_us(0),
       _is_checkpointing(false),
       _manual_compact_svc(this),
-      _partition_version(0)
+      _partition_version(-1)
 {
     _primary_address = dsn::rpc_address(dsn_primary_address()).to_string();
     _gpid = get_gpid();
@@ -72,6 +112,36 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
         100000000,
         "get/multi-get operation duration exceed this threshold will be logged");
     _slow_query_threshold_ns = _slow_query_threshold_ns_in_config;
+    _request_deadline_skew_ms = dsn_config_get_value_int64(
+        "pegasus.server",
+        "request_deadline_skew_ms",
+        3000,
+        "read requests are dropped or truncated only if they have been past the client deadline "
+        "for longer than this, to tolerate the clock skew between the client and the server");
+    // the deadline is measured by the clock of the client, so a skew smaller than the accuracy
+    // of clock synchronization would drop valid requests.
+    if (_request_deadline_skew_ms < 1000) {
+        dwarn("request_deadline_skew_ms(%" PRId64 ") is too small, clamp it to 1000",
+              _request_deadline_skew_ms);
+        _request_deadline_skew_ms = 1000;
+    }
+    _validate_partition_hash = dsn_config_get_value_bool(
+        "pegasus.server",
+        "validate_partition_hash",
+        false,
+        "whether to reject the read requests of keys not belonging to this partition and drop "
+        "such records in compaction, which should be enabled only if partition split is used");
+    _allow_secondary_read = dsn_config_get_value_bool(
+        "pegasus.server",
+        "allow_secondary_read",
+        false,
+        "whether the reads reaching secondaries are served, which may return stale data");
+    _secondary_read_max_staleness_ms = dsn_config_get_value_int64(
+        "pegasus.server",
+        "secondary_read_max_staleness_ms",
+        10000,
+        "secondaries reject reads if the last write applied was prepared by the primary longer "
+        "than this ago, only used if allow_secondary_read is true");
     dassert(_slow_query_threshold_ns > 0, "slow query threshold must be greater than 0");
     _abnormal_get_size_threshold = dsn_config_get_value_uint64(
         "pegasus.server",
@@ -176,6 +246,14 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
                                     10,
                                     "rocksdb options.rocksdb_max_bytes_for_level_multiplier");
 
+    _data_cf_opts.compaction_options_fifo.max_table_files_size = dsn_config_get_value_uint64(
+        "pegasus.server",
+        "rocksdb_fifo_max_table_files_size",
+        1024 * 1024 * 1024 * 1024ULL,
+        "rocksdb options.compaction_options_fifo.max_table_files_size for the 'time_series' usage "
+        "scenario, the oldest files are dropped even if not expired once the total size exceeds "
+        "it");
+
     // we need set max_compaction_bytes definitely because set_usage_scenario() depends on it.
     _data_cf_opts.max_compaction_bytes = _data_cf_opts.target_file_size_base * 25;
 
@@ -208,13 +286,12 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
     dassert(parse_compression_types(compression_str, _data_cf_opts.compression_per_level),
             "parse rocksdb_compression_type failed.");
 
-    rocksdb::BlockBasedTableOptions tbl_opts;
     if (dsn_config_get_value_bool("pegasus.server",
                                   "rocksdb_disable_table_block_cache",
                                   false,
                                   "rocksdb tbl_opts.no_block_cache")) {
-        tbl_opts.no_block_cache = true;
-        tbl_opts.block_restart_interval = 4;
+        _tbl_opts.no_block_cache = true;
+        _tbl_opts.block_restart_interval = 4;
     } else {
         // If block cache is enabled, all replicas on this server will share the same block cache
         // object. It's convenient to control the total memory used by this server, and the LRU
@@ -234,19 +311,135 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
                 -1,
                 "block cache will be sharded into 2^num_shard_bits shards");
 
+            // ratio of block cache reserved for high priority blocks, that is, index and filter
+            // blocks if they are cached with high priority
+            _s_block_cache_high_pri_pool_ratio = dsn_config_get_value_double(
+                "pegasus.server",
+                "rocksdb_block_cache_high_pri_pool_ratio",
+                0.5,
+                "ratio of block cache reserved for index and filter blocks");
+
             // init block cache
-            _s_block_cache = rocksdb::NewLRUCache(capacity, num_shard_bits);
+            _s_block_cache_capacity = capacity;
+            _s_block_cache = rocksdb::NewLRUCache(
+                capacity, num_shard_bits, false, _s_block_cache_high_pri_pool_ratio);
         });
 
         // every replica has the same block cache
-        tbl_opts.block_cache = _s_block_cache;
+        _tbl_opts.block_cache = _s_block_cache;
+        _block_cache = _s_block_cache;
+
+        // Persistent cache is the secondary cache tier on a local fast disk behind the block
+        // cache, which keeps compressed blocks read from sst files, so that working sets larger
+        // than memory can be served without reading the data disks. Like block cache, it is
+        // shared by all replicas on this server.
+        static std::once_flag persistent_cache_flag;
+        std::call_once(persistent_cache_flag, [&]() {
+            std::string path = dsn_config_get_value_string(
+                "pegasus.server",
+                "rocksdb_persistent_cache_path",
+                "",
+                "path of persistent cache on a local fast disk, empty means persistent cache is "
+                "disabled");
+            if (path.empty()) {
+                return;
+            }
+
+            uint64_t capacity = dsn_config_get_value_uint64(
+                "pegasus.server",
+                "rocksdb_persistent_cache_capacity",
+                100 * 1024 * 1024 * 1024ULL,
+                "persistent cache capacity for one pegasus server, shared by all rocksdb "
+                "instances");
+
+            bool optimized_for_nvm = dsn_config_get_value_bool(
+                "pegasus.server",
+                "rocksdb_persistent_cache_optimized_for_nvm",
+                false,
+                "whether to access persistent cache with direct io, which suits nvm devices");
+
+            dassert(::dsn::utils::filesystem::create_directory(path),
+                    "create persistent cache dir %s failed",
+                    path.c_str());
+            rocksdb::Status status = rocksdb::NewPersistentCache(rocksdb::Env::Default(),
+                                                                 path,
+                                                                 capacity,
+                                                                 nullptr,
+                                                                 optimized_for_nvm,
+                                                                 &_s_persistent_cache);
+            dassert(status.ok(),
+                    "create persistent cache on %s failed: %s",
+                    path.c_str(),
+                    status.ToString().c_str());
+        });
+        _tbl_opts.persistent_cache = _s_persistent_cache;
+
+        // Index and filter blocks are held in memory by table readers by default, whose memory
+        // usage grows with the data size. Partitioning them into two levels and caching the
+        // partitions in block cache bounds the memory usage by block cache capacity, only the
+        // small top-level index and filter are held by table readers.
+        bool partition_index_and_filters =
+            dsn_config_get_value_bool("pegasus.server",
+                                      "rocksdb_partition_index_and_filters",
+                                      false,
+                                      "whether to use two-level partitioned index and filters");
+        if (partition_index_and_filters) {
+            _tbl_opts.index_type = rocksdb::BlockBasedTableOptions::kTwoLevelIndexSearch;
+            _tbl_opts.partition_filters = true;
+            _tbl_opts.metadata_block_size = dsn_config_get_value_uint64(
+                "pegasus.server",
+                "rocksdb_metadata_block_size",
+                4096,
+                "block size of the partitions of index and filters");
+        }
+        _tbl_opts.cache_index_and_filter_blocks =
+            partition_index_and_filters ||
+            dsn_config_get_value_bool("pegasus.server",
+                                      "rocksdb_cache_index_and_filter_blocks",
+                                      false,
+                                      "whether to cache index and filter blocks in block cache, "
+                                      "always true if rocksdb_partition_index_and_filters is true");
+        if (_tbl_opts.cache_index_and_filter_blocks) {
+            // index and filter blocks are much more valuable than data blocks, keep them in the
+            // high priority pool of block cache, and pin those of L0 which are accessed by every
+            // read.
+            _tbl_opts.cache_index_and_filter_blocks_with_high_priority = true;
+            _tbl_opts.pin_l0_filter_and_index_blocks_in_cache = true;
+        }
     }
 
+    // Row cache caches the results of point lookups (get, ttl and multi_get by sort keys), so hot
+    // keys can be served without searching and decoding data blocks. Like block cache, it is
+    // shared by all replicas on this server. Entries are keyed by sst file and user key, so
+    // they never become stale after writes, and there is no need to invalidate them explicitly.
+    static std::once_flag row_cache_flag;
+    std::call_once(row_cache_flag, [&]() {
+        uint64_t capacity = dsn_config_get_value_uint64(
+            "pegasus.server",
+            "rocksdb_row_cache_capacity",
+            0,
+            "row cache capacity for one pegasus server, shared by all rocksdb instances, 0 means "
+            "row cache is disabled");
+
+        // row cache num shard bits, default -1(auto)
+        int num_shard_bits = (int)dsn_config_get_value_int64(
+            "pegasus.server",
+            "rocksdb_row_cache_num_shard_bits",
+            -1,
+            "row cache will be sharded into 2^num_shard_bits shards");
+
+        if (capacity > 0) {
+            _s_row_cache = rocksdb::NewLRUCache(capacity, num_shard_bits);
+        }
+    });
+    _db_opts.row_cache = _s_row_cache;
+
     // Bloom filter configurations.
     bool disable_bloom_filter = dsn_config_get_value_bool(
         "pegasus.server", "rocksdb_disable_bloom_filter", false, "Whether to disable bloom filter");
     if (!disable_bloom_filter) {
-        tbl_opts.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10, false));
+        // full filter is required by partitioned filters
+        _tbl_opts.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10, false));
 
         std::string filter_type =
             dsn_config_get_value_string("pegasus.server",
@@ -260,14 +453,40 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
             _data_cf_opts.memtable_prefix_bloom_size_ratio = 0.1;
 
             _data_cf_rd_opts.prefix_same_as_start = true;
+
+            // With prefix filtering, the filter contains hashkeys for multi_get and scan, and
+            // also whole keys for get if whole key filtering is enabled, at the cost of a larger
+            // filter.
+            _tbl_opts.whole_key_filtering = dsn_config_get_value_bool(
+                "pegasus.server",
+                "rocksdb_filter_whole_key",
+                true,
+                "whether to add whole keys into the prefix bloom filter for point gets");
         }
     }
 
-    _data_cf_opts.table_factory.reset(NewBlockBasedTableFactory(tbl_opts));
+    _data_cf_opts.table_factory.reset(NewBlockBasedTableFactory(_tbl_opts));
 
     _key_ttl_compaction_filter_factory = std::make_shared<KeyWithTTLCompactionFilterFactory>();
     _data_cf_opts.compaction_filter_factory = _key_ttl_compaction_filter_factory;
 
+    // the merge operands written by blind incr can not be read without the merge operator, so
+    // blind incr must not be disabled once used.
+    _enable_blind_incr = dsn_config_get_value_bool(
+        "pegasus.server",
+        "enable_blind_incr",
+        false,
+        "whether incr requested as blind is applied by rocksdb merge without reading the old "
+        "value, which can not be disabled once used, otherwise blind incr reads the old value");
+    if (_enable_blind_incr) {
+        _data_cf_opts.merge_operator = std::make_shared<pegasus_merge_operator>();
+    }
+
+    // collect expire_ts range of sst files to drop or skip the fully expired ones.
+    _ttl_properties_collector_factory = std::make_shared<ttl_table_properties_collector_factory>();
+    _data_cf_opts.table_properties_collector_factories.emplace_back(
+        _ttl_properties_collector_factory);
+
     // get the checkpoint reserve options.
     _checkpoint_reserve_min_count_in_config = (uint32_t)dsn_config_get_value_uint64(
         "pegasus.server", "checkpoint_reserve_min_count", 2, "checkpoint_reserve_min_count");
@@ -282,6 +501,46 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
     _update_rdb_stat_interval = std::chrono::seconds(dsn_config_get_value_uint64(
         "pegasus.server", "update_rdb_stat_interval", 600, "update_rdb_stat_interval, in seconds"));
 
+    // scan context cache options.
+    uint32_t scan_context_max_count = (uint32_t)dsn_config_get_value_uint64(
+        "pegasus.server",
+        "scan_context_max_count",
+        10000,
+        "max count of scan contexts kept by one replica, the oldest ones will be evicted if "
+        "exceeded, 0 means no limit");
+    uint32_t scan_context_expire_seconds =
+        (uint32_t)dsn_config_get_value_uint64("pegasus.server",
+                                              "scan_context_expire_seconds",
+                                              300,
+                                              "scan context will be removed if not used for "
+                                              "this time, in seconds");
+    _context_cache.set_limits(scan_context_max_count, scan_context_expire_seconds);
+    _scan_context_sweep_interval = std::chrono::seconds(
+        dsn_config_get_value_uint64("pegasus.server",
+                                    "scan_context_sweep_interval_seconds",
+                                    10,
+                                    "interval to remove expired scan contexts, in seconds"));
+    _scan_prefetch_quota = std::make_shared<pegasus_scan_prefetch_quota>();
+    _scan_prefetch_quota->set_max_bytes(dsn_config_get_value_int64(
+        "pegasus.server",
+        "scan_prefetch_max_bytes",
+        16 * 1024 * 1024,
+        "max bytes of scan batches prefetched by one replica for the scanners which enable "
+        "prefetch, 0 means prefetch is disabled"));
+    _scan_prefetch_batch_bytes = dsn_config_get_value_int64(
+        "pegasus.server",
+        "scan_prefetch_batch_bytes",
+        1024 * 1024,
+        "max bytes of one prefetched scan batch, which are reserved from "
+        "scan_prefetch_max_bytes before prefetching");
+
+    _drop_expired_sst_interval = std::chrono::seconds(dsn_config_get_value_uint64(
+        "pegasus.server",
+        "drop_expired_sst_interval_seconds",
+        600,
+        "interval to drop the sst files whose records are all expired, in seconds, 0 means "
+        "disabled"));
+
     // TODO: move the qps/latency counters and it's statistics to replication_app_base layer
     std::string str_gpid = _gpid.to_string();
     char name[256];
@@ -295,10 +554,18 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
     _pfc_multi_get_qps.init_app_counter(
         "app.pegasus", name, COUNTER_TYPE_RATE, "statistic the qps of MULTI_GET request");
 
+    snprintf(name, 255, "batch_get_qps@%s", str_gpid.c_str());
+    _pfc_batch_get_qps.init_app_counter(
+        "app.pegasus", name, COUNTER_TYPE_RATE, "statistic the qps of BATCH_GET request");
+
     snprintf(name, 255, "scan_qps@%s", str_gpid.c_str());
     _pfc_scan_qps.init_app_counter(
         "app.pegasus", name, COUNTER_TYPE_RATE, "statistic the qps of SCAN request");
 
+    snprintf(name, 255, "aggregate_scan_qps@%s", str_gpid.c_str());
+    _pfc_aggregate_scan_qps.init_app_counter(
+        "app.pegasus", name, COUNTER_TYPE_RATE, "statistic the qps of AGGREGATE_SCAN request");
+
     snprintf(name, 255, "get_latency@%s", str_gpid.c_str());
     _pfc_get_latency.init_app_counter("app.pegasus",
                                       name,
@@ -311,18 +578,38 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
                                             COUNTER_TYPE_NUMBER_PERCENTILES,
                                             "statistic the latency of MULTI_GET request");
 
+    snprintf(name, 255, "batch_get_latency@%s", str_gpid.c_str());
+    _pfc_batch_get_latency.init_app_counter("app.pegasus",
+                                            name,
+                                            COUNTER_TYPE_NUMBER_PERCENTILES,
+                                            "statistic the latency of BATCH_GET request");
+
     snprintf(name, 255, "scan_latency@%s", str_gpid.c_str());
     _pfc_scan_latency.init_app_counter("app.pegasus",
                                        name,
                                        COUNTER_TYPE_NUMBER_PERCENTILES,
                                        "statistic the latency of SCAN request");
 
+    snprintf(name, 255, "aggregate_scan_latency@%s", str_gpid.c_str());
+    _pfc_aggregate_scan_latency.init_app_counter("app.pegasus",
+                                                 name,
+                                                 COUNTER_TYPE_NUMBER_PERCENTILES,
+                                                 "statistic the latency of AGGREGATE_SCAN request");
+
     snprintf(name, 255, "recent.expire.count@%s", str_gpid.c_str());
     _pfc_recent_expire_count.init_app_counter("app.pegasus",
                                               name,
                                               COUNTER_TYPE_VOLATILE_NUMBER,
                                               "statistic the recent expired value read count");
 
+    snprintf(name, 255, "recent.sortkey_count.read.count@%s", str_gpid.c_str());
+    _pfc_recent_sortkey_count_read_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of reads by the write path to maintain the sortkey_count "
+        "metadata");
+
     snprintf(name, 255, "recent.filter.count@%s", str_gpid.c_str());
     _pfc_recent_filter_count.init_app_counter("app.pegasus",
                                               name,
@@ -335,6 +622,100 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
                                                 COUNTER_TYPE_VOLATILE_NUMBER,
                                                 "statistic the recent abnormal read count");
 
+    snprintf(name, 255, "recent.read.shed.count@%s", str_gpid.c_str());
+    _pfc_recent_read_shed_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of read requests dropped as past the client deadline");
+
+    snprintf(name, 255, "recent.read.truncate.count@%s", str_gpid.c_str());
+    _pfc_recent_read_truncate_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of read requests replied partially as past the client "
+        "deadline");
+
+    snprintf(name, 255, "compaction_style.fallback.count@%s", str_gpid.c_str());
+    _pfc_compaction_style_fallback_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_NUMBER,
+        "statistic the count of opening rocksdb with level compaction because the compaction "
+        "style of the usage scenario can not open it");
+
+    snprintf(name, 255, "recent.bulk_ingest.file.count@%s", str_gpid.c_str());
+    _pfc_recent_bulk_ingest_file_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of sst files ingested by bulk ingestion");
+
+    _get_perf_counters.init("get", str_gpid);
+    _multi_get_perf_counters.init("multi_get", str_gpid);
+    _scan_perf_counters.init("scan", str_gpid);
+
+    snprintf(name, 255, "scan_context.count@%s", str_gpid.c_str());
+    _pfc_scan_context_count.init_app_counter(
+        "app.pegasus", name, COUNTER_TYPE_NUMBER, "statistic the count of alive scan contexts");
+
+    snprintf(name, 255, "recent.scan_context.evict.count@%s", str_gpid.c_str());
+    _pfc_recent_scan_context_evict_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of scan contexts evicted as exceeding the max count");
+
+    snprintf(name, 255, "recent.scan_context.expire.count@%s", str_gpid.c_str());
+    _pfc_recent_scan_context_expire_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of scan contexts removed as not used for a long time");
+
+    snprintf(name, 255, "recent.scan_prefetch.hit.count@%s", str_gpid.c_str());
+    _pfc_recent_scan_prefetch_hit_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of scan batches replied from prefetched data");
+
+    snprintf(name, 255, "recent.scan_prefetch.waste.count@%s", str_gpid.c_str());
+    _pfc_recent_scan_prefetch_waste_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of prefetched scan batches dropped without being replied");
+
+    snprintf(name, 255, "scan_prefetch.memory_usage@%s", str_gpid.c_str());
+    _pfc_scan_prefetch_mem_usage.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_NUMBER,
+        "statistic the memory usage of prefetched scan batches");
+
+    snprintf(name, 255, "recent.expired_sst.drop.count@%s", str_gpid.c_str());
+    _pfc_recent_expired_sst_drop_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent count of sst files dropped as all records expired");
+
+    snprintf(name, 255, "recent.expired_sst.drop.size@%s", str_gpid.c_str());
+    _pfc_recent_expired_sst_drop_size.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent size of sst files dropped as all records expired, in bytes");
+
+    snprintf(name, 255, "expired_sst.skippable.count@%s", str_gpid.c_str());
+    _pfc_skippable_sst_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_NUMBER,
+        "statistic the count of sst files which will be skipped by scans once expired");
+
     snprintf(name, 255, "disk.storage.sst.count@%s", str_gpid.c_str());
     _pfc_rdb_sst_count.init_app_counter(
         "app.pegasus", name, COUNTER_TYPE_NUMBER, "statistic the count of sstable files");
@@ -354,8 +735,38 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
         COUNTER_TYPE_NUMBER,
         "statistic the total count of rocksdb block cache");
 
-    // Block cache is a singleton on this server shared by all replicas, so we initialize
-    // `_pfc_rdb_block_cache_mem_usage` only once.
+    snprintf(name, 255, "rdb.block_cache.table_memory_usage@%s", str_gpid.c_str());
+    _pfc_rdb_block_cache_table_mem_usage.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_NUMBER,
+        "statistic the memory usage of the block cache dedicated to this table, 0 if the table "
+        "uses the block cache shared by all tables");
+
+    snprintf(name, 255, "rdb.persistent_cache.hit_count@%s", str_gpid.c_str());
+    _pfc_rdb_persistent_cache_hit_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_NUMBER,
+        "statistic the hit count of rocksdb persistent cache");
+
+    snprintf(name, 255, "rdb.persistent_cache.total_count@%s", str_gpid.c_str());
+    _pfc_rdb_persistent_cache_total_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_NUMBER,
+        "statistic the total count of rocksdb persistent cache");
+
+    snprintf(name, 255, "rdb.row_cache.hit_count@%s", str_gpid.c_str());
+    _pfc_rdb_row_cache_hit_count.init_app_counter(
+        "app.pegasus", name, COUNTER_TYPE_NUMBER, "statistic the hit count of rocksdb row cache");
+
+    snprintf(name, 255, "rdb.row_cache.total_count@%s", str_gpid.c_str());
+    _pfc_rdb_row_cache_total_count.init_app_counter(
+        "app.pegasus", name, COUNTER_TYPE_NUMBER, "statistic the total count of rocksdb row cache");
+
+    // Block cache and row cache are singletons on this server shared by all replicas, so we
+    // initialize `_pfc_rdb_block_cache_mem_usage` and `_pfc_rdb_row_cache_mem_usage` only once.
     static std::once_flag flag;
     std::call_once(flag, [&]() {
         _pfc_rdb_block_cache_mem_usage.init_global_counter(
@@ -364,6 +775,24 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
             "rdb.block_cache.memory_usage",
             COUNTER_TYPE_NUMBER,
             "statistic the memory usage of rocksdb block cache");
+        _pfc_rdb_block_cache_pinned_usage.init_global_counter(
+            "replica",
+            "app.pegasus",
+            "rdb.block_cache.pinned_usage",
+            COUNTER_TYPE_NUMBER,
+            "statistic the memory of rocksdb block cache pinned by iterators and readers");
+        _pfc_rdb_row_cache_mem_usage.init_global_counter(
+            "replica",
+            "app.pegasus",
+            "rdb.row_cache.memory_usage",
+            COUNTER_TYPE_NUMBER,
+            "statistic the memory usage of rocksdb row cache");
+        _pfc_rdb_persistent_cache_write_bytes.init_global_counter(
+            "replica",
+            "app.pegasus",
+            "rdb.persistent_cache.write_bytes",
+            COUNTER_TYPE_NUMBER,
+            "statistic the total bytes written into rocksdb persistent cache");
     });
 
     snprintf(name, 255, "rdb.index_and_filter_blocks.memory_usage@%s", str_gpid.c_str());
@@ -567,27 +996,53 @@ int pegasus_server_impl::on_batched_write_requests(int64_t decree,
     dassert(_is_open, "");
     dassert(requests != nullptr, "");
 
+    _last_applied_write_time_us.store(timestamp);
+
     return _server_write->on_batched_write_requests(requests, count, decree, timestamp);
 }
 
+int pegasus_server_impl::on_request(dsn::message_ex *request)
+{
+    if (!is_primary() && !can_serve_secondary_read()) {
+        dsn_rpc_reply(request->create_response(), ::dsn::ERR_INVALID_STATE);
+        return 0;
+    }
+    return dsn::apps::rrdb_service::on_request(request);
+}
+
 void pegasus_server_impl::on_get(const ::dsn::blob &key,
                                  ::dsn::rpc_replier<::dsn::apps::read_response> &reply)
 {
     dassert(_is_open, "");
     _pfc_get_qps->increment();
     uint64_t start_time = dsn_now_ns();
+    read_perf_context perf_ctx;
 
     ::dsn::apps::read_response resp;
     resp.app_id = _gpid.get_app_id();
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
+    if (!check_key_hash(key)) {
+        dwarn("%s: invalid argument for get from %s: key does not belong to this partition",
+              replica_name(),
+              reply.to_address().to_string());
+        resp.error = rocksdb::Status::kInvalidArgument;
+        _cu_calculator->add_get_cu(resp.error, resp.value);
+        _pfc_get_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
+
     rocksdb::Slice skey(key.data(), key.length());
-    std::string value;
-    rocksdb::Status status = _db->Get(_data_cf_rd_opts, skey, &value);
+    // read into PinnableSlice to reference the value in block cache without copying,
+    // it is allocated on heap because its ownership will be transferred to the response
+    std::unique_ptr<rocksdb::PinnableSlice> value = dsn::make_unique<rocksdb::PinnableSlice>();
+    rocksdb::Status status =
+        _db->Get(_data_cf_rd_opts, _db->DefaultColumnFamily(), skey, value.get());
 
     if (status.ok()) {
-        if (check_if_record_expired(utils::epoch_now(), value)) {
+        if (check_if_record_expired(utils::epoch_now(), *value)) {
             _pfc_recent_expire_count->increment();
             if (_verbose_log) {
                 derror("%s: rocksdb data expired for get from %s",
@@ -624,19 +1079,25 @@ void pegasus_server_impl::on_get(const ::dsn::blob &key,
 #endif
 
     uint64_t time_used = dsn_now_ns() - start_time;
-    if (is_get_abnormal(time_used, value.size())) {
+    read_perf_stat perf_stat = perf_ctx.stat();
+    _get_perf_counters.add(perf_stat);
+    if (is_get_abnormal(time_used, value->size())) {
         ::dsn::blob hash_key, sort_key;
         pegasus_restore_key(key, hash_key, sort_key);
         dwarn_replica("rocksdb abnormal get from {}: "
                       "hash_key = {}, sort_key = {}, return = {}, "
-                      "value_size = {}, time_used = {} ns",
+                      "value_size = {}, time_used = {} ns, {}",
                       reply.to_address().to_string(),
                       ::pegasus::utils::c_escape_string(hash_key),
                       ::pegasus::utils::c_escape_string(sort_key),
                       status.ToString(),
-                      value.size(),
-                      time_used);
+                      value->size(),
+                      time_used,
+                      perf_stat.to_string());
         _pfc_recent_abnormal_count->increment();
+#ifdef PEGASUS_UNIT_TEST
+        _last_abnormal_perf_stat = perf_stat;
+#endif
     }
 
     resp.error = status.code();
@@ -656,12 +1117,36 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
     dassert(_is_open, "");
     _pfc_multi_get_qps->increment();
     uint64_t start_time = dsn_now_ns();
+    read_perf_context perf_ctx;
 
     ::dsn::apps::multi_get_response resp;
     resp.app_id = _gpid.get_app_id();
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
+    if (is_past_deadline(request.deadline_ms)) {
+        // the client has given up, do not waste time on reading
+        resp.error = rocksdb::Status::kTimedOut;
+        resp.__set_error_hint(DEADLINE_ERROR_HINT);
+        _pfc_recent_read_shed_count->increment();
+        _cu_calculator->add_multi_get_cu(resp.error, resp.kvs);
+        _pfc_multi_get_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
+
+    if (!check_hash_key_hash(request.hash_key)) {
+        dwarn("%s: invalid argument for multi_get from %s: "
+              "hash key does not belong to this partition",
+              replica_name(),
+              reply.to_address().to_string());
+        resp.error = rocksdb::Status::kInvalidArgument;
+        _cu_calculator->add_multi_get_cu(resp.error, resp.kvs);
+        _pfc_multi_get_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
+
     if (!is_filter_type_supported(request.sort_key_filter_type)) {
         derror("%s: invalid argument for multi_get from %s: "
                "sort key filter type %d not supported",
@@ -674,6 +1159,18 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
         reply(resp);
         return;
     }
+    if (!is_filter_type_supported(request.value_filter_type)) {
+        derror("%s: invalid argument for multi_get from %s: "
+               "value filter type %d not supported",
+               replica_name(),
+               reply.to_address().to_string(),
+               request.value_filter_type);
+        resp.error = rocksdb::Status::kInvalidArgument;
+        _cu_calculator->add_multi_get_cu(resp.error, resp.kvs);
+        _pfc_multi_get_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
 
     int32_t max_kv_count = request.max_kv_count > 0 ? request.max_kv_count : INT_MAX;
     int32_t max_kv_size = request.max_kv_size > 0 ? request.max_kv_size : INT_MAX;
@@ -755,6 +1252,7 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
 
         std::unique_ptr<rocksdb::Iterator> it;
         bool complete = false;
+        bool truncated = false;
         if (!request.reverse) {
             it.reset(_db->NewIterator(_data_cf_rd_opts));
             it->Seek(start);
@@ -786,6 +1284,8 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                                                        it->value(),
                                                        request.sort_key_filter_type,
                                                        request.sort_key_filter_pattern,
+                                                       request.value_filter_type,
+                                                       request.value_filter_pattern,
                                                        epoch_now,
                                                        request.no_value);
                 if (r == 1) {
@@ -805,6 +1305,11 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                 }
 
                 it->Next();
+                if (is_past_deadline_on_iterate(request.deadline_ms, iterate_count)) {
+                    // the client has given up, reply the partial result
+                    truncated = true;
+                    break;
+                }
             }
         } else { // reverse
             rocksdb::ReadOptions rd_opts(_data_cf_rd_opts);
@@ -849,6 +1354,8 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                                                        it->value(),
                                                        request.sort_key_filter_type,
                                                        request.sort_key_filter_pattern,
+                                                       request.value_filter_type,
+                                                       request.value_filter_pattern,
                                                        epoch_now,
                                                        request.no_value);
                 if (r == 1) {
@@ -868,6 +1375,11 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                 }
 
                 it->Prev();
+                if (is_past_deadline_on_iterate(request.deadline_ms, iterate_count)) {
+                    // the client has given up, reply the partial result
+                    truncated = true;
+                    break;
+                }
             }
 
             if (it->status().ok() && !reverse_kvs.empty()) {
@@ -902,6 +1414,10 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
         } else if (it->Valid() && !complete) {
             // scan not completed
             resp.error = rocksdb::Status::kIncomplete;
+            if (truncated) {
+                resp.__set_error_hint(DEADLINE_ERROR_HINT);
+                _pfc_recent_read_truncate_count->increment();
+            }
         }
     } else {
         bool error_occurred = false;
@@ -920,7 +1436,7 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
         }
 
         std::vector<rocksdb::Status> statuses = _db->MultiGet(_data_cf_rd_opts, keys, &values);
-        for (int i = 0; i < keys.size(); i++) {
+        for (size_t i = 0; i < keys.size(); i++) {
             rocksdb::Status &status = statuses[i];
             std::string &value = values[i];
             // print log
@@ -953,6 +1469,23 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                     status = rocksdb::Status::NotFound();
                 }
             }
+            // check value filter
+            if (status.ok() &&
+                request.value_filter_type != ::dsn::apps::filter_type::FT_NO_FILTER) {
+                dsn::string_view user_data =
+                    pegasus_extract_user_data_view(_pegasus_data_version, value);
+                if (!validate_filter(request.value_filter_type,
+                                     request.value_filter_pattern,
+                                     ::dsn::blob(user_data.data(), 0, user_data.length()))) {
+                    filter_count++;
+                    if (_verbose_log) {
+                        derror("%s: value filtered for multi_get from %s",
+                               replica_name(),
+                               reply.to_address().to_string());
+                    }
+                    status = rocksdb::Status::NotFound();
+                }
+            }
             // extract value
             if (status.ok()) {
                 // check if exceed limit
@@ -993,14 +1526,17 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
 #endif
 
     uint64_t time_used = dsn_now_ns() - start_time;
+    read_perf_stat perf_stat = perf_ctx.stat();
+    _multi_get_perf_counters.add(perf_stat);
     if (is_multi_get_abnormal(time_used, size, iterate_count)) {
         dwarn_replica(
             "rocksdb abnormal multi_get from {}: hash_key = {}, "
             "start_sort_key = {} ({}), stop_sort_key = {} ({}), "
             "sort_key_filter_type = {}, sort_key_filter_pattern = {}, "
+            "value_filter_type = {}, value_filter_pattern = {}, "
             "max_kv_count = {}, max_kv_size = {}, reverse = {}, "
             "result_count = {}, result_size = {}, iterate_count = {}, "
-            "expire_count = {}, filter_count = {}, time_used = {} ns",
+            "expire_count = {}, filter_count = {}, time_used = {} ns, {}",
             reply.to_address().to_string(),
             ::pegasus::utils::c_escape_string(request.hash_key),
             ::pegasus::utils::c_escape_string(request.start_sortkey),
@@ -1009,6 +1545,8 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
             request.stop_inclusive ? "inclusive" : "exclusive",
             ::dsn::apps::_filter_type_VALUES_TO_NAMES.find(request.sort_key_filter_type)->second,
             ::pegasus::utils::c_escape_string(request.sort_key_filter_pattern),
+            ::dsn::apps::_filter_type_VALUES_TO_NAMES.find(request.value_filter_type)->second,
+            ::pegasus::utils::c_escape_string(request.value_filter_pattern),
             request.max_kv_count,
             request.max_kv_size,
             request.reverse ? "true" : "false",
@@ -1017,8 +1555,12 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
             iterate_count,
             expire_count,
             filter_count,
-            time_used);
+            time_used,
+            perf_stat.to_string());
         _pfc_recent_abnormal_count->increment();
+#ifdef PEGASUS_UNIT_TEST
+        _last_abnormal_perf_stat = perf_stat;
+#endif
     }
 
     if (expire_count > 0) {
@@ -1034,6 +1576,149 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
     reply(resp);
 }
 
+void pegasus_server_impl::on_batch_get(const ::dsn::apps::batch_get_request &request,
+                                       ::dsn::rpc_replier<::dsn::apps::batch_get_response> &reply)
+{
+    dassert(_is_open, "");
+    _pfc_batch_get_qps->increment();
+    uint64_t start_time = dsn_now_ns();
+    read_perf_context perf_ctx;
+
+    ::dsn::apps::batch_get_response resp;
+    resp.app_id = _gpid.get_app_id();
+    resp.partition_index = _gpid.get_partition_index();
+    resp.server = _primary_address;
+
+    if (request.keys.empty()) {
+        derror("%s: invalid argument for batch_get from %s: keys should not be empty",
+               replica_name(),
+               reply.to_address().to_string());
+        resp.error = rocksdb::Status::kInvalidArgument;
+        _cu_calculator->add_batch_get_cu(resp.error, resp.data);
+        _pfc_batch_get_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
+
+    uint32_t epoch_now = ::pegasus::utils::epoch_now();
+    int64_t size = 0;
+    int32_t expire_count = 0;
+    rocksdb::Status final_status;
+    bool error_occurred = false;
+
+    std::vector<::dsn::blob> keys_holder;
+    std::vector<rocksdb::Slice> keys;
+    std::vector<std::string> values;
+    keys_holder.reserve(request.keys.size());
+    keys.reserve(request.keys.size());
+    for (const auto &key : request.keys) {
+        ::dsn::blob raw_key;
+        pegasus_generate_key(raw_key, key.hash_key, key.sort_key);
+        // the keys are grouped by the partition count cached by the client, which may be out
+        // of date, so every key is checked even if validate_partition_hash is disabled
+        if (!check_partition_hash(pegasus_key_hash(raw_key))) {
+            dwarn("%s: invalid argument for batch_get from %s: "
+                  "key does not belong to this partition",
+                  replica_name(),
+                  reply.to_address().to_string());
+            resp.error = rocksdb::Status::kInvalidArgument;
+            _cu_calculator->add_batch_get_cu(resp.error, resp.data);
+            _pfc_batch_get_latency->set(dsn_now_ns() - start_time);
+            reply(resp);
+            return;
+        }
+        keys.emplace_back(raw_key.data(), raw_key.length());
+        keys_holder.emplace_back(std::move(raw_key));
+    }
+
+    std::vector<rocksdb::Status> statuses = _db->MultiGet(_data_cf_rd_opts, keys, &values);
+    for (size_t i = 0; i < keys.size(); i++) {
+        rocksdb::Status &status = statuses[i];
+        std::string &value = values[i];
+        // print log
+        if (!status.ok()) {
+            if (_verbose_log) {
+                derror("%s: rocksdb get failed for batch_get from %s: "
+                       "hash_key = \"%s\", sort_key = \"%s\", error = %s",
+                       replica_name(),
+                       reply.to_address().to_string(),
+                       ::pegasus::utils::c_escape_string(request.keys[i].hash_key).c_str(),
+                       ::pegasus::utils::c_escape_string(request.keys[i].sort_key).c_str(),
+                       status.ToString().c_str());
+            } else if (!status.IsNotFound()) {
+                derror("%s: rocksdb get failed for batch_get from %s: error = %s",
+                       replica_name(),
+                       reply.to_address().to_string(),
+                       status.ToString().c_str());
+            }
+        }
+        // check ttl
+        if (status.ok()) {
+            uint32_t expire_ts = pegasus_extract_expire_ts(_pegasus_data_version, value);
+            if (expire_ts > 0 && expire_ts <= epoch_now) {
+                expire_count++;
+                if (_verbose_log) {
+                    derror("%s: rocksdb data expired for batch_get from %s",
+                           replica_name(),
+                           reply.to_address().to_string());
+                }
+                status = rocksdb::Status::NotFound();
+            }
+        }
+        // extract value
+        if (status.ok()) {
+            ::dsn::apps::full_data data;
+            data.hash_key = request.keys[i].hash_key;
+            data.sort_key = request.keys[i].sort_key;
+            pegasus_extract_user_data(_pegasus_data_version, std::move(value), data.value);
+            size += data.hash_key.length() + data.sort_key.length() + data.value.length();
+            resp.data.emplace_back(std::move(data));
+        }
+        // if error occurred
+        if (!status.ok() && !status.IsNotFound()) {
+            error_occurred = true;
+            final_status = status;
+            break;
+        }
+    }
+
+    if (error_occurred) {
+        resp.error = final_status.code();
+        resp.data.clear();
+    } else {
+        resp.error = rocksdb::Status::kOk;
+    }
+
+    uint64_t time_used = dsn_now_ns() - start_time;
+    read_perf_stat perf_stat = perf_ctx.stat();
+    _multi_get_perf_counters.add(perf_stat);
+    if (is_multi_get_abnormal(time_used, size, request.keys.size())) {
+        dwarn_replica("rocksdb abnormal batch_get from {}: key_count = {}, "
+                      "result_count = {}, result_size = {}, expire_count = {}, "
+                      "time_used = {} ns, {}",
+                      reply.to_address().to_string(),
+                      request.keys.size(),
+                      resp.data.size(),
+                      size,
+                      expire_count,
+                      time_used,
+                      perf_stat.to_string());
+        _pfc_recent_abnormal_count->increment();
+#ifdef PEGASUS_UNIT_TEST
+        _last_abnormal_perf_stat = perf_stat;
+#endif
+    }
+
+    if (expire_count > 0) {
+        _pfc_recent_expire_count->add(expire_count);
+    }
+
+    _cu_calculator->add_batch_get_cu(resp.error, resp.data);
+    _pfc_batch_get_latency->set(dsn_now_ns() - start_time);
+
+    reply(resp);
+}
+
 void pegasus_server_impl::on_sortkey_count(const ::dsn::blob &hash_key,
                                            ::dsn::rpc_replier<::dsn::apps::count_response> &reply)
 {
@@ -1044,6 +1729,36 @@ void pegasus_server_impl::on_sortkey_count(const ::dsn::blob &hash_key,
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
+    if (!check_hash_key_hash(hash_key)) {
+        dwarn("%s: invalid argument for sortkey_count from %s: "
+              "hash key does not belong to this partition",
+              replica_name(),
+              reply.to_address().to_string());
+        resp.error = rocksdb::Status::kInvalidArgument;
+        _cu_calculator->add_sortkey_count_cu(resp.error);
+        reply(resp);
+        return;
+    }
+
+    if (_sortkey_count_by_meta.load(std::memory_order_relaxed) &&
+        _sortkey_count_maintained.load(std::memory_order_acquire)) {
+        std::string meta_key, meta_value;
+        sortkey_count_meta::generate_key(hash_key, meta_key);
+        rocksdb::Status status = _db->Get(_data_cf_rd_opts, meta_key, &meta_value);
+        sortkey_count_meta meta;
+        if (status.ok() && meta.decode(meta_value) &&
+            meta.valid(_sortkey_count_generation.load(std::memory_order_acquire),
+                       ::pegasus::utils::epoch_now())) {
+            resp.count = meta.count;
+            resp.error = rocksdb::Status::kOk;
+            _cu_calculator->add_sortkey_count_cu(resp.error);
+            reply(resp);
+            return;
+        }
+        // not counted since maintained, or some counted records may have expired, fall back to
+        // scan until the hash key is recounted
+    }
+
     // scan
     ::dsn::blob start_key, stop_key;
     pegasus_generate_key(start_key, hash_key, ::dsn::blob());
@@ -1052,6 +1767,7 @@ void pegasus_server_impl::on_sortkey_count(const ::dsn::blob &hash_key,
     rocksdb::Slice stop(stop_key.data(), stop_key.length());
     rocksdb::ReadOptions options = _data_cf_rd_opts;
     options.iterate_upper_bound = &stop;
+    set_expired_sst_filter(options);
     std::unique_ptr<rocksdb::Iterator> it(_db->NewIterator(options));
     it->Seek(start);
     resp.count = 0;
@@ -1108,14 +1824,25 @@ void pegasus_server_impl::on_ttl(const ::dsn::blob &key,
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
+    if (!check_key_hash(key)) {
+        dwarn("%s: invalid argument for ttl from %s: key does not belong to this partition",
+              replica_name(),
+              reply.to_address().to_string());
+        resp.error = rocksdb::Status::kInvalidArgument;
+        _cu_calculator->add_ttl_cu(resp.error);
+        reply(resp);
+        return;
+    }
+
     rocksdb::Slice skey(key.data(), key.length());
-    std::string value;
-    rocksdb::Status status = _db->Get(_data_cf_rd_opts, skey, &value);
+    rocksdb::PinnableSlice value;
+    rocksdb::Status status = _db->Get(_data_cf_rd_opts, _db->DefaultColumnFamily(), skey, &value);
 
     uint32_t expire_ts = 0;
     uint32_t now_ts = ::pegasus::utils::epoch_now();
     if (status.ok()) {
-        expire_ts = pegasus_extract_expire_ts(_pegasus_data_version, value);
+        expire_ts = pegasus_extract_expire_ts(_pegasus_data_version,
+                                              dsn::string_view(value.data(), value.size()));
         if (check_if_ts_expired(now_ts, expire_ts)) {
             _pfc_recent_expire_count->increment();
             if (_verbose_log) {
@@ -1167,12 +1894,24 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
     dassert(_is_open, "");
     _pfc_scan_qps->increment();
     uint64_t start_time = dsn_now_ns();
+    read_perf_context perf_ctx;
 
     ::dsn::apps::scan_response resp;
     resp.app_id = _gpid.get_app_id();
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
+    if (is_past_deadline(request.deadline_ms)) {
+        // the client has given up, do not waste time on reading
+        resp.error = rocksdb::Status::kTimedOut;
+        resp.__set_error_hint(DEADLINE_ERROR_HINT);
+        _pfc_recent_read_shed_count->increment();
+        _cu_calculator->add_scan_cu(resp.error, resp.kvs);
+        _pfc_scan_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
+
     if (!is_filter_type_supported(request.hash_key_filter_type)) {
         derror("%s: invalid argument for get_scanner from %s: "
                "hash key filter type %d not supported",
@@ -1197,14 +1936,29 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
         reply(resp);
         return;
     }
-
-    rocksdb::ReadOptions rd_opts(_data_cf_rd_opts);
-    if (_data_cf_opts.prefix_extractor) {
-        ::dsn::blob start_hash_key, tmp;
-        pegasus_restore_key(request.start_key, start_hash_key, tmp);
-        if (start_hash_key.size() == 0) {
-            // hash_key is not passed, only happened when do full scan (scanners got by
+    if (!is_filter_type_supported(request.value_filter_type)) {
+        derror("%s: invalid argument for get_scanner from %s: "
+               "value filter type %d not supported",
+               replica_name(),
+               reply.to_address().to_string(),
+               request.value_filter_type);
+        resp.error = rocksdb::Status::kInvalidArgument;
+        _cu_calculator->add_scan_cu(resp.error, resp.kvs);
+        _pfc_scan_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
+
+    rocksdb::ReadOptions rd_opts(_data_cf_rd_opts);
+    set_expired_sst_filter(rd_opts);
+    rd_opts.fill_cache = _scan_fill_block_cache.load();
+    if (_data_cf_opts.prefix_extractor) {
+        ::dsn::blob start_hash_key, tmp;
+        pegasus_restore_key(request.start_key, start_hash_key, tmp);
+        if (start_hash_key.size() == 0 || request.reverse) {
+            // 1. hash_key is not passed, only happened when do full scan (scanners got by
             // get_unordered_scanners) on a partition, we have to do total order seek on rocksDB.
+            // 2. prefix bloom filter is not supported in reverse seek mode, see on_multi_get().
             rd_opts.total_order_seek = true;
             rd_opts.prefix_same_as_start = false;
         }
@@ -1256,18 +2010,31 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
         return;
     }
 
+    // in reverse mode, iterate from 'stop' (as 'begin') to 'start' (as 'end')
+    bool reverse = request.reverse;
+    const rocksdb::Slice &begin = reverse ? stop : start;
+    const rocksdb::Slice &end = reverse ? start : stop;
+    bool end_inclusive = reverse ? start_inclusive : stop_inclusive;
+
     std::unique_ptr<rocksdb::Iterator> it(_db->NewIterator(rd_opts));
-    it->Seek(start);
+    if (reverse) {
+        it->SeekForPrev(begin);
+    } else {
+        it->Seek(begin);
+    }
     bool complete = false;
-    bool first_exclusive = !start_inclusive;
+    bool first_exclusive = reverse ? !stop_inclusive : !start_inclusive;
     uint32_t epoch_now = ::pegasus::utils::epoch_now();
     uint64_t expire_count = 0;
     uint64_t filter_count = 0;
     int32_t count = 0;
+    int64_t batch_bytes = 0;
+    bool truncated = false;
     resp.kvs.reserve(request.batch_size);
     while (count < request.batch_size && it->Valid()) {
-        int c = it->key().compare(stop);
-        if (c > 0 || (c == 0 && !stop_inclusive)) {
+        // c > 0 means beyond 'end' in the iterating direction
+        int c = reverse ? end.compare(it->key()) : it->key().compare(end);
+        if (c > 0 || (c == 0 && !end_inclusive)) {
             // out of range
             complete = true;
             break;
@@ -1275,9 +2042,9 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
 
         if (first_exclusive) {
             first_exclusive = false;
-            if (it->key().compare(start) == 0) {
-                // discard start_sortkey
-                it->Next();
+            if (it->key().compare(begin) == 0) {
+                // discard the begin key
+                move_scan_iterator(it.get(), reverse);
                 continue;
             }
         }
@@ -1289,10 +2056,13 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
                                           request.hash_key_filter_pattern,
                                           request.sort_key_filter_type,
                                           request.sort_key_filter_pattern,
+                                          request.value_filter_type,
+                                          request.value_filter_pattern,
                                           epoch_now,
                                           request.no_value);
         if (r == 1) {
             count++;
+            batch_bytes += resp.kvs.back().key.length() + resp.kvs.back().value.length();
         } else if (r == 2) {
             expire_count++;
         } else { // r == 3
@@ -1305,7 +2075,18 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
             break;
         }
 
-        it->Next();
+        move_scan_iterator(it.get(), reverse);
+
+        if (is_scan_batch_full(
+                batch_bytes, start_time, request.max_batch_bytes, request.max_batch_time_us)) {
+            break;
+        }
+        if (is_past_deadline_on_iterate(request.deadline_ms,
+                                        count + expire_count + filter_count)) {
+            // the client has given up, reply the partial batch
+            truncated = true;
+            break;
+        }
     }
 
     resp.error = it->status().code();
@@ -1333,28 +2114,34 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
         resp.kvs.clear();
     } else if (it->Valid() && !complete) {
         // scan not completed
-        std::unique_ptr<pegasus_scan_context> context(
+        if (truncated) {
+            resp.__set_error_hint(DEADLINE_ERROR_HINT);
+            _pfc_recent_read_truncate_count->increment();
+        }
+        std::shared_ptr<pegasus_scan_context> context(
             new pegasus_scan_context(std::move(it),
-                                     std::string(stop.data(), stop.size()),
-                                     request.stop_inclusive,
+                                     std::string(end.data(), end.size()),
+                                     end_inclusive,
                                      request.hash_key_filter_type,
                                      std::string(request.hash_key_filter_pattern.data(),
                                                  request.hash_key_filter_pattern.length()),
                                      request.sort_key_filter_type,
                                      std::string(request.sort_key_filter_pattern.data(),
                                                  request.sort_key_filter_pattern.length()),
+                                     request.value_filter_type,
+                                     std::string(request.value_filter_pattern.data(),
+                                                 request.value_filter_pattern.length()),
                                      request.batch_size,
-                                     request.no_value));
+                                     request.max_batch_bytes,
+                                     request.max_batch_time_us,
+                                     request.no_value,
+                                     reverse));
+        if (request.prefetch && _scan_prefetch_quota->enabled()) {
+            context->prefetch_quota = _scan_prefetch_quota;
+            start_scan_prefetch(context);
+        }
         int64_t handle = _context_cache.put(std::move(context));
         resp.context_id = handle;
-        // if the context is used, it will be fetched and re-put into cache,
-        // which will change the handle,
-        // then the delayed task will fetch null context by old handle, and do nothing.
-        ::dsn::tasking::enqueue(LPC_PEGASUS_SERVER_DELAY,
-                                &_tracker,
-                                [this, handle]() { _context_cache.fetch(handle); },
-                                0,
-                                std::chrono::minutes(5));
     } else {
         // scan completed
         resp.context_id = pegasus::SCAN_CONTEXT_ID_COMPLETED;
@@ -1367,6 +2154,7 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
         _pfc_recent_filter_count->add(filter_count);
     }
 
+    _scan_perf_counters.add(perf_ctx.stat());
     _cu_calculator->add_scan_cu(resp.error, resp.kvs);
     _pfc_scan_latency->set(dsn_now_ns() - start_time);
 
@@ -1379,65 +2167,57 @@ void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
     dassert(_is_open, "");
     _pfc_scan_qps->increment();
     uint64_t start_time = dsn_now_ns();
+    read_perf_context perf_ctx;
 
     ::dsn::apps::scan_response resp;
     resp.app_id = _gpid.get_app_id();
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
-    std::unique_ptr<pegasus_scan_context> context = _context_cache.fetch(request.context_id);
+    if (is_past_deadline(request.deadline_ms)) {
+        // the client has given up, keep the context for a retry
+        resp.error = rocksdb::Status::kTimedOut;
+        resp.__set_error_hint(DEADLINE_ERROR_HINT);
+        _pfc_recent_read_shed_count->increment();
+        _cu_calculator->add_scan_cu(resp.error, resp.kvs);
+        _pfc_scan_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
+
+    std::shared_ptr<pegasus_scan_context> context = _context_cache.fetch(request.context_id);
     if (context) {
-        rocksdb::Iterator *it = context->iterator.get();
-        int32_t batch_size = context->batch_size;
-        const rocksdb::Slice &stop = context->stop;
-        bool stop_inclusive = context->stop_inclusive;
-        ::dsn::apps::filter_type::type hash_key_filter_type = context->hash_key_filter_type;
-        const ::dsn::blob &hash_key_filter_pattern = context->hash_key_filter_pattern;
-        ::dsn::apps::filter_type::type sort_key_filter_type = context->sort_key_filter_type;
-        const ::dsn::blob &sort_key_filter_pattern = context->sort_key_filter_pattern;
-        bool no_value = context->no_value;
-        bool complete = false;
-        uint32_t epoch_now = ::pegasus::utils::epoch_now();
-        uint64_t expire_count = 0;
-        uint64_t filter_count = 0;
-        int32_t count = 0;
-
-        while (count < batch_size && it->Valid()) {
-            int c = it->key().compare(stop);
-            if (c > 0 || (c == 0 && !stop_inclusive)) {
-                // out of range
-                complete = true;
-                break;
+        pegasus_scan_batch batch;
+        bool prefetching = false;
+        bool prefetched = false;
+        if (context->prefetch_quota != nullptr) {
+            ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(context->prefetch_lock);
+            prefetching = context->prefetching;
+            if (context->prefetched) {
+                batch = std::move(*context->prefetched);
+                context->prefetched.reset();
+                prefetched = true;
             }
-
-            int r = append_key_value_for_scan(resp.kvs,
-                                              it->key(),
-                                              it->value(),
-                                              hash_key_filter_type,
-                                              hash_key_filter_pattern,
-                                              sort_key_filter_type,
-                                              sort_key_filter_pattern,
-                                              epoch_now,
-                                              no_value);
-            if (r == 1) {
-                count++;
-            } else if (r == 2) {
-                expire_count++;
-            } else { // r == 3
-                filter_count++;
+        }
+        if (prefetching) {
+            // the iterator is being used by the prefetch task, reply an empty batch so that
+            // the client asks for the next batch again, rather than waiting for the task here
+            batch.complete = false;
+        } else {
+            if (prefetched) {
+                context->prefetch_quota->release(batch.bytes, false);
+                _pfc_recent_scan_prefetch_hit_count->increment();
+                // the records expired after prefetched are not replied
+                batch.remove_expired(::pegasus::utils::epoch_now());
             }
-
-            if (c == 0) {
-                // seek to the last position
-                complete = true;
-                break;
+            if (!prefetched || (batch.status.ok() && !batch.complete && batch.kvs.empty())) {
+                // the prefetched batch is empty if its first record exceeds the reserved bytes
+                scan_batch(context.get(), start_time, request.deadline_ms, batch);
             }
-
-            it->Next();
         }
 
-        resp.error = it->status().code();
-        if (!it->status().ok()) {
+        resp.error = batch.status.code();
+        if (!batch.status.ok()) {
             // error occur
             if (_verbose_log) {
                 derror("%s: rocksdb scan failed for scan from %s: "
@@ -1446,50 +2226,374 @@ void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
                        replica_name(),
                        reply.to_address().to_string(),
                        request.context_id,
-                       ::pegasus::utils::c_escape_string(stop).c_str(),
-                       stop_inclusive ? "inclusive" : "exclusive",
-                       batch_size,
-                       count,
-                       it->status().ToString().c_str());
+                       ::pegasus::utils::c_escape_string(context->stop).c_str(),
+                       context->stop_inclusive ? "inclusive" : "exclusive",
+                       context->batch_size,
+                       (int)batch.kvs.size(),
+                       batch.status.ToString().c_str());
             } else {
                 derror("%s: rocksdb scan failed for scan from %s: error = %s",
                        replica_name(),
                        reply.to_address().to_string(),
-                       it->status().ToString().c_str());
+                       batch.status.ToString().c_str());
             }
-            resp.kvs.clear();
-        } else if (it->Valid() && !complete) {
+        } else if (!batch.complete) {
             // scan not completed
+            if (batch.truncated) {
+                resp.__set_error_hint(DEADLINE_ERROR_HINT);
+                _pfc_recent_read_truncate_count->increment();
+            }
+            resp.kvs = std::move(batch.kvs);
+            if (!prefetching && context->prefetch_quota != nullptr) {
+                start_scan_prefetch(context);
+            }
             int64_t handle = _context_cache.put(std::move(context));
             resp.context_id = handle;
-            ::dsn::tasking::enqueue(LPC_PEGASUS_SERVER_DELAY,
-                                    &_tracker,
-                                    [this, handle]() { _context_cache.fetch(handle); },
-                                    0,
-                                    std::chrono::minutes(5));
         } else {
             // scan completed
+            resp.kvs = std::move(batch.kvs);
             resp.context_id = pegasus::SCAN_CONTEXT_ID_COMPLETED;
         }
 
-        if (expire_count > 0) {
-            _pfc_recent_expire_count->add(expire_count);
+        if (batch.expire_count > 0) {
+            _pfc_recent_expire_count->add(batch.expire_count);
         }
-        if (filter_count > 0) {
-            _pfc_recent_filter_count->add(filter_count);
+        if (batch.filter_count > 0) {
+            _pfc_recent_filter_count->add(batch.filter_count);
         }
     } else {
         resp.error = rocksdb::Status::Code::kNotFound;
     }
 
+    _scan_perf_counters.add(perf_ctx.stat());
     _cu_calculator->add_scan_cu(resp.error, resp.kvs);
     _pfc_scan_latency->set(dsn_now_ns() - start_time);
 
     reply(resp);
 }
 
+void pegasus_server_impl::scan_batch(pegasus_scan_context *context,
+                                     uint64_t start_time_ns,
+                                     int64_t deadline_ms,
+                                     pegasus_scan_batch &batch,
+                                     int64_t prefetch_bytes)
+{
+    rocksdb::Iterator *it = context->iterator.get();
+    bool complete = false;
+    uint32_t epoch_now = ::pegasus::utils::epoch_now();
+    int32_t count = 0;
+    batch.kvs.reserve(context->batch_size);
+
+    while (count < context->batch_size && it->Valid()) {
+        // c > 0 means beyond 'stop' in the iterating direction
+        int c = context->reverse ? context->stop.compare(it->key())
+                                 : it->key().compare(context->stop);
+        if (c > 0 || (c == 0 && !context->stop_inclusive)) {
+            // out of range
+            complete = true;
+            break;
+        }
+        if (prefetch_bytes > 0 &&
+            batch.bytes + it->key().size() + (context->no_value ? 0 : it->value().size()) >
+                prefetch_bytes) {
+            // left to the next batch, the size of the raw value is not less than the user data
+            break;
+        }
+
+        int r = append_key_value_for_scan(batch.kvs,
+                                          it->key(),
+                                          it->value(),
+                                          context->hash_key_filter_type,
+                                          context->hash_key_filter_pattern,
+                                          context->sort_key_filter_type,
+                                          context->sort_key_filter_pattern,
+                                          context->value_filter_type,
+                                          context->value_filter_pattern,
+                                          epoch_now,
+                                          context->no_value);
+        if (r == 1) {
+            count++;
+            batch.bytes += batch.kvs.back().key.length() + batch.kvs.back().value.length();
+            if (prefetch_bytes > 0) {
+                batch.expire_ts.push_back(pegasus_extract_expire_ts(
+                    _pegasus_data_version, utils::to_string_view(it->value())));
+            }
+        } else if (r == 2) {
+            batch.expire_count++;
+        } else { // r == 3
+            batch.filter_count++;
+        }
+
+        if (c == 0) {
+            // seek to the last position
+            complete = true;
+            break;
+        }
+
+        move_scan_iterator(it, context->reverse);
+
+        if (is_scan_batch_full(batch.bytes,
+                               start_time_ns,
+                               context->max_batch_bytes,
+                               context->max_batch_time_us)) {
+            break;
+        }
+        if (is_past_deadline_on_iterate(deadline_ms,
+                                        count + batch.expire_count + batch.filter_count)) {
+            // the client has given up, reply the partial batch
+            batch.truncated = true;
+            break;
+        }
+    }
+
+    batch.status = it->status();
+    if (!batch.status.ok()) {
+        batch.kvs.clear();
+        batch.bytes = 0;
+    }
+    batch.complete = complete || !it->Valid();
+}
+
+void pegasus_server_impl::start_scan_prefetch(const std::shared_ptr<pegasus_scan_context> &context)
+{
+    // the bytes are reserved before iterating, so that the quota is never exceeded
+    int64_t reserved_bytes = _scan_prefetch_batch_bytes;
+    if (!context->prefetch_quota->try_acquire(reserved_bytes)) {
+        return;
+    }
+    {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(context->prefetch_lock);
+        context->prefetching = true;
+    }
+
+    // the context is held by the task, so it is alive even if dropped from the cache meanwhile,
+    // in which case the prefetched batch is released as wasted along with the context
+    ::dsn::tasking::enqueue(
+        LPC_PEGASUS_SCAN_PREFETCH, &_tracker, [this, context, reserved_bytes]() mutable {
+            std::unique_ptr<pegasus_scan_batch> batch(new pegasus_scan_batch());
+            // the client of the next batch is unknown, so there is no deadline
+            scan_batch(context.get(), dsn_now_ns(), 0, *batch, reserved_bytes);
+            context->prefetch_quota->release(reserved_bytes - batch->bytes, false);
+            {
+                ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(context->prefetch_lock);
+                context->prefetched = std::move(batch);
+                context->prefetching = false;
+            }
+            // not held until the task is destroyed, the iterator must be released before the db
+            context.reset();
+        });
+}
+
 void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache.fetch(args); }
 
+void pegasus_server_impl::on_aggregate_scan(
+    const ::dsn::apps::aggregate_scan_request &request,
+    ::dsn::rpc_replier<::dsn::apps::aggregate_scan_response> &reply)
+{
+    dassert(_is_open, "");
+    _pfc_aggregate_scan_qps->increment();
+    uint64_t start_time = dsn_now_ns();
+
+    ::dsn::apps::aggregate_scan_response resp;
+    resp.app_id = _gpid.get_app_id();
+    resp.partition_index = _gpid.get_partition_index();
+    resp.server = _primary_address;
+
+    std::shared_ptr<pegasus_scan_context> context;
+    if (request.context_id == pegasus::SCAN_CONTEXT_ID_NOT_EXIST) {
+        if (!is_filter_type_supported(request.hash_key_filter_type) ||
+            !is_filter_type_supported(request.sort_key_filter_type) ||
+            !is_filter_type_supported(request.value_filter_type)) {
+            derror("%s: invalid argument for aggregate_scan from %s: "
+                   "filter type (%d, %d, %d) not supported",
+                   replica_name(),
+                   reply.to_address().to_string(),
+                   request.hash_key_filter_type,
+                   request.sort_key_filter_type,
+                   request.value_filter_type);
+            resp.error = rocksdb::Status::kInvalidArgument;
+            _cu_calculator->add_aggregate_scan_cu(resp.error, 0);
+            _pfc_aggregate_scan_latency->set(dsn_now_ns() - start_time);
+            reply(resp);
+            return;
+        }
+        // the scan context would never move forward with a non-positive batch size
+        if (request.batch_size <= 0) {
+            derror("%s: invalid argument for aggregate_scan from %s: batch_size = %d",
+                   replica_name(),
+                   reply.to_address().to_string(),
+                   request.batch_size);
+            resp.error = rocksdb::Status::kInvalidArgument;
+            _cu_calculator->add_aggregate_scan_cu(resp.error, 0);
+            _pfc_aggregate_scan_latency->set(dsn_now_ns() - start_time);
+            reply(resp);
+            return;
+        }
+
+        rocksdb::ReadOptions rd_opts(_data_cf_rd_opts);
+        set_expired_sst_filter(rd_opts);
+        rd_opts.fill_cache = _scan_fill_block_cache.load();
+        if (_data_cf_opts.prefix_extractor) {
+            ::dsn::blob start_hash_key, tmp;
+            pegasus_restore_key(request.start_key, start_hash_key, tmp);
+            if (start_hash_key.size() == 0) {
+                // the same as full scan in on_get_scanner
+                rd_opts.total_order_seek = true;
+                rd_opts.prefix_same_as_start = false;
+            }
+        }
+        bool start_inclusive = request.start_inclusive;
+        rocksdb::Slice start(request.start_key.data(), request.start_key.length());
+        rocksdb::Slice stop(request.stop_key.data(), request.stop_key.length());
+
+        // limit key range by prefix filter, see on_get_scanner
+        ::dsn::blob prefix_start_key;
+        if (request.hash_key_filter_type == ::dsn::apps::filter_type::FT_MATCH_PREFIX &&
+            request.hash_key_filter_pattern.length() > 0) {
+            pegasus_generate_key(prefix_start_key, request.hash_key_filter_pattern, ::dsn::blob());
+            rocksdb::Slice prefix_start(prefix_start_key.data(), prefix_start_key.length());
+            if (prefix_start.compare(start) > 0) {
+                start = prefix_start;
+                start_inclusive = true;
+                dassert(!_data_cf_opts.prefix_extractor || rd_opts.total_order_seek,
+                        "Invalid option");
+                dassert(!_data_cf_opts.prefix_extractor || !rd_opts.prefix_same_as_start,
+                        "Invalid option");
+            }
+        }
+
+        // check if range is empty
+        int c = start.compare(stop);
+        if (c > 0 || (c == 0 && (!start_inclusive || !request.stop_inclusive))) {
+            resp.error = rocksdb::Status::kOk;
+            resp.context_id = pegasus::SCAN_CONTEXT_ID_COMPLETED;
+            _cu_calculator->add_aggregate_scan_cu(resp.error, 0);
+            _pfc_aggregate_scan_latency->set(dsn_now_ns() - start_time);
+            reply(resp);
+            return;
+        }
+
+        std::unique_ptr<rocksdb::Iterator> it(_db->NewIterator(rd_opts));
+        it->Seek(start);
+        if (!start_inclusive && it->Valid() && it->key().compare(start) == 0) {
+            // discard start_key
+            it->Next();
+        }
+        context.reset(new pegasus_scan_context(
+            std::move(it),
+            std::string(stop.data(), stop.size()),
+            request.stop_inclusive,
+            request.hash_key_filter_type,
+            std::string(request.hash_key_filter_pattern.data(),
+                        request.hash_key_filter_pattern.length()),
+            request.sort_key_filter_type,
+            std::string(request.sort_key_filter_pattern.data(),
+                        request.sort_key_filter_pattern.length()),
+            request.value_filter_type,
+            std::string(request.value_filter_pattern.data(), request.value_filter_pattern.length()),
+            request.batch_size,
+            0,
+            0,
+            true,
+            false));
+        context->aggregator.reset(
+            new pegasus_scan_aggregator(request.stat_size, request.top_count));
+    } else {
+        context = _context_cache.fetch(request.context_id);
+        if (context == nullptr || context->aggregator == nullptr) {
+            resp.error = rocksdb::Status::kNotFound;
+            _cu_calculator->add_aggregate_scan_cu(resp.error, 0);
+            _pfc_aggregate_scan_latency->set(dsn_now_ns() - start_time);
+            reply(resp);
+            return;
+        }
+    }
+
+    rocksdb::Iterator *it = context->iterator.get();
+    int32_t batch_size = request.batch_size > 0 ? request.batch_size : context->batch_size;
+    const rocksdb::Slice &stop = context->stop;
+    bool stop_inclusive = context->stop_inclusive;
+    bool complete = false;
+    uint32_t epoch_now = ::pegasus::utils::epoch_now();
+    uint64_t expire_count = 0;
+    uint64_t filter_count = 0;
+    int64_t read_size = 0;
+    int32_t iterate_count = 0;
+    while (iterate_count < batch_size && it->Valid()) {
+        int c = it->key().compare(stop);
+        if (c > 0 || (c == 0 && !stop_inclusive)) {
+            // out of range
+            complete = true;
+            break;
+        }
+
+        iterate_count++;
+        read_size += it->key().size() + it->value().size();
+        int r = validate_key_value_for_scan(it->key(),
+                                            it->value(),
+                                            context->hash_key_filter_type,
+                                            context->hash_key_filter_pattern,
+                                            context->sort_key_filter_type,
+                                            context->sort_key_filter_pattern,
+                                            context->value_filter_type,
+                                            context->value_filter_pattern,
+                                            epoch_now);
+        if (r == 1) {
+            ::dsn::blob raw_key(it->key().data(), 0, it->key().size());
+            ::dsn::blob hash_key, sort_key;
+            pegasus_restore_key(raw_key, hash_key, sort_key);
+            dsn::string_view user_data = pegasus_extract_user_data_view(
+                _pegasus_data_version, dsn::string_view(it->value().data(), it->value().size()));
+            context->aggregator->add(hash_key, sort_key, user_data.length());
+        } else if (r == 2) {
+            expire_count++;
+        } else { // r == 3
+            filter_count++;
+        }
+
+        if (c == 0) {
+            // seek to the last position
+            complete = true;
+            break;
+        }
+
+        it->Next();
+    }
+
+    resp.error = it->status().code();
+    if (!it->status().ok()) {
+        // error occur
+        derror("%s: rocksdb scan failed for aggregate_scan from %s: "
+               "context_id = %" PRId64 ", iterate_count = %d, error = %s",
+               replica_name(),
+               reply.to_address().to_string(),
+               request.context_id,
+               iterate_count,
+               it->status().ToString().c_str());
+    } else if (it->Valid() && !complete) {
+        // aggregation not completed
+        context->aggregator->fill_response(resp, false);
+        int64_t handle = _context_cache.put(std::move(context));
+        resp.context_id = handle;
+    } else {
+        // aggregation completed
+        context->aggregator->fill_response(resp, true);
+        resp.context_id = pegasus::SCAN_CONTEXT_ID_COMPLETED;
+    }
+
+    if (expire_count > 0) {
+        _pfc_recent_expire_count->add(expire_count);
+    }
+    if (filter_count > 0) {
+        _pfc_recent_filter_count->add(filter_count);
+    }
+
+    _cu_calculator->add_aggregate_scan_cu(resp.error, read_size);
+    _pfc_aggregate_scan_latency->set(dsn_now_ns() - start_time);
+
+    reply(resp);
+}
+
 ::dsn::error_code pegasus_server_impl::start(int argc, char **argv)
 {
     dassert_replica(!_is_open, "replica is already opened.");
@@ -1587,6 +2691,19 @@ void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache
     ddebug("%s: start to open rocksDB's rdb(%s)", replica_name(), path.c_str());
 
     auto status = rocksdb::DB::Open(rocksdb::Options(_db_opts, _data_cf_opts), path, &_db);
+    if (_data_cf_opts.compaction_style == rocksdb::kCompactionStyleFIFO &&
+        status.IsInvalidArgument() &&
+        status.ToString().find("Not all files are at level 0") != std::string::npos) {
+        // FIFO compaction can not open the db with files out of level 0, which are written by
+        // other compaction styles, fall back to level compaction, which can open any db.
+        derror_replica("open rocksdb with FIFO compaction failed, fall back to level "
+                       "compaction, status = {}",
+                       status.ToString());
+        _data_cf_opts.compaction_style = rocksdb::kCompactionStyleLevel;
+        _compaction_style_fallback = true;
+        _pfc_compaction_style_fallback_count->increment();
+        status = rocksdb::DB::Open(rocksdb::Options(_db_opts, _data_cf_opts), path, &_db);
+    }
     if (status.ok()) {
         _last_committed_decree = _db->GetLastFlushedDecree();
         _pegasus_data_version = _db->GetPegasusDataVersion();
@@ -1602,6 +2719,12 @@ void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache
         // only enable filter after correct value_schema_version set
         _key_ttl_compaction_filter_factory->SetPegasusDataVersion(_pegasus_data_version);
         _key_ttl_compaction_filter_factory->EnableFilter();
+        _key_ttl_compaction_filter_factory->SetPartitionIndex(_gpid.get_partition_index());
+        if (_validate_partition_hash) {
+            _key_ttl_compaction_filter_factory->EnablePartitionHashValidation();
+        }
+        _ttl_properties_collector_factory->SetPegasusDataVersion(_pegasus_data_version);
+        _ttl_properties_collector_factory->EnableCollector();
 
         // update LastManualCompactFinishTime
         _manual_compact_svc.init_last_finish_time_ms(_db->GetLastManualCompactFinishTime());
@@ -1648,6 +2771,20 @@ void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache
                                           [this]() { this->update_replica_rocksdb_statistics(); },
                                           _update_rdb_stat_interval);
 
+        _sweep_scan_context =
+            ::dsn::tasking::enqueue_timer(LPC_REPLICATION_LONG_COMMON,
+                                          &_tracker,
+                                          [this]() { this->sweep_scan_contexts(); },
+                                          _scan_context_sweep_interval);
+
+        if (_drop_expired_sst_interval.count() > 0) {
+            _drop_expired_sst =
+                ::dsn::tasking::enqueue_timer(LPC_REPLICATION_LONG_COMMON,
+                                              &_tracker,
+                                              [this]() { this->drop_expired_sst_files(); },
+                                              _drop_expired_sst_interval);
+        }
+
         // Block cache is a singleton on this server shared by all replicas, its metrics update task
         // should be scheduled once an interval on the server view.
         static std::once_flag flag;
@@ -1701,9 +2838,26 @@ void pegasus_server_impl::cancel_background_work(bool wait)
         _update_replica_rdb_stat->cancel(true);
         _update_replica_rdb_stat = nullptr;
     }
+    if (_sweep_scan_context != nullptr) {
+        _sweep_scan_context->cancel(true);
+        _sweep_scan_context = nullptr;
+    }
+    if (_drop_expired_sst != nullptr) {
+        _drop_expired_sst->cancel(true);
+        _drop_expired_sst = nullptr;
+    }
     _tracker.cancel_outstanding_tasks();
+    // the reply of MAINTAIN_SORTKEY_COUNT may be cancelled
+    _sortkey_count_switching.store(false);
 
     _context_cache.clear();
+    {
+        ::dsn::utils::auto_write_lock l(_skippable_sst_lock);
+        _skippable_sst.clear();
+    }
+    _pfc_scan_context_count->set(0);
+    _pfc_skippable_sst_count->set(0);
+    _pfc_scan_prefetch_mem_usage->set(0);
 
     _is_open = false;
     delete _db;
@@ -1736,6 +2890,13 @@ void pegasus_server_impl::cancel_background_work(bool wait)
         _pfc_rdb_block_cache_hit_count->set(0);
         _pfc_rdb_block_cache_total_count->set(0);
         _pfc_rdb_block_cache_mem_usage->set(0);
+        _pfc_rdb_block_cache_pinned_usage->set(0);
+        _pfc_rdb_block_cache_table_mem_usage->set(0);
+        _pfc_rdb_persistent_cache_hit_count->set(0);
+        _pfc_rdb_persistent_cache_total_count->set(0);
+        _pfc_rdb_row_cache_hit_count->set(0);
+        _pfc_rdb_row_cache_total_count->set(0);
+        _pfc_rdb_row_cache_mem_usage->set(0);
         _pfc_rdb_index_and_filter_blocks_mem_usage->set(0);
         _pfc_rdb_memtable_mem_usage->set(0);
     }
@@ -2184,17 +3345,25 @@ bool pegasus_server_impl::validate_filter(::dsn::apps::filter_type::type filter_
     return false;
 }
 
-int pegasus_server_impl::append_key_value_for_scan(
-    std::vector<::dsn::apps::key_value> &kvs,
+int pegasus_server_impl::validate_key_value_for_scan(
     const rocksdb::Slice &key,
     const rocksdb::Slice &value,
     ::dsn::apps::filter_type::type hash_key_filter_type,
     const ::dsn::blob &hash_key_filter_pattern,
     ::dsn::apps::filter_type::type sort_key_filter_type,
     const ::dsn::blob &sort_key_filter_pattern,
-    uint32_t epoch_now,
-    bool no_value)
+    ::dsn::apps::filter_type::type value_filter_type,
+    const ::dsn::blob &value_filter_pattern,
+    uint32_t epoch_now)
 {
+    if (!check_key_hash(::dsn::blob(key.data(), 0, key.size()))) {
+        // stale record of another partition after partition split
+        if (_verbose_log) {
+            derror("%s: key not belonging to this partition filtered for scan", replica_name());
+        }
+        return 3;
+    }
+
     if (check_if_record_expired(epoch_now, value)) {
         if (_verbose_log) {
             derror("%s: rocksdb data expired for scan", replica_name());
@@ -2202,12 +3371,23 @@ int pegasus_server_impl::append_key_value_for_scan(
         return 2;
     }
 
-    ::dsn::apps::key_value kv;
+    // check value filter before any copy, so that filtered records cost nothing but the compare
+    if (value_filter_type != ::dsn::apps::filter_type::FT_NO_FILTER) {
+        dsn::string_view user_data = pegasus_extract_user_data_view(
+            _pegasus_data_version, dsn::string_view(value.data(), value.size()));
+        if (!validate_filter(value_filter_type,
+                             value_filter_pattern,
+                             ::dsn::blob(user_data.data(), 0, user_data.length()))) {
+            if (_verbose_log) {
+                derror("%s: value filtered for scan", replica_name());
+            }
+            return 3;
+        }
+    }
 
-    // extract raw key
-    ::dsn::blob raw_key(key.data(), 0, key.size());
     if (hash_key_filter_type != ::dsn::apps::filter_type::FT_NO_FILTER ||
         sort_key_filter_type != ::dsn::apps::filter_type::FT_NO_FILTER) {
+        ::dsn::blob raw_key(key.data(), 0, key.size());
         ::dsn::blob hash_key, sort_key;
         pegasus_restore_key(raw_key, hash_key, sort_key);
         if (hash_key_filter_type != ::dsn::apps::filter_type::FT_NO_FILTER &&
@@ -2225,9 +3405,41 @@ int pegasus_server_impl::append_key_value_for_scan(
             return 3;
         }
     }
-    std::shared_ptr<char> key_buf(::dsn::utils::make_shared_array<char>(raw_key.length()));
-    ::memcpy(key_buf.get(), raw_key.data(), raw_key.length());
-    kv.key.assign(std::move(key_buf), 0, raw_key.length());
+    return 1;
+}
+
+int pegasus_server_impl::append_key_value_for_scan(
+    std::vector<::dsn::apps::key_value> &kvs,
+    const rocksdb::Slice &key,
+    const rocksdb::Slice &value,
+    ::dsn::apps::filter_type::type hash_key_filter_type,
+    const ::dsn::blob &hash_key_filter_pattern,
+    ::dsn::apps::filter_type::type sort_key_filter_type,
+    const ::dsn::blob &sort_key_filter_pattern,
+    ::dsn::apps::filter_type::type value_filter_type,
+    const ::dsn::blob &value_filter_pattern,
+    uint32_t epoch_now,
+    bool no_value)
+{
+    int r = validate_key_value_for_scan(key,
+                                        value,
+                                        hash_key_filter_type,
+                                        hash_key_filter_pattern,
+                                        sort_key_filter_type,
+                                        sort_key_filter_pattern,
+                                        value_filter_type,
+                                        value_filter_pattern,
+                                        epoch_now);
+    if (r != 1) {
+        return r;
+    }
+
+    ::dsn::apps::key_value kv;
+
+    // extract raw key
+    std::shared_ptr<char> key_buf(::dsn::utils::make_shared_array<char>(key.size()));
+    ::memcpy(key_buf.get(), key.data(), key.size());
+    kv.key.assign(std::move(key_buf), 0, key.size());
 
     // extract value
     if (!no_value) {
@@ -2245,6 +3457,8 @@ int pegasus_server_impl::append_key_value_for_multi_get(
     const rocksdb::Slice &value,
     ::dsn::apps::filter_type::type sort_key_filter_type,
     const ::dsn::blob &sort_key_filter_pattern,
+    ::dsn::apps::filter_type::type value_filter_type,
+    const ::dsn::blob &value_filter_pattern,
     uint32_t epoch_now,
     bool no_value)
 {
@@ -2255,6 +3469,20 @@ int pegasus_server_impl::append_key_value_for_multi_get(
         return 2;
     }
 
+    // check value filter
+    if (value_filter_type != ::dsn::apps::filter_type::FT_NO_FILTER) {
+        dsn::string_view user_data = pegasus_extract_user_data_view(
+            _pegasus_data_version, dsn::string_view(value.data(), value.size()));
+        if (!validate_filter(value_filter_type,
+                             value_filter_pattern,
+                             ::dsn::blob(user_data.data(), 0, user_data.length()))) {
+            if (_verbose_log) {
+                derror("%s: value filtered for multi get", replica_name());
+            }
+            return 3;
+        }
+    }
+
     ::dsn::apps::key_value kv;
 
     // extract sort_key
@@ -2313,6 +3541,31 @@ void pegasus_server_impl::update_replica_rocksdb_statistics()
     _pfc_rdb_block_cache_total_count->set(block_cache_total);
     dinfo_replica("_pfc_rdb_block_cache_total_count: {}", block_cache_total);
 
+    uint64_t table_block_cache_usage = 0;
+    if (_block_cache && _block_cache != _s_block_cache) {
+        table_block_cache_usage = _block_cache->GetUsage();
+    }
+    _pfc_rdb_block_cache_table_mem_usage->set(table_block_cache_usage);
+    dinfo_replica("_pfc_rdb_block_cache_table_mem_usage: {} bytes", table_block_cache_usage);
+
+    uint64_t persistent_cache_hit = _statistics->getTickerCount(rocksdb::PERSISTENT_CACHE_HIT);
+    _pfc_rdb_persistent_cache_hit_count->set(persistent_cache_hit);
+    dinfo_replica("_pfc_rdb_persistent_cache_hit_count: {}", persistent_cache_hit);
+
+    uint64_t persistent_cache_miss = _statistics->getTickerCount(rocksdb::PERSISTENT_CACHE_MISS);
+    uint64_t persistent_cache_total = persistent_cache_hit + persistent_cache_miss;
+    _pfc_rdb_persistent_cache_total_count->set(persistent_cache_total);
+    dinfo_replica("_pfc_rdb_persistent_cache_total_count: {}", persistent_cache_total);
+
+    uint64_t row_cache_hit = _statistics->getTickerCount(rocksdb::ROW_CACHE_HIT);
+    _pfc_rdb_row_cache_hit_count->set(row_cache_hit);
+    dinfo_replica("_pfc_rdb_row_cache_hit_count: {}", row_cache_hit);
+
+    uint64_t row_cache_miss = _statistics->getTickerCount(rocksdb::ROW_CACHE_MISS);
+    uint64_t row_cache_total = row_cache_hit + row_cache_miss;
+    _pfc_rdb_row_cache_total_count->set(row_cache_total);
+    dinfo_replica("_pfc_rdb_row_cache_total_count: {}", row_cache_total);
+
     if (_db->GetProperty(rocksdb::DB::Properties::kEstimateTableReadersMem, &str_val) &&
         dsn::buf2uint64(str_val, val)) {
         _pfc_rdb_index_and_filter_blocks_mem_usage->set(val);
@@ -2334,15 +3587,187 @@ void pegasus_server_impl::update_replica_rocksdb_statistics()
     }
 }
 
+void pegasus_server_impl::sweep_scan_contexts()
+{
+    uint64_t expire_count = _context_cache.sweep_expired();
+    _pfc_recent_scan_context_expire_count->add(expire_count);
+    _pfc_recent_scan_context_evict_count->add(_context_cache.fetch_evict_count());
+    _pfc_scan_context_count->set(_context_cache.size());
+    _pfc_recent_scan_prefetch_waste_count->add(_scan_prefetch_quota->fetch_wasted_count());
+    _pfc_scan_prefetch_mem_usage->set(_scan_prefetch_quota->used_bytes());
+    if (expire_count > 0) {
+        dinfo_replica("{} scan contexts are expired and removed", expire_count);
+    }
+}
+
+void pegasus_server_impl::drop_expired_sst_files()
+{
+    rocksdb::TablePropertiesCollection props;
+    rocksdb::Status status = _db->GetPropertiesOfAllTables(&props);
+    if (!status.ok()) {
+        derror_replica("GetPropertiesOfAllTables failed, status = {}", status.ToString());
+        return;
+    }
+    rocksdb::ColumnFamilyMetaData meta;
+    _db->GetColumnFamilyMetaData(&meta);
+
+    // Dropping or skipping a file must not expose older versions of its keys, so only the
+    // files under which no file overlaps are considered. Files in level 0 are left to
+    // compaction, because they may overlap each other, except under FIFO compaction.
+    uint32_t epoch_now = utils::epoch_now();
+    std::vector<const rocksdb::SstFileMetaData *> to_drop;
+    std::unordered_map<uint64_t, uint32_t> skippable;
+    if (_data_cf_opts.compaction_style == rocksdb::kCompactionStyleFIFO) {
+        pick_expired_fifo_files(meta, props, epoch_now, to_drop);
+    }
+    for (size_t i = 1; i < meta.levels.size(); ++i) {
+        for (const rocksdb::SstFileMetaData &file : meta.levels[i].files) {
+            if (file.being_compacted) {
+                continue;
+            }
+            auto find = props.find(file.db_path + file.name);
+            sst_ttl_properties ttl_props;
+            if (find == props.end() ||
+                !ttl_props.decode(find->second->user_collected_properties) ||
+                !ttl_props.all_with_ttl() || overlap_in_lower_levels(meta, i, file)) {
+                continue;
+            }
+            if (ttl_props.all_expired(epoch_now)) {
+                to_drop.push_back(&file);
+            } else {
+                skippable.emplace(ttl_props.id, ttl_props.max_expire_ts);
+            }
+        }
+    }
+
+    _pfc_skippable_sst_count->set(skippable.size());
+    {
+        ::dsn::utils::auto_write_lock l(_skippable_sst_lock);
+        _skippable_sst.swap(skippable);
+    }
+
+    uint64_t drop_count = 0;
+    uint64_t drop_size = 0;
+    for (const rocksdb::SstFileMetaData *file : to_drop) {
+        // rocksdb checks again that the file is the last one of its key range, and not
+        // being compacted.
+        status = _db->DeleteFile(file->name);
+        if (!status.ok()) {
+            dinfo_replica("drop expired sst file {} failed, status = {}",
+                          file->name,
+                          status.ToString());
+            continue;
+        }
+        drop_count++;
+        drop_size += file->size;
+    }
+    _pfc_recent_expired_sst_drop_count->add(drop_count);
+    _pfc_recent_expired_sst_drop_size->add(drop_size);
+    if (drop_count > 0) {
+        ddebug_replica("dropped {} expired sst files, total size = {} bytes, skippable sst "
+                       "count = {}",
+                       drop_count,
+                       drop_size,
+                       skippable.size());
+    }
+}
+
+void pegasus_server_impl::pick_expired_fifo_files(
+    const rocksdb::ColumnFamilyMetaData &meta,
+    const rocksdb::TablePropertiesCollection &props,
+    uint32_t epoch_now,
+    std::vector<const rocksdb::SstFileMetaData *> &to_drop)
+{
+    if (meta.levels.empty()) {
+        return;
+    }
+    // Files in level 0 are sorted from the newest to the oldest. Only the oldest ones are
+    // dropped, so that no older version of the keys is exposed, and rocksdb only allows to
+    // delete the oldest file of level 0 as well.
+    const std::vector<rocksdb::SstFileMetaData> &files = meta.levels[0].files;
+    for (auto it = files.rbegin(); it != files.rend(); ++it) {
+        if (it->being_compacted) {
+            break;
+        }
+        auto find = props.find(it->db_path + it->name);
+        sst_ttl_properties ttl_props;
+        if (find == props.end() || !ttl_props.decode(find->second->user_collected_properties) ||
+            !ttl_props.all_expired(epoch_now)) {
+            break;
+        }
+        to_drop.push_back(&*it);
+    }
+}
+
+/*static*/ bool
+pegasus_server_impl::overlap_in_lower_levels(const rocksdb::ColumnFamilyMetaData &meta,
+                                             size_t level,
+                                             const rocksdb::SstFileMetaData &file)
+{
+    for (size_t i = level + 1; i < meta.levels.size(); ++i) {
+        for (const rocksdb::SstFileMetaData &lower : meta.levels[i].files) {
+            if (lower.smallestkey <= file.largestkey && file.smallestkey <= lower.largestkey) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void pegasus_server_impl::set_expired_sst_filter(rocksdb::ReadOptions &rd_opts)
+{
+    rd_opts.table_filter = [this](const rocksdb::TableProperties &props) {
+        auto find = props.user_collected_properties.find(sst_ttl_properties::PROP_ID);
+        if (find == props.user_collected_properties.end()) {
+            return true;
+        }
+        uint64_t id;
+        if (!dsn::buf2uint64(find->second, id)) {
+            return true;
+        }
+        ::dsn::utils::auto_read_lock l(_skippable_sst_lock);
+        auto skippable = _skippable_sst.find(id);
+        // return false to skip the file
+        return skippable == _skippable_sst.end() ||
+               !check_if_ts_expired(utils::epoch_now(), skippable->second);
+    };
+}
+
 void pegasus_server_impl::update_server_rocksdb_statistics()
 {
     if (_s_block_cache) {
         uint64_t val = _s_block_cache->GetUsage();
         _pfc_rdb_block_cache_mem_usage->set(val);
         dinfo_f("_pfc_rdb_block_cache_mem_usage: {} bytes", val);
+
+        val = _s_block_cache->GetPinnedUsage();
+        _pfc_rdb_block_cache_pinned_usage->set(val);
+        dinfo_f("_pfc_rdb_block_cache_pinned_usage: {} bytes", val);
     } else {
         dinfo("_pfc_rdb_block_cache_mem_usage: 0 bytes because block cache is disabled");
     }
+
+    if (_s_row_cache) {
+        uint64_t val = _s_row_cache->GetUsage();
+        _pfc_rdb_row_cache_mem_usage->set(val);
+        dinfo_f("_pfc_rdb_row_cache_mem_usage: {} bytes", val);
+    } else {
+        dinfo("_pfc_rdb_row_cache_mem_usage: 0 bytes because row cache is disabled");
+    }
+
+    if (_s_persistent_cache) {
+        // stats of persistent cache are reported by each tier of it
+        double val = 0;
+        for (const auto &tier_stats : _s_persistent_cache->Stats()) {
+            for (const auto &kv : tier_stats) {
+                if (boost::algorithm::ends_with(kv.first, ".bytes_written")) {
+                    val += kv.second;
+                }
+            }
+        }
+        _pfc_rdb_persistent_cache_write_bytes->set(static_cast<uint64_t>(val));
+        dinfo_f("_pfc_rdb_persistent_cache_write_bytes: {} bytes", val);
+    }
 }
 
 std::pair<std::string, bool>
@@ -2391,16 +3816,23 @@ void pegasus_server_impl::update_app_envs(const std::map<std::string, std::strin
     update_default_ttl(envs);
     update_checkpoint_reserve(envs);
     update_slow_query_threshold(envs);
+    update_sortkey_count_mode(envs);
+    update_block_cache(envs);
+    update_bulk_ingest(envs);
     _manual_compact_svc.start_manual_compact_if_needed(envs);
 }
 
 void pegasus_server_impl::update_app_envs_before_open_db(
     const std::map<std::string, std::string> &envs)
 {
-    // we do not update usage scenario because it depends on opened db.
+    // we do not update usage scenario because it depends on opened db, except the compaction
+    // style which can only be set before the db is opened.
+    update_compaction_style(envs);
     update_default_ttl(envs);
     update_checkpoint_reserve(envs);
     update_slow_query_threshold(envs);
+    update_sortkey_count_mode(envs);
+    update_block_cache(envs);
     _manual_compact_svc.start_manual_compact_if_needed(envs);
 }
 
@@ -2416,7 +3848,18 @@ void pegasus_server_impl::update_usage_scenario(const std::map<std::string, std:
     auto find = envs.find(ROCKSDB_ENV_USAGE_SCENARIO_KEY);
     std::string new_usage_scenario =
         (find != envs.end() ? find->second : ROCKSDB_ENV_USAGE_SCENARIO_NORMAL);
+    if (_compaction_style_fallback &&
+        get_compaction_style(new_usage_scenario) != _data_cf_opts.compaction_style) {
+        // the compaction style of the usage scenario failed to open the db and the fallback
+        // has been logged in start(), keep reporting the scenario which is in effect
+        new_usage_scenario = ROCKSDB_ENV_USAGE_SCENARIO_NORMAL;
+    }
     if (new_usage_scenario != _usage_scenario) {
+        if (get_compaction_style(new_usage_scenario) != _data_cf_opts.compaction_style) {
+            dwarn_replica("the compaction style of usage scenario \"{}\" will take effect after "
+                          "the replica is reopened",
+                          new_usage_scenario);
+        }
         std::string old_usage_scenario = _usage_scenario;
         if (set_usage_scenario(new_usage_scenario)) {
             ddebug_replica("update app env[{}] from \"{}\" to \"{}\" succeed",
@@ -2432,6 +3875,33 @@ void pegasus_server_impl::update_usage_scenario(const std::map<std::string, std:
     }
 }
 
+void pegasus_server_impl::update_compaction_style(const std::map<std::string, std::string> &envs)
+{
+    auto find = envs.find(ROCKSDB_ENV_USAGE_SCENARIO_KEY);
+    std::string usage_scenario =
+        (find != envs.end() ? find->second : ROCKSDB_ENV_USAGE_SCENARIO_NORMAL);
+    rocksdb::CompactionStyle style = get_compaction_style(usage_scenario);
+    if (style != _data_cf_opts.compaction_style) {
+        ddebug_replica("set compaction style from {} to {} for usage scenario \"{}\"",
+                       static_cast<int>(_data_cf_opts.compaction_style),
+                       static_cast<int>(style),
+                       usage_scenario);
+        _data_cf_opts.compaction_style = style;
+    }
+}
+
+/*static*/ rocksdb::CompactionStyle
+pegasus_server_impl::get_compaction_style(const std::string &usage_scenario)
+{
+    if (usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_TIME_SERIES) {
+        return rocksdb::kCompactionStyleFIFO;
+    }
+    if (usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_WRITE_HEAVY) {
+        return rocksdb::kCompactionStyleUniversal;
+    }
+    return rocksdb::kCompactionStyleLevel;
+}
+
 void pegasus_server_impl::update_default_ttl(const std::map<std::string, std::string> &envs)
 {
     auto find = envs.find(TABLE_LEVEL_DEFAULT_TTL);
@@ -2446,6 +3916,368 @@ void pegasus_server_impl::update_default_ttl(const std::map<std::string, std::st
     }
 }
 
+void pegasus_server_impl::update_sortkey_count_mode(const std::map<std::string, std::string> &envs)
+{
+    std::string mode = SORTKEY_COUNT_MODE_SCAN;
+    auto find = envs.find(SORTKEY_COUNT_MODE_KEY);
+    if (find != envs.end()) {
+        if (find->second != SORTKEY_COUNT_MODE_SCAN &&
+            find->second != SORTKEY_COUNT_MODE_MAINTAIN &&
+            find->second != SORTKEY_COUNT_MODE_META) {
+            derror_replica("{}={} is invalid.", find->first, find->second);
+            return;
+        }
+        mode = find->second;
+    }
+
+    bool maintained = (mode != SORTKEY_COUNT_MODE_SCAN);
+    bool by_meta = (mode == SORTKEY_COUNT_MODE_META);
+    if (by_meta) {
+        // the compaction filter adds ttl to the records without updating the metadata when
+        // default ttl is set, so the metadata may be not exact.
+        find = envs.find(TABLE_LEVEL_DEFAULT_TTL);
+        int32_t ttl = 0;
+        if (find != envs.end() && dsn::buf2int32(find->second, ttl) && ttl > 0) {
+            by_meta = false;
+        }
+    }
+
+    if (by_meta != _sortkey_count_by_meta.load()) {
+        _sortkey_count_by_meta.store(by_meta);
+        ddebug_replica(
+            "update app env[{}] to \"{}\", by_meta = {}", SORTKEY_COUNT_MODE_KEY, mode, by_meta);
+    }
+
+    // The switch of maintaining is applied as a write rather than following the env on each
+    // replica, because the replicas may see the env at different decrees. It is retried by the
+    // next update of app envs if it fails.
+    if (_is_open && is_primary() && maintained != _sortkey_count_maintained.load()) {
+        maintain_sortkey_count(maintained);
+    }
+}
+
+void pegasus_server_impl::maintain_sortkey_count(bool maintained)
+{
+    if (_sortkey_count_switching.exchange(true)) {
+        return;
+    }
+
+    auto request = dsn::make_unique<dsn::apps::maintain_sortkey_count_request>();
+    request->__set_maintained(maintained);
+    maintain_sortkey_count_rpc rpc(std::move(request),
+                                   dsn::apps::RPC_RRDB_RRDB_MAINTAIN_SORTKEY_COUNT,
+                                   std::chrono::milliseconds(0),
+                                   _gpid.get_partition_index());
+    rpc.dsn_request()->header->gpid = _gpid;
+    ddebug_replica("switch the sortkey_count metadata to be {}maintained",
+                   maintained ? "" : "not ");
+    rpc.call(dsn::rpc_address(dsn_primary_address()),
+             &_tracker,
+             [this, rpc, maintained](dsn::error_code err) mutable {
+                 _sortkey_count_switching.store(false);
+                 if (err != dsn::ERR_OK || rpc.response().error != rocksdb::Status::kOk) {
+                     derror_replica("switch the sortkey_count metadata to be {}maintained "
+                                    "failed, error = {}, response error = {}",
+                                    maintained ? "" : "not ",
+                                    err.to_string(),
+                                    rpc.response().error);
+                 }
+             });
+}
+
+void pegasus_server_impl::update_block_cache(const std::map<std::string, std::string> &envs)
+{
+    bool fill_cache = true;
+    auto find = envs.find(ROCKSDB_ENV_SCAN_FILL_BLOCK_CACHE);
+    if (find != envs.end() && !dsn::buf2bool(find->second, fill_cache)) {
+        derror_replica("{}={} is invalid.", find->first, find->second);
+        fill_cache = _scan_fill_block_cache.load();
+    }
+    if (fill_cache != _scan_fill_block_cache.load()) {
+        _scan_fill_block_cache.store(fill_cache);
+        ddebug_replica(
+            "update app env[{}] to \"{}\"", ROCKSDB_ENV_SCAN_FILL_BLOCK_CACHE, fill_cache);
+    }
+
+    if (_tbl_opts.no_block_cache) {
+        return;
+    }
+
+    uint64_t capacity = 0;
+    find = envs.find(ROCKSDB_ENV_BLOCK_CACHE_CAPACITY);
+    if (find != envs.end() && !dsn::buf2uint64(find->second, capacity)) {
+        derror_replica("{}={} is invalid.", find->first, find->second);
+        return;
+    }
+    if (capacity == _block_cache_capacity) {
+        return;
+    }
+
+    std::shared_ptr<rocksdb::Cache> block_cache = _s_block_cache;
+    if (_is_open) {
+        // the block cache of an opened db can not be replaced, but the capacity of the
+        // dedicated block cache can be changed.
+        if (capacity == 0 || _block_cache_capacity == 0) {
+            if (capacity != _block_cache_pending_capacity) {
+                dwarn_replica("update app env[{}] from {} to {} will take effect after the "
+                              "replica is reopened",
+                              ROCKSDB_ENV_BLOCK_CACHE_CAPACITY,
+                              _block_cache_capacity,
+                              capacity);
+                _block_cache_pending_capacity = capacity;
+            }
+            return;
+        }
+        if (get_app_block_cache(capacity) == nullptr) {
+            return;
+        }
+    } else {
+        if (capacity != 0) {
+            block_cache = get_app_block_cache(capacity);
+            if (block_cache == nullptr) {
+                return;
+            }
+        }
+        _block_cache = std::move(block_cache);
+        _tbl_opts.block_cache = _block_cache;
+        _data_cf_opts.table_factory.reset(NewBlockBasedTableFactory(_tbl_opts));
+    }
+    ddebug_replica("update app env[{}] from {} to {}",
+                   ROCKSDB_ENV_BLOCK_CACHE_CAPACITY,
+                   _block_cache_capacity,
+                   capacity);
+    _block_cache_capacity = capacity;
+    _block_cache_pending_capacity = capacity;
+}
+
+void pegasus_server_impl::update_bulk_ingest(const std::map<std::string, std::string> &envs)
+{
+    auto find = envs.find(ROCKSDB_ENV_BULK_INGEST_DIR);
+    if (find == envs.end() || find->second.empty()) {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr> l(_bulk_ingest_lock);
+        _bulk_ingest_dir.clear();
+        return;
+    }
+    if (!_is_open || !is_primary()) {
+        return;
+    }
+
+    std::string dir = find->second;
+    {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr> l(_bulk_ingest_lock);
+        if (dir == _bulk_ingest_dir) {
+            return;
+        }
+        _bulk_ingest_dir = dir;
+    }
+
+    // the build is checked only once by the primary, since the partition version may be
+    // unknown or different on the replicas.
+    rocksdb::Status status = check_bulk_ingest(dir);
+    if (!status.ok()) {
+        derror_replica("refuse to ingest sst files in {}, status = {}", dir, status.ToString());
+        return;
+    }
+
+    auto request = dsn::make_unique<dsn::apps::bulk_ingest_request>();
+    request->__set_dir(dir);
+    bulk_ingest_rpc rpc(std::move(request),
+                        dsn::apps::RPC_RRDB_RRDB_BULK_INGEST,
+                        std::chrono::milliseconds(0),
+                        _gpid.get_partition_index());
+    rpc.dsn_request()->header->gpid = _gpid;
+    ddebug_replica("start to ingest sst files in {}", dir);
+    rpc.call(dsn::rpc_address(dsn_primary_address()),
+             &_tracker,
+             [this, rpc, dir](dsn::error_code err) mutable {
+                 if (err == dsn::ERR_OK && rpc.response().error == rocksdb::Status::kOk) {
+                     ddebug_replica("ingest sst files in {} succeed at decree {}",
+                                    dir,
+                                    rpc.response().decree);
+                     return;
+                 }
+                 derror_replica("ingest sst files in {} failed, error = {}, response error = {}",
+                                dir,
+                                err.to_string(),
+                                rpc.response().error);
+                 if (err != dsn::ERR_OK) {
+                     // resent on the next update of envs, the ingestion is done only once
+                     ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr> l(_bulk_ingest_lock);
+                     if (_bulk_ingest_dir == dir) {
+                         _bulk_ingest_dir.clear();
+                     }
+                 }
+             });
+}
+
+rocksdb::Status pegasus_server_impl::check_bulk_ingest(const std::string &dir)
+{
+    ingest_meta meta;
+    rocksdb::Status status = meta.load(dir);
+    if (!status.ok()) {
+        return status;
+    }
+    if (meta.data_version != _pegasus_data_version) {
+        return rocksdb::Status::InvalidArgument(fmt::format(
+            "data version mismatch: {} vs {}", meta.data_version, _pegasus_data_version));
+    }
+    // the records are split by the partition count of the build, which must be the same as
+    // the table, otherwise some of them are ingested into the wrong partitions.
+    int32_t partition_version = _partition_version.load(std::memory_order_relaxed);
+    if (partition_version < 0) {
+        return rocksdb::Status::InvalidArgument("partition count of the table is unknown");
+    }
+    if (meta.partition_count != partition_version + 1) {
+        return rocksdb::Status::InvalidArgument(fmt::format("partition count mismatch: {} vs {}",
+                                                            meta.partition_count,
+                                                            partition_version + 1));
+    }
+    // ingested records are not counted by the sortkey_count meta records.
+    if (_sortkey_count_maintained.load() || _sortkey_count_by_meta.load()) {
+        return rocksdb::Status::NotSupported(
+            fmt::format("{} must be {}", SORTKEY_COUNT_MODE_KEY, SORTKEY_COUNT_MODE_SCAN));
+    }
+    return rocksdb::Status::OK();
+}
+
+rocksdb::Status pegasus_server_impl::ingest_sst_files(const std::string &dir)
+{
+    ingest_meta meta;
+    rocksdb::Status status = meta.load(dir);
+    if (!status.ok()) {
+        return status;
+    }
+    if (meta.data_version != _pegasus_data_version) {
+        return rocksdb::Status::InvalidArgument(fmt::format(
+            "data version mismatch: {} vs {}", meta.data_version, _pegasus_data_version));
+    }
+    // whether the metadata is maintained is switched at the same decree on all the replicas.
+    if (_sortkey_count_maintained.load()) {
+        return rocksdb::Status::NotSupported("sortkey_count metadata is maintained");
+    }
+
+    // the marker record is ingested at last, so the ingestion is done if it exists.
+    std::string marker_value;
+    status = _db->Get(_data_cf_rd_opts, ingest_marker_key(meta.id), &marker_value);
+    if (status.ok()) {
+        ddebug_replica("sst files in {} have been ingested, ingest id = {}", dir, meta.id);
+        return rocksdb::Status::OK();
+    }
+    if (!status.IsNotFound()) {
+        return status;
+    }
+
+    // the files are named by seq, and should be ingested in the order of seq.
+    std::string partition_dir = ::dsn::utils::filesystem::path_combine(
+        dir, std::to_string(_gpid.get_partition_index()));
+    std::vector<std::string> files;
+    if (!::dsn::utils::filesystem::get_subfiles(partition_dir, files, false)) {
+        return rocksdb::Status::IOError("list files failed", partition_dir);
+    }
+    std::map<uint64_t, std::string> seq_files;
+    for (const std::string &file : files) {
+        std::string name = ::dsn::utils::filesystem::get_file_name(file);
+        uint64_t seq;
+        if (name.size() <= 4 || name.compare(name.size() - 4, 4, ".sst") != 0 ||
+            !dsn::buf2uint64(name.substr(0, name.size() - 4), seq)) {
+            dwarn_replica("ignore unknown file {} in {}", name, partition_dir);
+            continue;
+        }
+        seq_files.emplace(seq, file);
+    }
+
+    // flush the records written before this decree, otherwise they are replayed after the
+    // ingestion once the replica restarts, and override the ingested records.
+    status = _db->Flush(rocksdb::FlushOptions());
+    if (!status.ok()) {
+        return status;
+    }
+
+    // Files are ingested one by one, because the files of different seqs may overlap, and the
+    // later ones should override the earlier ones.
+    rocksdb::IngestExternalFileOptions ingest_opts;
+    ingest_opts.move_files = false;
+    ingest_opts.allow_blocking_flush = true;
+    for (const auto &kv : seq_files) {
+        status = _db->IngestExternalFile({kv.second}, ingest_opts);
+        if (!status.ok()) {
+            return status;
+        }
+        _pfc_recent_bulk_ingest_file_count->increment();
+        dinfo_replica("ingested sst file {}", kv.second);
+    }
+    ddebug_replica("ingested {} sst files in {}, ingest id = {}", seq_files.size(), dir, meta.id);
+    return rocksdb::Status::OK();
+}
+
+std::shared_ptr<rocksdb::Cache> pegasus_server_impl::get_app_block_cache(uint64_t capacity)
+{
+    int32_t app_id = _gpid.get_app_id();
+    // declared before the lock, because the deleter of the cache acquires the lock
+    std::shared_ptr<rocksdb::Cache> cache;
+    std::lock_guard<std::mutex> l(_s_app_block_caches_lock);
+    app_block_cache &entry = _s_app_block_caches[app_id];
+    cache = entry.cache.lock();
+    // the capacity of a released cache whose deleter is not run yet is given back here
+    uint64_t old_capacity = cache ? entry.capacity : 0;
+    uint64_t total_capacity = _s_app_block_caches_capacity - entry.capacity + capacity;
+    if (total_capacity >= _s_block_cache_capacity) {
+        derror_replica("dedicated block caches of {} bytes in total exceed the capacity of the "
+                       "block cache {}, ignore the capacity {}",
+                       total_capacity,
+                       _s_block_cache_capacity,
+                       capacity);
+        if (!cache) {
+            _s_app_block_caches_capacity -= entry.capacity;
+            _s_app_block_caches.erase(app_id);
+        }
+        return nullptr;
+    }
+
+    if (cache) {
+        cache->SetCapacity(capacity);
+    } else {
+        std::shared_ptr<rocksdb::Cache> new_cache =
+            rocksdb::NewLRUCache(capacity, -1, false, _s_block_cache_high_pri_pool_ratio);
+        cache.reset(new_cache.get(), [app_id, new_cache](rocksdb::Cache *raw_cache) {
+            release_app_block_cache(app_id, raw_cache);
+        });
+        entry.cache = cache;
+        entry.raw_cache = new_cache.get();
+    }
+    _s_app_block_caches_capacity = total_capacity;
+    entry.capacity = capacity;
+    update_shared_block_cache_capacity();
+    ddebug_replica("dedicated block cache capacity updated from {} to {}, shared block cache "
+                   "capacity = {}",
+                   old_capacity,
+                   capacity,
+                   _s_block_cache->GetCapacity());
+    return cache;
+}
+
+/*static*/ void pegasus_server_impl::release_app_block_cache(int32_t app_id,
+                                                            const rocksdb::Cache *cache)
+{
+    std::lock_guard<std::mutex> l(_s_app_block_caches_lock);
+    auto find = _s_app_block_caches.find(app_id);
+    if (find == _s_app_block_caches.end() || find->second.raw_cache != cache) {
+        // replaced by a new one, which has taken over the capacity
+        return;
+    }
+    _s_app_block_caches_capacity -= find->second.capacity;
+    _s_app_block_caches.erase(find);
+    update_shared_block_cache_capacity();
+    ddebug("dedicated block cache of app %d is released, shared block cache capacity = %" PRIu64,
+           app_id,
+           static_cast<uint64_t>(_s_block_cache->GetCapacity()));
+}
+
+/*static*/ void pegasus_server_impl::update_shared_block_cache_capacity()
+{
+    _s_block_cache->SetCapacity(_s_block_cache_capacity - _s_app_block_caches_capacity);
+}
+
 void pegasus_server_impl::update_checkpoint_reserve(const std::map<std::string, std::string> &envs)
 {
     int32_t count = _checkpoint_reserve_min_count_in_config;
@@ -2592,7 +4424,9 @@ bool pegasus_server_impl::set_usage_scenario(const std::string &usage_scenario)
     std::string old_usage_scenario = _usage_scenario;
     std::unordered_map<std::string, std::string> new_options;
     if (usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_NORMAL ||
-        usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_PREFER_WRITE) {
+        usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_PREFER_WRITE ||
+        usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_TIME_SERIES ||
+        usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_WRITE_HEAVY) {
         if (_usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_BULK_LOAD) {
             // old usage scenario is bulk load, reset first
             new_options["level0_file_num_compaction_trigger"] =
@@ -2613,7 +4447,9 @@ bool pegasus_server_impl::set_usage_scenario(const std::string &usage_scenario)
                 std::to_string(_data_cf_opts.max_write_buffer_number);
         }
 
-        if (usage_scenario == ROCKSDB_ENV_USAGE_SCENARIO_NORMAL) {
+        if (usage_scenario != ROCKSDB_ENV_USAGE_SCENARIO_PREFER_WRITE) {
+            // the compaction style of 'time_series' and 'write_heavy' is set when the db is
+            // opened, the other options are the same as 'normal'.
             new_options["write_buffer_size"] =
                 std::to_string(get_random_nearby(_data_cf_opts.write_buffer_size));
             new_options["level0_file_num_compaction_trigger"] =
@@ -2781,7 +4617,7 @@ void pegasus_server_impl::set_partition_version(int32_t partition_version)
     ddebug_replica(
         "update partition version from {} to {}", old_partition_version, partition_version);
 
-    // TODO(heyuchen): set filter _partition_version in further pr
+    _key_ttl_compaction_filter_factory->SetPartitionVersion(partition_version);
 }
 
 } // namespace server
@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <map>
+#include <mutex>
 #include <vector>
 #include <rocksdb/db.h>
 #include <rocksdb/table.h>
 #include <rocksdb/listener.h>
 #include <rocksdb/options.h>
+#include <rocksdb/persistent_cache.h>
 #include <dsn/perf_counter/perf_counter_wrapper.h>
 #include <dsn/dist/replication/replication.codes.h>
 #include <rrdb/rrdb_types.h>
@@ -16,6 +19,8 @@
 #include <gtest/gtest_prod.h>
 
 #include "key_ttl_compaction_filter.h"
+#include "ttl_table_properties_collector.h"
+#include "read_perf_context.h"
 #include "pegasus_scan_context.h"
 #include "pegasus_manual_compact_service.h"
 #include "pegasus_write_service.h"
@@ -35,6 +40,9 @@ public:
             "pegasus", replication_app_base::create<pegasus::server::pegasus_server_impl>);
         register_rpc_handlers();
     }
+    // Update the task specs of write rpcs by the config. The task specs are shared by all the
+    // replicas, so it should be called once on server startup before any replica is opened.
+    static void init_batch_write_codes();
     explicit pegasus_server_impl(dsn::replication::replica *r);
 
     virtual ~pegasus_server_impl() override;
@@ -44,6 +52,8 @@ public:
                         ::dsn::rpc_replier<::dsn::apps::read_response> &reply) override;
     virtual void on_multi_get(const ::dsn::apps::multi_get_request &args,
                               ::dsn::rpc_replier<::dsn::apps::multi_get_response> &reply) override;
+    virtual void on_batch_get(const ::dsn::apps::batch_get_request &args,
+                              ::dsn::rpc_replier<::dsn::apps::batch_get_response> &reply) override;
     virtual void on_sortkey_count(const ::dsn::blob &args,
                                   ::dsn::rpc_replier<::dsn::apps::count_response> &reply) override;
     virtual void on_ttl(const ::dsn::blob &key,
@@ -53,6 +63,12 @@ public:
     virtual void on_scan(const ::dsn::apps::scan_request &args,
                          ::dsn::rpc_replier<::dsn::apps::scan_response> &reply) override;
     virtual void on_clear_scanner(const int64_t &args) override;
+    // reads reaching a secondary are only served within the staleness bound, otherwise they are
+    // replied with ERR_INVALID_STATE, on which the client retries on the primary
+    virtual int on_request(dsn::message_ex *request) override;
+    virtual void
+    on_aggregate_scan(const ::dsn::apps::aggregate_scan_request &args,
+                      ::dsn::rpc_replier<::dsn::apps::aggregate_scan_response> &reply) override;
 
     // input:
     //  - argc = 0 : re-open the db
@@ -159,6 +175,7 @@ private:
     friend class manual_compact_service_test;
     friend class pegasus_compression_options_test;
     friend class pegasus_server_impl_test;
+    friend class pegasus_write_service_impl_test;
     FRIEND_TEST(pegasus_server_impl_test, default_data_version);
 
     friend class pegasus_manual_compact_service;
@@ -174,6 +191,19 @@ private:
 
     void set_last_durable_decree(int64_t decree) { _last_durable_decree.store(decree); }
 
+    // return 1 if value is valid
+    // return 2 if value is expired
+    // return 3 if value is filtered
+    int validate_key_value_for_scan(const rocksdb::Slice &key,
+                                    const rocksdb::Slice &value,
+                                    ::dsn::apps::filter_type::type hash_key_filter_type,
+                                    const ::dsn::blob &hash_key_filter_pattern,
+                                    ::dsn::apps::filter_type::type sort_key_filter_type,
+                                    const ::dsn::blob &sort_key_filter_pattern,
+                                    ::dsn::apps::filter_type::type value_filter_type,
+                                    const ::dsn::blob &value_filter_pattern,
+                                    uint32_t epoch_now);
+
     // return 1 if value is appended
     // return 2 if value is expired
     // return 3 if value is filtered
@@ -184,6 +214,8 @@ private:
                                   const ::dsn::blob &hash_key_filter_pattern,
                                   ::dsn::apps::filter_type::type sort_key_filter_type,
                                   const ::dsn::blob &sort_key_filter_pattern,
+                                  ::dsn::apps::filter_type::type value_filter_type,
+                                  const ::dsn::blob &value_filter_pattern,
                                   uint32_t epoch_now,
                                   bool no_value);
 
@@ -195,6 +227,8 @@ private:
                                        const rocksdb::Slice &value,
                                        ::dsn::apps::filter_type::type sort_key_filter_type,
                                        const ::dsn::blob &sort_key_filter_pattern,
+                                       ::dsn::apps::filter_type::type value_filter_type,
+                                       const ::dsn::blob &value_filter_pattern,
                                        uint32_t epoch_now,
                                        bool no_value);
 
@@ -205,6 +239,87 @@ private:
                filter_type <= ::dsn::apps::filter_type::FT_MATCH_POSTFIX;
     }
 
+    // iterate the next batch of `context` into `batch`, `prefetch_bytes` > 0 means the batch
+    // is prefetched, whose size is limited by the bytes reserved from the prefetch quota
+    void scan_batch(pegasus_scan_context *context,
+                    uint64_t start_time_ns,
+                    int64_t deadline_ms,
+                    pegasus_scan_batch &batch,
+                    int64_t prefetch_bytes = 0);
+
+    // iterate the next batch of `context` in background if the prefetch quota allows, which
+    // will be replied by the next on_scan(), the iterator of the context should not be used by
+    // others until the task is finished
+    void start_scan_prefetch(const std::shared_ptr<pegasus_scan_context> &context);
+
+    static void move_scan_iterator(rocksdb::Iterator *it, bool reverse)
+    {
+        if (reverse) {
+            it->Prev();
+        } else {
+            it->Next();
+        }
+    }
+
+    // return true if the scan batch should be finished as exceeding the byte or time limit,
+    // a limit <= 0 means no limit
+    static bool is_scan_batch_full(int64_t batch_bytes,
+                                   uint64_t start_time_ns,
+                                   int64_t max_batch_bytes,
+                                   int64_t max_batch_time_us)
+    {
+        return (max_batch_bytes > 0 && batch_bytes >= max_batch_bytes) ||
+               (max_batch_time_us > 0 &&
+                dsn_now_ns() - start_time_ns >= static_cast<uint64_t>(max_batch_time_us) * 1000);
+    }
+
+    // return true if the request has been past `deadline_ms`, which is the client deadline in
+    // milliseconds since unix epoch, <= 0 means no deadline
+    bool is_past_deadline(int64_t deadline_ms) const
+    {
+        return deadline_ms > 0 && utils::unix_now_ms() > deadline_ms + _request_deadline_skew_ms;
+    }
+
+    // return true if reads can be served by this replica when it is not the primary, that is,
+    // secondary reads are allowed and the last write applied here was prepared by the primary
+    // within `_secondary_read_max_staleness_ms`. The primary writes empty mutations when idle,
+    // so an idle replica is not regarded as stale for long.
+    bool can_serve_secondary_read() const
+    {
+        int64_t staleness_us = static_cast<int64_t>(dsn_now_us()) -
+                               static_cast<int64_t>(_last_applied_write_time_us.load());
+        return _allow_secondary_read && staleness_us <= _secondary_read_max_staleness_ms * 1000;
+    }
+
+    // is_past_deadline() for iterating, only checked once every `DEADLINE_CHECK_INTERVAL`
+    // iterated records to avoid reading the clock for each record
+    bool is_past_deadline_on_iterate(int64_t deadline_ms, int64_t iterate_count) const
+    {
+        return iterate_count % DEADLINE_CHECK_INTERVAL == 0 && is_past_deadline(deadline_ms);
+    }
+
+    // return false if the record of `key` does not belong to this partition under the current
+    // partition version, which is possible after partition split, see validate_partition_hash
+    bool check_key_hash(const ::dsn::blob &key) const
+    {
+        return !_validate_partition_hash || check_partition_hash(pegasus_key_hash(key));
+    }
+
+    // same as check_key_hash(), but for all records of `hash_key`
+    bool check_hash_key_hash(const ::dsn::blob &hash_key) const
+    {
+        return !_validate_partition_hash || check_partition_hash(pegasus_hash_key_hash(hash_key));
+    }
+
+    // the partition version is -1 until set_partition_version() is called or while it is
+    // invalid, in which case nothing is validated, the same as the compaction filter
+    bool check_partition_hash(uint64_t key_hash) const
+    {
+        int32_t partition_version = _partition_version.load(std::memory_order_relaxed);
+        return partition_version < 0 ||
+               check_pegasus_key_hash(key_hash, _gpid.get_partition_index(), partition_version);
+    }
+
     // return true if the data is valid for the filter
     bool validate_filter(::dsn::apps::filter_type::type filter_type,
                          const ::dsn::blob &filter_pattern,
@@ -212,6 +327,26 @@ private:
 
     void update_replica_rocksdb_statistics();
 
+    // remove the expired scan contexts, and update the statistics of scan context cache.
+    void sweep_scan_contexts();
+
+    // drop the sst files whose records are all expired, and update the files which will be
+    // skipped by scans once expired.
+    void drop_expired_sst_files();
+
+    // drop the oldest files in level 0 whose records are all expired, under FIFO compaction.
+    void pick_expired_fifo_files(const rocksdb::ColumnFamilyMetaData &meta,
+                                 const rocksdb::TablePropertiesCollection &props,
+                                 uint32_t epoch_now,
+                                 std::vector<const rocksdb::SstFileMetaData *> &to_drop);
+
+    static bool overlap_in_lower_levels(const rocksdb::ColumnFamilyMetaData &meta,
+                                        size_t level,
+                                        const rocksdb::SstFileMetaData &file);
+
+    // skip the expired files found by drop_expired_sst_files() when iterating with `rd_opts`.
+    void set_expired_sst_filter(rocksdb::ReadOptions &rd_opts);
+
     static void update_server_rocksdb_statistics();
 
     // get the absolute path of restore directory and the flag whether force restore from env
@@ -231,6 +366,40 @@ private:
 
     void update_slow_query_threshold(const std::map<std::string, std::string> &envs);
 
+    // update whether sortkey_count is served by the metadata, and switch whether the metadata
+    // is maintained if this replica is primary
+    void update_sortkey_count_mode(const std::map<std::string, std::string> &envs);
+
+    // send MAINTAIN_SORTKEY_COUNT to this replica, which is applied as a write so that all the
+    // replicas switch whether the sortkey_count metadata is maintained at the same decree.
+    void maintain_sortkey_count(bool maintained);
+
+    // update the block cache used by this table, and whether scans fill the block cache
+    void update_block_cache(const std::map<std::string, std::string> &envs);
+
+    // send BULK_INGEST of the dir of ROCKSDB_ENV_BULK_INGEST_DIR to this replica if it is the
+    // primary, which is applied as a write so that all the replicas ingest at the same decree.
+    void update_bulk_ingest(const std::map<std::string, std::string> &envs);
+
+    // check whether the sst files built in `dir` can be ingested into this table, which is done
+    // by the primary before BULK_INGEST is sent.
+    rocksdb::Status check_bulk_ingest(const std::string &dir);
+
+    // ingest the sst files of this partition built by pegasus_sst_builder in `dir` when
+    // BULK_INGEST is applied, return OK if they have been ingested before.
+    rocksdb::Status ingest_sst_files(const std::string &dir);
+
+    // get the block cache dedicated to this table and shared by its replicas on this server,
+    // and set its capacity, which is taken from the shared block cache and given back once the
+    // dedicated one is released. Return nullptr if the shared block cache can not spare it.
+    std::shared_ptr<rocksdb::Cache> get_app_block_cache(uint64_t capacity);
+
+    // give the capacity of the released block cache `cache` of `app_id` back to the shared one
+    static void release_app_block_cache(int32_t app_id, const rocksdb::Cache *cache);
+
+    // set the capacity of the shared block cache to what is left by the dedicated ones
+    static void update_shared_block_cache_capacity();
+
     // return true if parse compression types 'config' success, otherwise return false.
     // 'compression_per_level' will not be changed if parse failed.
     bool parse_compression_types(const std::string &config,
@@ -252,6 +421,12 @@ private:
     // return true if successfully changed
     bool set_usage_scenario(const std::string &usage_scenario);
 
+    // set the compaction style of the usage scenario in the envs, which takes effect when the db
+    // is opened.
+    void update_compaction_style(const std::map<std::string, std::string> &envs);
+
+    static rocksdb::CompactionStyle get_compaction_style(const std::string &usage_scenario);
+
     // return true if successfully set
     bool set_options(const std::unordered_map<std::string, std::string> &new_options);
 
@@ -299,6 +474,10 @@ private:
 
 private:
     static const std::string COMPRESSION_HEADER;
+    static const int64_t DEADLINE_CHECK_INTERVAL;
+    // error hint of the reads shed or truncated as past the client deadline, to be told apart
+    // from the rocksdb timeouts
+    static const std::string DEADLINE_ERROR_HINT;
 
     dsn::gpid _gpid;
     std::string _primary_address;
@@ -309,19 +488,60 @@ private:
     // slow query time threshold. exceed this threshold will be logged.
     uint64_t _slow_query_threshold_ns;
     uint64_t _slow_query_threshold_ns_in_config;
+    // tolerance of the clock skew when checking the client deadline of read requests
+    int64_t _request_deadline_skew_ms;
+    // whether to check that the requested keys belong to this partition, see check_key_hash()
+    bool _validate_partition_hash;
+    // whether and how stale reads are served by secondaries, see can_serve_secondary_read()
+    bool _allow_secondary_read;
+    int64_t _secondary_read_max_staleness_ms;
+    // whether incr requested as blind is applied by merge, the merge operator is installed
+    // only if it is enabled.
+    bool _enable_blind_incr;
 
     std::shared_ptr<KeyWithTTLCompactionFilterFactory> _key_ttl_compaction_filter_factory;
+    std::shared_ptr<ttl_table_properties_collector_factory> _ttl_properties_collector_factory;
     std::shared_ptr<rocksdb::Statistics> _statistics;
     rocksdb::DBOptions _db_opts;
     rocksdb::ColumnFamilyOptions _data_cf_opts;
+    rocksdb::BlockBasedTableOptions _tbl_opts;
     rocksdb::ReadOptions _data_cf_rd_opts;
     std::string _usage_scenario;
+    // whether the db is opened with level compaction because the compaction style of the
+    // usage scenario failed to open it
+    bool _compaction_style_fallback{false};
 
     rocksdb::DB *_db;
     static std::shared_ptr<rocksdb::Cache> _s_block_cache;
+    static std::shared_ptr<rocksdb::Cache> _s_row_cache;
+    static std::shared_ptr<rocksdb::PersistentCache> _s_persistent_cache;
+    static double _s_block_cache_high_pri_pool_ratio;
+    // the configured capacity of the block cache of this server, which is split between the
+    // shared block cache and the dedicated ones
+    static uint64_t _s_block_cache_capacity;
+    // block caches dedicated to tables, app_id -> block cache, which is released when all
+    // replicas of the table on this server are closed.
+    struct app_block_cache
+    {
+        std::weak_ptr<rocksdb::Cache> cache;
+        const rocksdb::Cache *raw_cache{nullptr};
+        uint64_t capacity{0};
+    };
+    static std::mutex _s_app_block_caches_lock;
+    static std::map<int32_t, app_block_cache> _s_app_block_caches;
+    static uint64_t _s_app_block_caches_capacity; // total capacity of the dedicated ones
+    // block cache used by this replica, either _s_block_cache or the one dedicated to this table
+    std::shared_ptr<rocksdb::Cache> _block_cache;
+    uint64_t _block_cache_capacity{0}; // capacity of the dedicated block cache, 0 if shared
+    // the capacity which takes effect after the replica is reopened, to log it only once
+    uint64_t _block_cache_pending_capacity{0};
+    std::atomic<bool> _scan_fill_block_cache{true};
     volatile bool _is_open;
     uint32_t _pegasus_data_version;
     std::atomic<int64_t> _last_durable_decree;
+    // the time in microseconds when the primary prepared the last mutation applied here,
+    // see can_serve_secondary_read()
+    std::atomic<uint64_t> _last_applied_write_time_us;
 
     std::unique_ptr<capacity_unit_calculator> _cu_calculator;
     std::unique_ptr<pegasus_server_write> _server_write;
@@ -334,7 +554,24 @@ private:
     ::dsn::utils::ex_lock_nr _checkpoints_lock; // protected the following checkpoints vector
     std::deque<int64_t> _checkpoints;           // ordered checkpoints
 
+    // shared with the contexts, which may be held by the prefetch tasks
+    std::shared_ptr<pegasus_scan_prefetch_quota> _scan_prefetch_quota;
+    int64_t _scan_prefetch_batch_bytes;
     pegasus_context_cache _context_cache;
+    std::chrono::seconds _scan_context_sweep_interval;
+    ::dsn::task_ptr _sweep_scan_context;
+
+    std::chrono::seconds _drop_expired_sst_interval;
+    ::dsn::task_ptr _drop_expired_sst;
+    // id -> max_expire_ts of sst files which can be skipped by scans once expired, see
+    // drop_expired_sst_files().
+    ::dsn::utils::rw_lock_nr _skippable_sst_lock;
+    std::unordered_map<uint64_t, uint32_t> _skippable_sst;
+
+    // the dir which BULK_INGEST has been sent or refused for by this primary, see
+    // update_bulk_ingest().
+    ::dsn::utils::ex_lock_nr _bulk_ingest_lock;
+    std::string _bulk_ingest_dir;
 
     std::chrono::seconds _update_rdb_stat_interval;
     ::dsn::task_ptr _update_replica_rdb_stat;
@@ -344,29 +581,73 @@ private:
 
     std::atomic<int32_t> _partition_version;
 
+    // whether the sortkey_count metadata is maintained by the write path and its generation,
+    // which are published by the write service once applied, see sortkey_count_state. And
+    // whether sortkey_count is served by the metadata, see SORTKEY_COUNT_MODE_KEY.
+    std::atomic<bool> _sortkey_count_maintained{false};
+    std::atomic<uint64_t> _sortkey_count_generation{0};
+    std::atomic<bool> _sortkey_count_by_meta{false};
+    // whether MAINTAIN_SORTKEY_COUNT is sent and not replied yet
+    std::atomic<bool> _sortkey_count_switching{false};
+
     dsn::task_tracker _tracker;
 
     // perf counters
     ::dsn::perf_counter_wrapper _pfc_get_qps;
     ::dsn::perf_counter_wrapper _pfc_multi_get_qps;
+    ::dsn::perf_counter_wrapper _pfc_batch_get_qps;
     ::dsn::perf_counter_wrapper _pfc_scan_qps;
+    ::dsn::perf_counter_wrapper _pfc_aggregate_scan_qps;
 
     ::dsn::perf_counter_wrapper _pfc_get_latency;
     ::dsn::perf_counter_wrapper _pfc_multi_get_latency;
+    ::dsn::perf_counter_wrapper _pfc_batch_get_latency;
     ::dsn::perf_counter_wrapper _pfc_scan_latency;
+    ::dsn::perf_counter_wrapper _pfc_aggregate_scan_latency;
 
     ::dsn::perf_counter_wrapper _pfc_recent_expire_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_sortkey_count_read_count;
     ::dsn::perf_counter_wrapper _pfc_recent_filter_count;
     ::dsn::perf_counter_wrapper _pfc_recent_abnormal_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_read_shed_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_read_truncate_count;
+    ::dsn::perf_counter_wrapper _pfc_compaction_style_fallback_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_bulk_ingest_file_count;
+    read_perf_counters _get_perf_counters;
+    read_perf_counters _multi_get_perf_counters;
+    read_perf_counters _scan_perf_counters;
+#ifdef PEGASUS_UNIT_TEST
+    // the rocksdb breakdown logged for the last abnormal read
+    read_perf_stat _last_abnormal_perf_stat;
+#endif
+
+    ::dsn::perf_counter_wrapper _pfc_scan_context_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_scan_context_evict_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_scan_context_expire_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_scan_prefetch_hit_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_scan_prefetch_waste_count;
+    ::dsn::perf_counter_wrapper _pfc_scan_prefetch_mem_usage;
+
+    ::dsn::perf_counter_wrapper _pfc_recent_expired_sst_drop_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_expired_sst_drop_size;
+    ::dsn::perf_counter_wrapper _pfc_skippable_sst_count;
 
     // rocksdb internal statistics
     // server level
     static ::dsn::perf_counter_wrapper _pfc_rdb_block_cache_mem_usage;
+    static ::dsn::perf_counter_wrapper _pfc_rdb_block_cache_pinned_usage;
+    static ::dsn::perf_counter_wrapper _pfc_rdb_row_cache_mem_usage;
+    static ::dsn::perf_counter_wrapper _pfc_rdb_persistent_cache_write_bytes;
     // replica level
     ::dsn::perf_counter_wrapper _pfc_rdb_sst_count;
     ::dsn::perf_counter_wrapper _pfc_rdb_sst_size;
     ::dsn::perf_counter_wrapper _pfc_rdb_block_cache_hit_count;
     ::dsn::perf_counter_wrapper _pfc_rdb_block_cache_total_count;
+    ::dsn::perf_counter_wrapper _pfc_rdb_block_cache_table_mem_usage;
+    ::dsn::perf_counter_wrapper _pfc_rdb_persistent_cache_hit_count;
+    ::dsn::perf_counter_wrapper _pfc_rdb_persistent_cache_total_count;
+    ::dsn::perf_counter_wrapper _pfc_rdb_row_cache_hit_count;
+    ::dsn::perf_counter_wrapper _pfc_rdb_row_cache_total_count;
     ::dsn::perf_counter_wrapper _pfc_rdb_index_and_filter_blocks_mem_usage;
     ::dsn::perf_counter_wrapper _pfc_rdb_memtable_mem_usage;
     ::dsn::perf_counter_wrapper _pfc_rdb_estimate_num_keys;
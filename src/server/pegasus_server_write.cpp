@@ -36,21 +36,6 @@ int pegasus_server_write::on_batched_write_requests(dsn::message_ex **requests,
     }
 
     dsn::task_code rpc_code(requests[0]->rpc_code());
-    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_PUT) {
-        dassert(count == 1, "count = %d", count);
-        auto rpc = multi_put_rpc::auto_reply(requests[0]);
-        return _write_svc->multi_put(_write_ctx, rpc.request(), rpc.response());
-    }
-    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE) {
-        dassert(count == 1, "count = %d", count);
-        auto rpc = multi_remove_rpc::auto_reply(requests[0]);
-        return _write_svc->multi_remove(_decree, rpc.request(), rpc.response());
-    }
-    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_INCR) {
-        dassert(count == 1, "count = %d", count);
-        auto rpc = incr_rpc::auto_reply(requests[0]);
-        return _write_svc->incr(_decree, rpc.request(), rpc.response());
-    }
     if (rpc_code == dsn::apps::RPC_RRDB_RRDB_DUPLICATE) {
         dassert(count == 1, "count = %d", count);
         auto rpc = duplicate_rpc::auto_reply(requests[0]);
@@ -66,6 +51,16 @@ int pegasus_server_write::on_batched_write_requests(dsn::message_ex **requests,
         auto rpc = check_and_mutate_rpc::auto_reply(requests[0]);
         return _write_svc->check_and_mutate(_decree, rpc.request(), rpc.response());
     }
+    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MAINTAIN_SORTKEY_COUNT) {
+        dassert(count == 1, "count = %d", count);
+        auto rpc = maintain_sortkey_count_rpc::auto_reply(requests[0]);
+        return _write_svc->maintain_sortkey_count(_decree, rpc.request(), rpc.response());
+    }
+    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_BULK_INGEST) {
+        dassert(count == 1, "count = %d", count);
+        auto rpc = bulk_ingest_rpc::auto_reply(requests[0]);
+        return _write_svc->bulk_ingest(_decree, rpc.request(), rpc.response());
+    }
 
     return on_batched_writes(requests, count);
 }
@@ -95,11 +90,29 @@ int pegasus_server_write::on_batched_writes(dsn::message_ex **requests, int coun
                 auto rpc = remove_rpc::auto_reply(requests[i]);
                 local_err = on_single_remove_in_batch(rpc);
                 _remove_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_PUT) {
+                auto rpc = multi_put_rpc::auto_reply(requests[i]);
+                local_err = _write_svc->batch_multi_put(_write_ctx, rpc.request(), rpc.response());
+                _multi_put_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE) {
+                auto rpc = multi_remove_rpc::auto_reply(requests[i]);
+                local_err = _write_svc->batch_multi_remove(_decree, rpc.request(), rpc.response());
+                _multi_remove_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_INCR) {
+                auto rpc = incr_rpc::auto_reply(requests[i]);
+                local_err = _write_svc->batch_incr(_write_ctx, rpc.request(), rpc.response());
+                _incr_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_INCR) {
+                auto rpc = multi_incr_rpc::auto_reply(requests[i]);
+                local_err =
+                    _write_svc->batch_multi_incr(_write_ctx, rpc.request(), rpc.response());
+                _multi_incr_rpc_batch.emplace_back(std::move(rpc));
             } else {
-                if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_PUT ||
-                    rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE ||
-                    rpc_code == dsn::apps::RPC_RRDB_RRDB_INCR ||
-                    rpc_code == dsn::apps::RPC_RRDB_RRDB_DUPLICATE) {
+                if (rpc_code == dsn::apps::RPC_RRDB_RRDB_CHECK_AND_SET ||
+                    rpc_code == dsn::apps::RPC_RRDB_RRDB_CHECK_AND_MUTATE ||
+                    rpc_code == dsn::apps::RPC_RRDB_RRDB_DUPLICATE ||
+                    rpc_code == dsn::apps::RPC_RRDB_RRDB_MAINTAIN_SORTKEY_COUNT ||
+                    rpc_code == dsn::apps::RPC_RRDB_RRDB_BULK_INGEST) {
                     dfatal("rpc code not allow batch: %s", rpc_code.to_string());
                 } else {
                     dfatal("rpc code not handled: %s", rpc_code.to_string());
@@ -121,6 +134,10 @@ int pegasus_server_write::on_batched_writes(dsn::message_ex **requests, int coun
     // reply the batched RPCs
     _put_rpc_batch.clear();
     _remove_rpc_batch.clear();
+    _multi_put_rpc_batch.clear();
+    _multi_remove_rpc_batch.clear();
+    _incr_rpc_batch.clear();
+    _multi_incr_rpc_batch.clear();
     return err;
 }
 
@@ -63,6 +63,10 @@ private:
     std::unique_ptr<pegasus_write_service> _write_svc;
     std::vector<put_rpc> _put_rpc_batch;
     std::vector<remove_rpc> _remove_rpc_batch;
+    std::vector<multi_put_rpc> _multi_put_rpc_batch;
+    std::vector<multi_remove_rpc> _multi_remove_rpc_batch;
+    std::vector<incr_rpc> _incr_rpc_batch;
+    std::vector<multi_incr_rpc> _multi_incr_rpc_batch;
 
     db_write_context _write_ctx;
     int64_t _decree;
@@ -9,6 +9,7 @@
 #include <pegasus/version.h>
 #include <pegasus/git_commit.h>
 #include "reporter/pegasus_counter_reporter.h"
+#include "pegasus_server_impl.h"
 
 namespace pegasus {
 namespace server {
@@ -24,6 +25,8 @@ public:
 
     virtual ::dsn::error_code start(const std::vector<std::string> &args) override
     {
+        pegasus_server_impl::init_batch_write_codes();
+
         // args for replication http service
         std::vector<std::string> args_new(args);
         args_new.emplace_back(PEGASUS_VERSION);
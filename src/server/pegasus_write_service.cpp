@@ -44,6 +44,12 @@ pegasus_write_service::pegasus_write_service(pegasus_server_impl *server)
     _pfc_incr_qps.init_app_counter(
         "app.pegasus", name.c_str(), COUNTER_TYPE_RATE, "statistic the qps of INCR request");
 
+    name = fmt::format("multi_incr_qps@{}", str_gpid);
+    _pfc_multi_incr_qps.init_app_counter("app.pegasus",
+                                         name.c_str(),
+                                         COUNTER_TYPE_RATE,
+                                         "statistic the qps of MULTI_INCR request");
+
     name = fmt::format("check_and_set_qps@{}", str_gpid);
     _pfc_check_and_set_qps.init_app_counter("app.pegasus",
                                             name.c_str(),
@@ -86,6 +92,12 @@ pegasus_write_service::pegasus_write_service(pegasus_server_impl *server)
                                        COUNTER_TYPE_NUMBER_PERCENTILES,
                                        "statistic the latency of INCR request");
 
+    name = fmt::format("multi_incr_latency@{}", str_gpid);
+    _pfc_multi_incr_latency.init_app_counter("app.pegasus",
+                                             name.c_str(),
+                                             COUNTER_TYPE_NUMBER_PERCENTILES,
+                                             "statistic the latency of MULTI_INCR request");
+
     name = fmt::format("check_and_set_latency@{}", str_gpid);
     _pfc_check_and_set_latency.init_app_counter("app.pegasus",
                                                 name.c_str(),
@@ -141,13 +153,13 @@ int pegasus_write_service::multi_remove(int64_t decree,
     return err;
 }
 
-int pegasus_write_service::incr(int64_t decree,
+int pegasus_write_service::incr(const db_write_context &ctx,
                                 const dsn::apps::incr_request &update,
                                 dsn::apps::incr_response &resp)
 {
     uint64_t start_time = dsn_now_ns();
     _pfc_incr_qps->increment();
-    int err = _impl->incr(decree, update, resp);
+    int err = _impl->incr(ctx, update, resp);
 
     if (_server->is_primary()) {
         _cu_calculator->add_incr_cu(resp.error);
@@ -157,6 +169,22 @@ int pegasus_write_service::incr(int64_t decree,
     return err;
 }
 
+int pegasus_write_service::multi_incr(const db_write_context &ctx,
+                                      const dsn::apps::multi_incr_request &update,
+                                      dsn::apps::multi_incr_response &resp)
+{
+    uint64_t start_time = dsn_now_ns();
+    _pfc_multi_incr_qps->increment();
+    int err = _impl->multi_incr(ctx, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_multi_incr_cu(resp.error, update.items);
+    }
+
+    _pfc_multi_incr_latency->set(dsn_now_ns() - start_time);
+    return err;
+}
+
 int pegasus_write_service::check_and_set(int64_t decree,
                                          const dsn::apps::check_and_set_request &update,
                                          dsn::apps::check_and_set_response &resp)
@@ -231,6 +259,74 @@ int pegasus_write_service::batch_remove(int64_t decree,
     return err;
 }
 
+int pegasus_write_service::batch_multi_put(const db_write_context &ctx,
+                                           const dsn::apps::multi_put_request &update,
+                                           dsn::apps::update_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_multi_put must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_multi_put_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_multi_put_latency.get());
+    int err = _impl->batch_multi_put(ctx, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_multi_put_cu(resp.error, update.kvs);
+    }
+
+    return err;
+}
+
+int pegasus_write_service::batch_multi_remove(int64_t decree,
+                                              const dsn::apps::multi_remove_request &update,
+                                              dsn::apps::multi_remove_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_multi_remove must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_multi_remove_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_multi_remove_latency.get());
+    int err = _impl->batch_multi_remove(decree, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_multi_remove_cu(resp.error, update.sort_keys);
+    }
+
+    return err;
+}
+
+int pegasus_write_service::batch_incr(const db_write_context &ctx,
+                                      const dsn::apps::incr_request &update,
+                                      dsn::apps::incr_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_incr must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_incr_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_incr_latency.get());
+    int err = _impl->batch_incr(ctx, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_incr_cu(resp.error);
+    }
+
+    return err;
+}
+
+int pegasus_write_service::batch_multi_incr(const db_write_context &ctx,
+                                            const dsn::apps::multi_incr_request &update,
+                                            dsn::apps::multi_incr_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_multi_incr must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_multi_incr_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_multi_incr_latency.get());
+    int err = _impl->batch_multi_incr(ctx, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_multi_incr_cu(resp.error, update.items);
+    }
+
+    return err;
+}
+
 int pegasus_write_service::batch_commit(int64_t decree)
 {
     dassert(_batch_start_time != 0, "batch_commit must be called after batch_prepare");
@@ -251,6 +347,22 @@ void pegasus_write_service::batch_abort(int64_t decree, int err)
 
 void pegasus_write_service::set_default_ttl(uint32_t ttl) { _impl->set_default_ttl(ttl); }
 
+int pegasus_write_service::maintain_sortkey_count(
+    int64_t decree,
+    const dsn::apps::maintain_sortkey_count_request &update,
+    dsn::apps::update_response &resp)
+{
+    return _impl->maintain_sortkey_count(decree, update, resp);
+}
+
+int pegasus_write_service::bulk_ingest(int64_t decree,
+                                       const dsn::apps::bulk_ingest_request &update,
+                                       dsn::apps::update_response &resp)
+{
+    rocksdb::Status status = _server->ingest_sst_files(update.dir);
+    return _impl->bulk_ingest(decree, update, status, resp);
+}
+
 void pegasus_write_service::clear_up_batch_states()
 {
     uint64_t latency = dsn_now_ns() - _batch_start_time;
@@ -281,46 +393,72 @@ int pegasus_write_service::duplicate(int64_t decree,
     }
 
     _pfc_duplicate_qps->increment();
-    dsn::message_ex *write = dsn::from_blob_to_received_msg(request.task_code, request.raw_message);
-    bool is_delete = request.task_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE ||
-                     request.task_code == dsn::apps::RPC_RRDB_RRDB_REMOVE;
-    auto remote_timetag = generate_timetag(request.timestamp, request.cluster_id, is_delete);
-    auto ctx = db_write_context::create_duplicate(decree, remote_timetag, request.verify_timetag);
-
-    if (request.task_code == dsn::apps::RPC_RRDB_RRDB_MULTI_PUT) {
-        multi_put_rpc rpc(write);
-        resp.__set_error(_impl->multi_put(ctx, rpc.request(), rpc.response()));
-        return resp.error;
-    }
-    if (request.task_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE) {
-        multi_remove_rpc rpc(write);
-        resp.__set_error(_impl->multi_remove(ctx.decree, rpc.request(), rpc.response()));
-        return resp.error;
+
+    // A request without `entries` carries a single write in field 1-3.
+    std::vector<dsn::apps::duplicate_entry> single_entry;
+    const std::vector<dsn::apps::duplicate_entry> *entries = &request.entries;
+    if (!request.__isset.entries) {
+        single_entry.resize(1);
+        single_entry[0].__set_timestamp(request.timestamp);
+        single_entry[0].__set_task_code(request.task_code);
+        single_entry[0].__set_raw_message(request.raw_message);
+        entries = &single_entry;
     }
-    put_rpc put;
-    remove_rpc remove;
-    if (request.task_code == dsn::apps::RPC_RRDB_RRDB_PUT ||
-        request.task_code == dsn::apps::RPC_RRDB_RRDB_REMOVE) {
-        int err = 0;
-        if (request.task_code == dsn::apps::RPC_RRDB_RRDB_PUT) {
-            put = put_rpc(write);
-            err = _impl->batch_put(ctx, put.request(), put.response());
-        }
-        if (request.task_code == dsn::apps::RPC_RRDB_RRDB_REMOVE) {
-            remove = remove_rpc(write);
-            err = _impl->batch_remove(ctx.decree, remove.request(), remove.response());
+
+    for (const auto &entry : *entries) {
+        if (entry.task_code != dsn::apps::RPC_RRDB_RRDB_PUT &&
+            entry.task_code != dsn::apps::RPC_RRDB_RRDB_REMOVE &&
+            entry.task_code != dsn::apps::RPC_RRDB_RRDB_MULTI_PUT &&
+            entry.task_code != dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE) {
+            resp.__set_error(rocksdb::Status::kInvalidArgument);
+            resp.__set_error_hint(fmt::format("unrecognized task code {}", entry.task_code));
+            return empty_put(decree);
         }
-        if (!err) {
-            err = _impl->batch_commit(ctx.decree);
+    }
+
+    // All the writes are applied in order in one write batch. The rpcs hold the responses
+    // referred by the batch, so they are kept until the batch is committed.
+    std::vector<put_rpc> puts;
+    std::vector<remove_rpc> removes;
+    std::vector<multi_put_rpc> multi_puts;
+    std::vector<multi_remove_rpc> multi_removes;
+    int err = 0;
+    for (const auto &entry : *entries) {
+        dsn::message_ex *write = dsn::from_blob_to_received_msg(entry.task_code, entry.raw_message);
+        bool is_delete = entry.task_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE ||
+                         entry.task_code == dsn::apps::RPC_RRDB_RRDB_REMOVE;
+        auto remote_timetag = generate_timetag(entry.timestamp, request.cluster_id, is_delete);
+        auto ctx =
+            db_write_context::create_duplicate(decree, remote_timetag, request.verify_timetag);
+
+        if (entry.task_code == dsn::apps::RPC_RRDB_RRDB_PUT) {
+            puts.emplace_back(write);
+            err = _impl->batch_put(ctx, puts.back().request(), puts.back().response());
+        } else if (entry.task_code == dsn::apps::RPC_RRDB_RRDB_REMOVE) {
+            removes.emplace_back(write);
+            err = _impl->batch_remove(
+                ctx.decree, removes.back().request(), removes.back().response());
+        } else if (entry.task_code == dsn::apps::RPC_RRDB_RRDB_MULTI_PUT) {
+            multi_puts.emplace_back(write);
+            err = _impl->batch_multi_put(
+                ctx, multi_puts.back().request(), multi_puts.back().response());
         } else {
-            _impl->batch_abort(ctx.decree, err);
+            multi_removes.emplace_back(write);
+            err = _impl->batch_multi_remove(
+                ctx.decree, multi_removes.back().request(), multi_removes.back().response());
+        }
+        if (err) {
+            break;
         }
-        resp.__set_error(err);
-        return resp.error;
     }
-    resp.__set_error(rocksdb::Status::kInvalidArgument);
-    resp.__set_error_hint(fmt::format("unrecognized task code {}", request.task_code));
-    return empty_put(ctx.decree);
+
+    if (!err) {
+        err = _impl->batch_commit(decree);
+    } else {
+        _impl->batch_abort(decree, err);
+    }
+    resp.__set_error(err);
+    return resp.error;
 }
 
 } // namespace server
@@ -108,7 +108,14 @@ public:
                      dsn::apps::multi_remove_response &resp);
 
     // Write INCR record.
-    int incr(int64_t decree, const dsn::apps::incr_request &update, dsn::apps::incr_response &resp);
+    int incr(const db_write_context &ctx,
+             const dsn::apps::incr_request &update,
+             dsn::apps::incr_response &resp);
+
+    // Write MULTI_INCR record.
+    int multi_incr(const db_write_context &ctx,
+                   const dsn::apps::multi_incr_request &update,
+                   dsn::apps::multi_incr_response &resp);
 
     // Write CHECK_AND_SET record.
     int check_and_set(int64_t decree,
@@ -120,11 +127,25 @@ public:
                          const dsn::apps::check_and_mutate_request &update,
                          dsn::apps::check_and_mutate_response &resp);
 
-    // Handles DUPLICATE duplicated from remote.
+    // Handles DUPLICATE duplicated from remote. The writes carried by one request are applied
+    // in one write batch.
     int duplicate(int64_t decree,
                   const dsn::apps::duplicate_request &update,
                   dsn::apps::duplicate_response &resp);
 
+    // Handles MAINTAIN_SORTKEY_COUNT sent by the primary to itself, which switches whether
+    // the sortkey_count metadata is maintained by the write path since this decree.
+    int maintain_sortkey_count(int64_t decree,
+                               const dsn::apps::maintain_sortkey_count_request &update,
+                               dsn::apps::update_response &resp);
+
+    // Handles BULK_INGEST sent by the primary to itself, which ingests the sst files at this
+    // decree. A replica fails to apply it if the files can not be ingested, rather than
+    // diverges from the others, see pegasus_server_impl::ingest_sst_files().
+    int bulk_ingest(int64_t decree,
+                    const dsn::apps::bulk_ingest_request &update,
+                    dsn::apps::update_response &resp);
+
     /// For batch write.
 
     // Prepare batch write.
@@ -142,6 +163,34 @@ public:
     // NOTE that `resp` should not be moved or freed while the batch is not committed.
     int batch_remove(int64_t decree, const dsn::blob &key, dsn::apps::update_response &resp);
 
+    // Add MULTI_PUT record in batch write.
+    // \returns 0 if success, non-0 if failure.
+    // NOTE that `resp` should not be moved or freed while the batch is not committed.
+    int batch_multi_put(const db_write_context &ctx,
+                        const dsn::apps::multi_put_request &update,
+                        dsn::apps::update_response &resp);
+
+    // Add MULTI_REMOVE record in batch write.
+    // \returns 0 if success, non-0 if failure.
+    // NOTE that `resp` should not be moved or freed while the batch is not committed.
+    int batch_multi_remove(int64_t decree,
+                           const dsn::apps::multi_remove_request &update,
+                           dsn::apps::multi_remove_response &resp);
+
+    // Add INCR record in batch write, the preceding writes in the same batch are visible to it.
+    // \returns 0 if success, non-0 if failure.
+    // NOTE that `resp` should not be moved or freed while the batch is not committed.
+    int batch_incr(const db_write_context &ctx,
+                   const dsn::apps::incr_request &update,
+                   dsn::apps::incr_response &resp);
+
+    // Add MULTI_INCR record in batch write, the same as batch_incr but for many sort keys.
+    // \returns 0 if success, non-0 if failure.
+    // NOTE that `resp` should not be moved or freed while the batch is not committed.
+    int batch_multi_incr(const db_write_context &ctx,
+                         const dsn::apps::multi_incr_request &update,
+                         dsn::apps::multi_incr_response &resp);
+
     // Commit batch write.
     // \returns 0 if success, non-0 if failure.
     // NOTE that if the batch contains no updates, 0 is returned.
@@ -174,6 +223,7 @@ private:
     ::dsn::perf_counter_wrapper _pfc_remove_qps;
     ::dsn::perf_counter_wrapper _pfc_multi_remove_qps;
     ::dsn::perf_counter_wrapper _pfc_incr_qps;
+    ::dsn::perf_counter_wrapper _pfc_multi_incr_qps;
     ::dsn::perf_counter_wrapper _pfc_check_and_set_qps;
     ::dsn::perf_counter_wrapper _pfc_check_and_mutate_qps;
     ::dsn::perf_counter_wrapper _pfc_duplicate_qps;
@@ -183,6 +233,7 @@ private:
     ::dsn::perf_counter_wrapper _pfc_remove_latency;
     ::dsn::perf_counter_wrapper _pfc_multi_remove_latency;
     ::dsn::perf_counter_wrapper _pfc_incr_latency;
+    ::dsn::perf_counter_wrapper _pfc_multi_incr_latency;
     ::dsn::perf_counter_wrapper _pfc_check_and_set_latency;
     ::dsn::perf_counter_wrapper _pfc_check_and_mutate_latency;
 
@@ -7,9 +7,13 @@
 #include "pegasus_write_service.h"
 #include "pegasus_server_impl.h"
 #include "logging_utils.h"
+#include "pegasus_merge_operator.h"
+#include "sortkey_count_meta.h"
 
 #include "base/pegasus_key_schema.h"
 
+#include <dsn/dist/replication/replication.codes.h>
+#include <dsn/tool-api/async_calls.h>
 #include <dsn/utility/fail_point.h>
 #include <dsn/utility/string_conv.h>
 #include <gtest/gtest_prod.h>
@@ -17,12 +21,34 @@
 namespace pegasus {
 namespace server {
 
+DEFINE_TASK_CODE(LPC_PEGASUS_SORTKEY_COUNT_RECOUNT, TASK_PRIORITY_LOW, THREAD_POOL_COMPACT)
+
 /// internal error codes used for fail injection
 static constexpr int FAIL_DB_WRITE_BATCH_PUT = -101;
 static constexpr int FAIL_DB_WRITE_BATCH_DELETE = -102;
 static constexpr int FAIL_DB_WRITE = -103;
 static constexpr int FAIL_DB_GET = -104;
 
+// The recount of the sortkey_count metadata of a hash key in background. The records are
+// counted at a snapshot, and the writes of the hash key applied after the snapshot are added
+// to `pending` by the write path, see pegasus_write_service::impl::track_sortkey_count().
+struct sortkey_count_recount
+{
+    explicit sortkey_count_recount(std::string key) : hash_key(std::move(key)) {}
+
+    const std::string hash_key;
+
+    // protects the following fields, which are shared by the recount and the write path
+    ::dsn::utils::ex_lock_nr lock;
+    // whether the snapshot is taken, and its sequence number
+    bool started{false};
+    rocksdb::SequenceNumber snapshot_seq{0};
+    sortkey_count_meta counted;
+    sortkey_count_meta pending;
+    bool done{false};
+    bool ok{false};
+};
+
 struct db_get_context
 {
     // value read from DB.
@@ -38,6 +64,64 @@ struct db_get_context
     bool expired{false};
 };
 
+// The writes of a key in a rocksdb::WriteBatch: the last put or delete, and the merge operands
+// after it.
+struct batch_key_writes
+{
+    bool found{false};
+    bool deleted{false};
+    std::string value;
+    std::vector<std::string> merge_operands;
+
+    void put(const rocksdb::Slice &new_value)
+    {
+        found = true;
+        deleted = false;
+        value.assign(new_value.data(), new_value.size());
+        merge_operands.clear();
+    }
+
+    void del()
+    {
+        found = true;
+        deleted = true;
+        value.clear();
+        merge_operands.clear();
+    }
+
+    void merge(const rocksdb::Slice &operand)
+    {
+        merge_operands.emplace_back(operand.data(), operand.size());
+    }
+};
+
+// Indexes the writes of a rocksdb::WriteBatch by key.
+class batch_write_indexer : public rocksdb::WriteBatch::Handler
+{
+public:
+    explicit batch_write_indexer(std::unordered_map<std::string, batch_key_writes> &index)
+        : _index(index)
+    {
+    }
+
+    void Put(const rocksdb::Slice &key, const rocksdb::Slice &value) override
+    {
+        _index[key.ToString()].put(value);
+    }
+
+    void Delete(const rocksdb::Slice &key) override { _index[key.ToString()].del(); }
+
+    void SingleDelete(const rocksdb::Slice &key) override { Delete(key); }
+
+    void Merge(const rocksdb::Slice &key, const rocksdb::Slice &value) override
+    {
+        _index[key.ToString()].merge(value);
+    }
+
+private:
+    std::unordered_map<std::string, batch_key_writes> &_index;
+};
+
 inline int get_cluster_id_if_exists()
 {
     // cluster_id is 0 if not configured, which means it will accept writes
@@ -58,10 +142,23 @@ public:
           _db(server->_db),
           _rd_opts(server->_data_cf_rd_opts),
           _default_ttl(0),
-          _pfc_recent_expire_count(server->_pfc_recent_expire_count)
+          _enable_blind_incr(server->_enable_blind_incr),
+          _sortkey_count_maintained(server->_sortkey_count_maintained),
+          _sortkey_count_generation(server->_sortkey_count_generation),
+          _key_ttl_compaction_filter_factory(server->_key_ttl_compaction_filter_factory),
+          _tracker(server->_tracker),
+          _pfc_recent_expire_count(server->_pfc_recent_expire_count),
+          _pfc_recent_sortkey_count_read_count(server->_pfc_recent_sortkey_count_read_count)
     {
         // disable write ahead logging as replication handles logging instead now
         _wt_opts.disableWAL = true;
+
+        std::string state;
+        rocksdb::Status s = _db->Get(_rd_opts, sortkey_count_state::key(), &state);
+        if (s.ok() && !_sortkey_count_state.decode(state)) {
+            derror_replica("the sortkey_count state is corrupted, regard it as not maintained");
+        }
+        publish_sortkey_count_state();
     }
 
     int empty_put(int64_t decree)
@@ -78,170 +175,131 @@ public:
         return err;
     }
 
-    int multi_put(const db_write_context &ctx,
-                  const dsn::apps::multi_put_request &update,
-                  dsn::apps::update_response &resp)
+    // Switches whether the sortkey_count metadata is maintained by the write path. The
+    // generation is increased by each switch, so that all the metadata written before are
+    // invalid and dropped by compaction, rather than removed by this write.
+    int maintain_sortkey_count(int64_t decree,
+                               const dsn::apps::maintain_sortkey_count_request &update,
+                               dsn::apps::update_response &resp)
     {
-        int64_t decree = ctx.decree;
-        resp.app_id = get_gpid().get_app_id();
-        resp.partition_index = get_gpid().get_partition_index();
-        resp.decree = decree;
-        resp.server = _primary_address;
+        _update_responses.emplace_back(&resp);
+        if (update.maintained == _sortkey_count_state.maintained) {
+            // resent before the former one is applied
+            return batch_commit(decree);
+        }
 
-        if (update.kvs.empty()) {
-            derror_replica("invalid argument for multi_put: decree = {}, error = {}",
+        sortkey_count_state state;
+        state.generation = _sortkey_count_state.generation + 1;
+        state.maintained = update.maintained;
+        std::string encoded;
+        state.encode(encoded);
+        std::string state_key = sortkey_count_state::key();
+        rocksdb::Slice skey(state_key);
+        rocksdb::SliceParts skey_parts(&skey, 1);
+        rocksdb::Status s = _batch.Put(
+            skey_parts, _value_generator.generate_value(_pegasus_data_version, encoded, 0, 0));
+        if (dsn_unlikely(!s.ok())) {
+            derror_rocksdb("WriteBatchPut",
+                           s.ToString(),
+                           "decree: {}, sortkey_count state of generation: {}",
                            decree,
-                           "request.kvs is empty");
-            resp.error = rocksdb::Status::kInvalidArgument;
-            // we should write empty record to update rocksdb's last flushed decree
-            return empty_put(decree);
+                           state.generation);
+            batch_abort(decree, s.code());
+            return s.code();
         }
 
-        for (auto &kv : update.kvs) {
-            resp.error = db_write_batch_put_ctx(ctx,
-                                                composite_raw_key(update.hash_key, kv.key),
-                                                kv.value,
-                                                static_cast<uint32_t>(update.expire_ts_seconds));
-            if (resp.error) {
-                clear_up_batch_states(decree, resp.error);
-                return resp.error;
-            }
+        // the recounts of the former generation are not written any more
+        _sortkey_count_recounts.clear();
+        int err = db_write(decree);
+        if (err == 0) {
+            ddebug_replica("the sortkey_count metadata is {}maintained since decree {}, "
+                           "generation = {}",
+                           state.maintained ? "" : "not ",
+                           decree,
+                           state.generation);
+            _sortkey_count_state = state;
+            publish_sortkey_count_state();
         }
-
-        resp.error = db_write(decree);
-
-        clear_up_batch_states(decree, resp.error);
-        return resp.error;
+        clear_up_batch_states(decree, err);
+        return err;
     }
 
-    int multi_remove(int64_t decree,
-                     const dsn::apps::multi_remove_request &update,
-                     dsn::apps::multi_remove_response &resp)
+    // Writes down the empty record of BULK_INGEST, of which the sst files have been ingested
+    // or refused with `status`. Other errors fail this replica, since the files may have been
+    // partially ingested.
+    int bulk_ingest(int64_t decree,
+                    const dsn::apps::bulk_ingest_request &update,
+                    const rocksdb::Status &status,
+                    dsn::apps::update_response &resp)
     {
-        resp.app_id = get_gpid().get_app_id();
-        resp.partition_index = get_gpid().get_partition_index();
-        resp.decree = decree;
-        resp.server = _primary_address;
-
-        if (update.sort_keys.empty()) {
-            derror_replica("invalid argument for multi_remove: decree = {}, error = {}",
+        if (!status.ok() && !status.IsInvalidArgument() && !status.IsNotSupported()) {
+            derror_replica("ingest sst files in {} failed at decree {}, status = {}",
+                           update.dir,
                            decree,
-                           "request.sort_keys is empty");
-            resp.error = rocksdb::Status::kInvalidArgument;
-            // we should write empty record to update rocksdb's last flushed decree
-            return empty_put(decree);
+                           status.ToString());
+            return status.code();
         }
-
-        for (auto &sort_key : update.sort_keys) {
-            resp.error =
-                db_write_batch_delete(decree, composite_raw_key(update.hash_key, sort_key));
-            if (resp.error) {
-                clear_up_batch_states(decree, resp.error);
-                return resp.error;
-            }
+        if (!status.ok()) {
+            dwarn_replica("ingestion of sst files in {} is refused at decree {}, status = {}",
+                          update.dir,
+                          decree,
+                          status.ToString());
         }
 
-        resp.error = db_write(decree);
-        if (resp.error == 0) {
-            resp.count = update.sort_keys.size();
+        _update_responses.emplace_back(&resp);
+        int err = empty_put(decree);
+        if (err == 0) {
+            resp.error = status.code();
         }
-
-        clear_up_batch_states(decree, resp.error);
-        return resp.error;
+        return err;
     }
 
-    int incr(int64_t decree, const dsn::apps::incr_request &update, dsn::apps::incr_response &resp)
+    int multi_put(const db_write_context &ctx,
+                  const dsn::apps::multi_put_request &update,
+                  dsn::apps::update_response &resp)
     {
-        resp.app_id = get_gpid().get_app_id();
-        resp.partition_index = get_gpid().get_partition_index();
-        resp.decree = decree;
-        resp.server = _primary_address;
-
-        rocksdb::Slice raw_key(update.key.data(), update.key.length());
-        std::string raw_value;
-        int64_t new_value = 0;
-        uint32_t new_expire_ts = 0;
-        rocksdb::Status s = _db->Get(_rd_opts, raw_key, &raw_value);
-        if (s.ok()) {
-            uint32_t old_expire_ts = pegasus_extract_expire_ts(_pegasus_data_version, raw_value);
-            if (check_if_ts_expired(utils::epoch_now(), old_expire_ts)) {
-                // ttl timeout, set to 0 before increment
-                _pfc_recent_expire_count->increment();
-                new_value = update.increment;
-                new_expire_ts = update.expire_ts_seconds > 0 ? update.expire_ts_seconds : 0;
-            } else {
-                ::dsn::blob old_value;
-                pegasus_extract_user_data(_pegasus_data_version, std::move(raw_value), old_value);
-                if (old_value.length() == 0) {
-                    // empty old value, set to 0 before increment
-                    new_value = update.increment;
-                } else {
-                    int64_t old_value_int;
-                    if (!dsn::buf2int64(old_value, old_value_int)) {
-                        // invalid old value
-                        derror_replica("incr failed: decree = {}, error = "
-                                       "old value \"{}\" is not an integer or out of range",
-                                       decree,
-                                       utils::c_escape_string(old_value));
-                        resp.error = rocksdb::Status::kInvalidArgument;
-                        // we should write empty record to update rocksdb's last flushed decree
-                        return empty_put(decree);
-                    }
-                    new_value = old_value_int + update.increment;
-                    if ((update.increment > 0 && new_value < old_value_int) ||
-                        (update.increment < 0 && new_value > old_value_int)) {
-                        // new value is out of range, return old value by 'new_value'
-                        derror_replica("incr failed: decree = {}, error = "
-                                       "new value is out of range, old_value = {}, increment = {}",
-                                       decree,
-                                       old_value_int,
-                                       update.increment);
-                        resp.error = rocksdb::Status::kInvalidArgument;
-                        resp.new_value = old_value_int;
-                        // we should write empty record to update rocksdb's last flushed decree
-                        return empty_put(decree);
-                    }
-                }
-                // set new ttl
-                if (update.expire_ts_seconds == 0)
-                    new_expire_ts = old_expire_ts;
-                else if (update.expire_ts_seconds < 0)
-                    new_expire_ts = 0;
-                else // update.expire_ts_seconds > 0
-                    new_expire_ts = update.expire_ts_seconds;
-            }
-        } else if (s.IsNotFound()) {
-            // old value is not found, set to 0 before increment
-            new_value = update.increment;
-            new_expire_ts = update.expire_ts_seconds > 0 ? update.expire_ts_seconds : 0;
-        } else {
-            // read old value failed
-            ::dsn::blob hash_key, sort_key;
-            pegasus_restore_key(::dsn::blob(raw_key.data(), 0, raw_key.size()), hash_key, sort_key);
-            derror_rocksdb("Get for Incr",
-                           s.ToString(),
-                           "decree: {}, hash_key: {}, sort_key: {}",
-                           decree,
-                           utils::c_escape_string(hash_key),
-                           utils::c_escape_string(sort_key));
-            resp.error = s.code();
-            return resp.error;
+        int err = batch_multi_put(ctx, update, resp);
+        if (err) {
+            batch_abort(ctx.decree, err);
+            return err;
         }
+        return batch_commit(ctx.decree);
+    }
 
-        resp.error =
-            db_write_batch_put(decree, update.key, std::to_string(new_value), new_expire_ts);
-        if (resp.error) {
-            clear_up_batch_states(decree, resp.error);
-            return resp.error;
+    int multi_remove(int64_t decree,
+                     const dsn::apps::multi_remove_request &update,
+                     dsn::apps::multi_remove_response &resp)
+    {
+        int err = batch_multi_remove(decree, update, resp);
+        if (err) {
+            batch_abort(decree, err);
+            return err;
         }
+        return batch_commit(decree);
+    }
 
-        resp.error = db_write(decree);
-        if (resp.error == 0) {
-            resp.new_value = new_value;
+    int incr(const db_write_context &ctx,
+             const dsn::apps::incr_request &update,
+             dsn::apps::incr_response &resp)
+    {
+        int err = batch_incr(ctx, update, resp);
+        if (err) {
+            batch_abort(ctx.decree, err);
+            return err;
         }
+        return batch_commit(ctx.decree);
+    }
 
-        clear_up_batch_states(decree, resp.error);
-        return resp.error;
+    int multi_incr(const db_write_context &ctx,
+                   const dsn::apps::multi_incr_request &update,
+                   dsn::apps::multi_incr_response &resp)
+    {
+        int err = batch_multi_incr(ctx, update, resp);
+        if (err) {
+            batch_abort(ctx.decree, err);
+            return err;
+        }
+        return batch_commit(ctx.decree);
     }
 
     int check_and_set(int64_t decree,
@@ -506,9 +564,218 @@ public:
         return resp.error;
     }
 
+    // An invalid request is replied with kInvalidArgument immediately, and adds nothing to
+    // the batch, the other requests of the batch are not affected.
+    int batch_multi_put(const db_write_context &ctx,
+                        const dsn::apps::multi_put_request &update,
+                        dsn::apps::update_response &resp)
+    {
+        resp.app_id = get_gpid().get_app_id();
+        resp.partition_index = get_gpid().get_partition_index();
+        resp.decree = ctx.decree;
+        resp.server = _primary_address;
+
+        if (update.kvs.empty()) {
+            derror_replica("invalid argument for multi_put: decree = {}, error = {}",
+                           ctx.decree,
+                           "request.kvs is empty");
+            resp.error = rocksdb::Status::kInvalidArgument;
+            return 0;
+        }
+
+        _update_responses.emplace_back(&resp);
+        for (auto &kv : update.kvs) {
+            resp.error = db_write_batch_put_ctx(ctx,
+                                                composite_raw_key(update.hash_key, kv.key),
+                                                kv.value,
+                                                static_cast<uint32_t>(update.expire_ts_seconds));
+            if (resp.error) {
+                return resp.error;
+            }
+        }
+        return 0;
+    }
+
+    int batch_multi_remove(int64_t decree,
+                           const dsn::apps::multi_remove_request &update,
+                           dsn::apps::multi_remove_response &resp)
+    {
+        resp.app_id = get_gpid().get_app_id();
+        resp.partition_index = get_gpid().get_partition_index();
+        resp.decree = decree;
+        resp.server = _primary_address;
+
+        if (update.sort_keys.empty()) {
+            derror_replica("invalid argument for multi_remove: decree = {}, error = {}",
+                           decree,
+                           "request.sort_keys is empty");
+            resp.error = rocksdb::Status::kInvalidArgument;
+            return 0;
+        }
+
+        _multi_remove_responses.emplace_back(&resp, update.sort_keys.size());
+        for (auto &sort_key : update.sort_keys) {
+            resp.error =
+                db_write_batch_delete(decree, composite_raw_key(update.hash_key, sort_key));
+            if (resp.error) {
+                return resp.error;
+            }
+        }
+        return 0;
+    }
+
+    // The old value is read with the preceding writes of the same batch applied.
+    int batch_incr(const db_write_context &ctx,
+                   const dsn::apps::incr_request &update,
+                   dsn::apps::incr_response &resp)
+    {
+        resp.app_id = get_gpid().get_app_id();
+        resp.partition_index = get_gpid().get_partition_index();
+        resp.decree = ctx.decree;
+        resp.server = _primary_address;
+
+        if (is_blind_incr(update.blind)) {
+            // the new value is not returned
+            _incr_responses.emplace_back(&resp, 0);
+            resp.error = db_write_batch_merge_incr(
+                ctx, update.key, update.increment, update.expire_ts_seconds);
+            return resp.error;
+        }
+
+        bool is_integer = false;
+        int64_t value = 0;
+        uint32_t expire_ts = 0;
+        resp.error = db_get_incr_base(ctx.decree, update.key, is_integer, value, expire_ts);
+        if (resp.error) {
+            return resp.error;
+        }
+        if (!is_integer) {
+            resp.error = rocksdb::Status::kInvalidArgument;
+            return 0;
+        }
+
+        int64_t old_value = value;
+        if (!apply_incr(update.increment, update.expire_ts_seconds, value, expire_ts)) {
+            // new value is out of range, return old value by 'new_value'
+            derror_replica("incr failed: decree = {}, error = "
+                           "new value is out of range, old_value = {}, increment = {}",
+                           ctx.decree,
+                           old_value,
+                           update.increment);
+            resp.error = rocksdb::Status::kInvalidArgument;
+            resp.new_value = old_value;
+            return 0;
+        }
+
+        _incr_responses.emplace_back(&resp, value);
+        resp.error = db_write_batch_put(ctx.decree, update.key, std::to_string(value), expire_ts);
+        return resp.error;
+    }
+
+    // The items are applied in order as one atomic operation, a sort key may appear more than
+    // once. If any item is rejected like batch_incr, the whole request is replied with
+    // kInvalidArgument, and adds nothing to the batch.
+    int batch_multi_incr(const db_write_context &ctx,
+                         const dsn::apps::multi_incr_request &update,
+                         dsn::apps::multi_incr_response &resp)
+    {
+        resp.app_id = get_gpid().get_app_id();
+        resp.partition_index = get_gpid().get_partition_index();
+        resp.decree = ctx.decree;
+        resp.server = _primary_address;
+
+        if (update.items.empty()) {
+            derror_replica("invalid argument for multi_incr: decree = {}, error = {}",
+                           ctx.decree,
+                           "request.items is empty");
+            resp.error = rocksdb::Status::kInvalidArgument;
+            return 0;
+        }
+
+        std::vector<dsn::blob> raw_keys;
+        raw_keys.reserve(update.items.size());
+        for (const auto &item : update.items) {
+            raw_keys.emplace_back(composite_raw_key(update.hash_key, item.sort_key));
+        }
+
+        if (is_blind_incr(update.blind)) {
+            // the new values are not returned
+            _multi_incr_responses.emplace_back(&resp,
+                                               std::vector<int64_t>(update.items.size(), 0));
+            for (size_t i = 0; i < update.items.size(); ++i) {
+                const dsn::apps::incr_item &item = update.items[i];
+                resp.error = db_write_batch_merge_incr(
+                    ctx, raw_keys[i], item.increment, item.expire_ts_seconds);
+                if (resp.error) {
+                    return resp.error;
+                }
+            }
+            return 0;
+        }
+
+        std::vector<int64_t> new_values(update.items.size(), 0);
+        std::vector<uint32_t> new_expire_ts(update.items.size(), 0);
+        // raw key -> index of the last item on it, which holds the current value
+        std::unordered_map<std::string, size_t> last_items;
+        for (size_t i = 0; i < update.items.size(); ++i) {
+            const dsn::apps::incr_item &item = update.items[i];
+            std::string raw_key_str = raw_keys[i].to_string();
+            auto last = last_items.find(raw_key_str);
+            if (last != last_items.end()) {
+                new_values[i] = new_values[last->second];
+                new_expire_ts[i] = new_expire_ts[last->second];
+                last->second = i;
+            } else {
+                bool is_integer = false;
+                resp.error = db_get_incr_base(
+                    ctx.decree, raw_keys[i], is_integer, new_values[i], new_expire_ts[i]);
+                if (resp.error) {
+                    return resp.error;
+                }
+                if (!is_integer) {
+                    resp.error = rocksdb::Status::kInvalidArgument;
+                    return 0;
+                }
+                last_items.emplace(std::move(raw_key_str), i);
+            }
+
+            int64_t old_value = new_values[i];
+            if (!apply_incr(
+                    item.increment, item.expire_ts_seconds, new_values[i], new_expire_ts[i])) {
+                derror_replica("multi_incr failed: decree = {}, error = new value is out of range, "
+                               "sort_key = {}, old_value = {}, increment = {}",
+                               ctx.decree,
+                               utils::c_escape_string(item.sort_key),
+                               old_value,
+                               item.increment);
+                resp.error = rocksdb::Status::kInvalidArgument;
+                return 0;
+            }
+        }
+
+        // the later put of the same key overwrites the former one in the batch
+        _multi_incr_responses.emplace_back(&resp, new_values);
+        for (size_t i = 0; i < update.items.size(); ++i) {
+            resp.error = db_write_batch_put(
+                ctx.decree, raw_keys[i], std::to_string(new_values[i]), new_expire_ts[i]);
+            if (resp.error) {
+                return resp.error;
+            }
+        }
+        return 0;
+    }
+
     int batch_commit(int64_t decree)
     {
-        int err = db_write(decree);
+        int err = 0;
+        if (_batch.Count() == 0) {
+            // all requests of the batch are invalid, write empty record to update rocksdb's
+            // last flushed decree
+            err = db_write_batch_put(decree, dsn::string_view(), dsn::string_view(), 0);
+        }
+        if (err == 0) {
+            err = db_write(decree);
+        }
         clear_up_batch_states(decree, err);
         return err;
     }
@@ -567,11 +834,26 @@ private:
             }
         }
 
+        uint32_t expire_ts = db_expire_ts(expire_sec);
+        if (!raw_key.empty() && sortkey_count_maintained()) {
+            int err = track_sortkey_count(raw_key, true, expire_ts);
+            if (dsn_unlikely(err != 0)) {
+                return err;
+            }
+        }
+
         rocksdb::Slice skey = utils::to_rocksdb_slice(raw_key);
         rocksdb::SliceParts skey_parts(&skey, 1);
-        rocksdb::SliceParts svalue = _value_generator.generate_value(
-            _pegasus_data_version, value, db_expire_ts(expire_sec), new_timetag);
+        rocksdb::SliceParts svalue =
+            _value_generator.generate_value(_pegasus_data_version, value, expire_ts, new_timetag);
         rocksdb::Status s = _batch.Put(skey_parts, svalue);
+        if (s.ok() && _batch_index_built) {
+            std::string joined;
+            for (int i = 0; i < svalue.num_parts; ++i) {
+                joined.append(svalue.parts[i].data(), svalue.parts[i].size());
+            }
+            _batch_index[std::string(raw_key.data(), raw_key.size())].put(joined);
+        }
         if (dsn_unlikely(!s.ok())) {
             ::dsn::blob hash_key, sort_key;
             pegasus_restore_key(::dsn::blob(raw_key.data(), 0, raw_key.size()), hash_key, sort_key);
@@ -591,7 +873,17 @@ private:
         FAIL_POINT_INJECT_F("db_write_batch_delete",
                             [](dsn::string_view) -> int { return FAIL_DB_WRITE_BATCH_DELETE; });
 
+        if (sortkey_count_maintained()) {
+            int err = track_sortkey_count(raw_key, false, 0);
+            if (dsn_unlikely(err != 0)) {
+                return err;
+            }
+        }
+
         rocksdb::Status s = _batch.Delete(utils::to_rocksdb_slice(raw_key));
+        if (s.ok() && _batch_index_built) {
+            _batch_index[std::string(raw_key.data(), raw_key.size())].del();
+        }
         if (dsn_unlikely(!s.ok())) {
             ::dsn::blob hash_key, sort_key;
             pegasus_restore_key(::dsn::blob(raw_key.data(), 0, raw_key.size()), hash_key, sort_key);
@@ -612,10 +904,17 @@ private:
 
         FAIL_POINT_INJECT_F("db_write", [](dsn::string_view) -> int { return FAIL_DB_WRITE; });
 
+        int err = db_write_batch_put_sortkey_counts(decree);
+        if (dsn_unlikely(err != 0)) {
+            return err;
+        }
+
         _wt_opts.given_decree = static_cast<uint64_t>(decree);
         auto status = _db->Write(_wt_opts, &_batch);
         if (!status.ok()) {
             derror_rocksdb("Write", status.ToString(), "decree: {}", decree);
+        } else if (!_batch_sortkey_counts.empty()) {
+            on_sortkey_counts_written();
         }
         return status.code();
     }
@@ -651,6 +950,428 @@ private:
         return s.code();
     }
 
+    // Same as db_get(), but the preceding writes of the current batch, which are not visible in
+    // rocksdb until the batch is committed, are applied to the result.
+    int db_get_in_batch(dsn::string_view raw_key, /*out*/ db_get_context *ctx)
+    {
+        if (_batch.Count() == 0) {
+            return db_get(raw_key, ctx);
+        }
+
+        if (!_batch_index_built) {
+            batch_write_indexer indexer(_batch_index);
+            rocksdb::Status s = _batch.Iterate(&indexer);
+            if (dsn_unlikely(!s.ok())) {
+                derror_rocksdb(
+                    "WriteBatchIterate", s.ToString(), "key: {}", utils::c_escape_string(raw_key));
+                _batch_index.clear();
+                return s.code();
+            }
+            _batch_index_built = true;
+        }
+        auto iter = _batch_index.find(std::string(raw_key.data(), raw_key.size()));
+        if (iter == _batch_index.end()) {
+            return db_get(raw_key, ctx);
+        }
+
+        const batch_key_writes &writes = iter->second;
+        if (writes.found) {
+            ctx->found = !writes.deleted;
+            ctx->raw_value = writes.value;
+        } else {
+            int err = db_get(raw_key, ctx);
+            if (dsn_unlikely(err != 0)) {
+                return err;
+            }
+        }
+        if (!writes.merge_operands.empty()) {
+            // blind incr in the same batch
+            std::vector<rocksdb::Slice> operands(writes.merge_operands.begin(),
+                                                 writes.merge_operands.end());
+            rocksdb::Slice base(ctx->raw_value);
+            std::string merged;
+            if (!incr_operand::merge(ctx->found ? &base : nullptr, operands, merged)) {
+                derror_rocksdb("MergeInBatch",
+                               "corrupted incr operand",
+                               "key: {}",
+                               utils::c_escape_string(raw_key));
+                return rocksdb::Status::kCorruption;
+            }
+            ctx->found = true;
+            ctx->raw_value = std::move(merged);
+        }
+        if (ctx->found) {
+            ctx->expire_ts = pegasus_extract_expire_ts(_pegasus_data_version, ctx->raw_value);
+            ctx->expired = check_if_ts_expired(utils::epoch_now(), ctx->expire_ts);
+        }
+        return 0;
+    }
+
+    // Whether the incr requested as `blind` is applied blindly by merge. The old record is
+    // read anyway if blind incr is not enabled or the sortkey_count metadata is maintained.
+    bool is_blind_incr(bool blind)
+    {
+        return blind && _enable_blind_incr && !sortkey_count_maintained();
+    }
+
+    // Whether the sortkey_count metadata is maintained, which is switched only by
+    // maintain_sortkey_count(), so it is the same on all the replicas at the same decree.
+    bool sortkey_count_maintained() const { return _sortkey_count_state.maintained; }
+
+    void publish_sortkey_count_state()
+    {
+        _sortkey_count_maintained.store(_sortkey_count_state.maintained, std::memory_order_release);
+        _sortkey_count_generation.store(_sortkey_count_state.generation, std::memory_order_release);
+        _key_ttl_compaction_filter_factory->SetSortkeyCountGeneration(
+            _sortkey_count_state.generation);
+    }
+
+    // Reads the old value of `raw_key` for incr, with the preceding writes of the same batch
+    // applied. A record which is not found or expired is read as 0 without ttl, and an empty
+    // value is read as 0. `is_integer` is false if the old value is not an integer.
+    int db_get_incr_base(int64_t decree,
+                         dsn::string_view raw_key,
+                         /*out*/ bool &is_integer,
+                         /*out*/ int64_t &value,
+                         /*out*/ uint32_t &expire_ts)
+    {
+        is_integer = true;
+        value = 0;
+        expire_ts = 0;
+
+        db_get_context get_ctx;
+        int err = db_get_in_batch(raw_key, &get_ctx);
+        if (err) {
+            return err;
+        }
+        if (!get_ctx.found) {
+            return 0;
+        }
+        if (get_ctx.expired) {
+            _pfc_recent_expire_count->increment();
+            return 0;
+        }
+
+        expire_ts = get_ctx.expire_ts;
+        dsn::string_view old_value =
+            pegasus_extract_user_data_view(_pegasus_data_version, get_ctx.raw_value);
+        if (old_value.length() > 0 && !dsn::buf2int64(old_value, value)) {
+            derror_replica("incr failed: decree = {}, error = "
+                           "old value \"{}\" is not an integer or out of range",
+                           decree,
+                           utils::c_escape_string(old_value));
+            is_integer = false;
+        }
+        return 0;
+    }
+
+    // Applies an increment to `value` and `expire_ts`, see incr_request for the meaning of
+    // `expire_ts_seconds`. Return false and keep them unchanged if the new value is out of
+    // range.
+    static bool
+    apply_incr(int64_t increment, int32_t expire_ts_seconds, int64_t &value, uint32_t &expire_ts)
+    {
+        int64_t new_value = value + increment;
+        if ((increment > 0 && new_value < value) || (increment < 0 && new_value > value)) {
+            return false;
+        }
+        value = new_value;
+        if (expire_ts_seconds > 0) {
+            expire_ts = static_cast<uint32_t>(expire_ts_seconds);
+        } else if (expire_ts_seconds < 0) {
+            expire_ts = 0;
+        }
+        return true;
+    }
+
+    // The sortkey_count metadata of a hash key written by the current batch.
+    struct batch_sortkey_count
+    {
+        enum class status
+        {
+            // the metadata is valid, and updated by the batch
+            COUNTED,
+            // the hash key is being recounted, the delta of the batch is added to the recount
+            RECOUNTING,
+            // the hash key is recounted after the batch, so the batch reads nothing for it
+            UNCOUNTED,
+        };
+        status st{status::UNCOUNTED};
+        // the metadata before the batch if COUNTED
+        sortkey_count_meta base;
+        // the delta of the batch if not UNCOUNTED
+        sortkey_count_meta delta;
+    };
+
+    // Updates the sortkey_count metadata of the current batch for putting (`exist` is true) or
+    // removing (`exist` is false) the record of `raw_key`. The previous state of the record is
+    // read from rocksdb, or from the preceding writes in the same batch. The records of the
+    // hash key are never scanned here, but recounted in background if the metadata is not
+    // valid, see sortkey_count_meta.
+    int track_sortkey_count(dsn::string_view raw_key, bool exist, uint32_t expire_ts)
+    {
+        ::dsn::blob hash_key, sort_key;
+        pegasus_restore_key(::dsn::blob(raw_key.data(), 0, raw_key.size()), hash_key, sort_key);
+
+        std::string hash_key_str(hash_key.data(), hash_key.length());
+        auto counter = _batch_sortkey_counts.find(hash_key_str);
+        if (counter == _batch_sortkey_counts.end()) {
+            batch_sortkey_count init;
+            int err = db_get_sortkey_count(hash_key_str, init);
+            if (dsn_unlikely(err != 0)) {
+                return err;
+            }
+            counter = _batch_sortkey_counts.emplace(std::move(hash_key_str), init).first;
+        }
+        if (counter->second.st == batch_sortkey_count::status::UNCOUNTED) {
+            return 0;
+        }
+
+        std::string raw_key_str(raw_key.data(), raw_key.length());
+        bool old_exist = false;
+        auto record = _batch_record_exists.find(raw_key_str);
+        if (record != _batch_record_exists.end()) {
+            old_exist = record->second;
+        } else {
+            db_get_context get_ctx;
+            _pfc_recent_sortkey_count_read_count->increment();
+            int err = db_get(raw_key, &get_ctx);
+            if (dsn_unlikely(err != 0)) {
+                return err;
+            }
+            // expired records are not counted, see sortkey_count_meta
+            old_exist = get_ctx.found && !get_ctx.expired;
+        }
+
+        sortkey_count_meta &delta = counter->second.delta;
+        delta.count += int(exist) - int(old_exist);
+        if (exist) {
+            delta.add_expire_ts(expire_ts);
+        }
+        _batch_record_exists[std::move(raw_key_str)] = exist;
+        return 0;
+    }
+
+    // Gets the status of the sortkey_count metadata of `hash_key` before the current batch.
+    int db_get_sortkey_count(const std::string &hash_key, /*out*/ batch_sortkey_count &counter)
+    {
+        std::string meta_key;
+        sortkey_count_meta::generate_key(hash_key, meta_key);
+        std::string meta_value;
+        _pfc_recent_sortkey_count_read_count->increment();
+        rocksdb::Status s = _db->Get(_rd_opts, meta_key, &meta_value);
+        if (s.ok()) {
+            if (counter.base.decode(meta_value) &&
+                counter.base.valid(_sortkey_count_state.generation, utils::epoch_now())) {
+                counter.st = batch_sortkey_count::status::COUNTED;
+                return 0;
+            }
+        } else if (!s.IsNotFound()) {
+            derror_rocksdb("Get sortkey_count meta",
+                           s.ToString(),
+                           "hash_key: {}",
+                           utils::c_escape_string(hash_key));
+            return s.code();
+        }
+        counter.st = _sortkey_count_recounts.count(hash_key) != 0
+                         ? batch_sortkey_count::status::RECOUNTING
+                         : batch_sortkey_count::status::UNCOUNTED;
+        return 0;
+    }
+
+    // Puts the sortkey_count metadata updated by the current batch, and the metadata of the
+    // hash keys recounted since the last batch.
+    int db_write_batch_put_sortkey_counts(int64_t decree)
+    {
+        for (auto it = _sortkey_count_recounts.begin(); it != _sortkey_count_recounts.end();) {
+            sortkey_count_meta meta;
+            bool ok = false;
+            {
+                sortkey_count_recount &recount = *it->second;
+                ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr> l(recount.lock);
+                if (!recount.done) {
+                    ++it;
+                    continue;
+                }
+                meta = recount.counted;
+                meta.add(recount.pending);
+                ok = recount.ok;
+            }
+
+            auto counter = _batch_sortkey_counts.find(it->first);
+            if (counter != _batch_sortkey_counts.end()) {
+                // the recount is updated by the batch, or recounted again after the batch
+                counter->second.st = ok ? batch_sortkey_count::status::COUNTED
+                                        : batch_sortkey_count::status::UNCOUNTED;
+                counter->second.base = meta;
+            } else if (ok) {
+                int err = db_write_batch_put_sortkey_count(decree, it->first, meta);
+                if (dsn_unlikely(err != 0)) {
+                    return err;
+                }
+            }
+            it = _sortkey_count_recounts.erase(it);
+        }
+
+        for (const auto &kv : _batch_sortkey_counts) {
+            if (kv.second.st == batch_sortkey_count::status::COUNTED) {
+                sortkey_count_meta meta = kv.second.base;
+                meta.add(kv.second.delta);
+                int err = db_write_batch_put_sortkey_count(decree, kv.first, meta);
+                if (dsn_unlikely(err != 0)) {
+                    return err;
+                }
+            }
+        }
+        return 0;
+    }
+
+    int db_write_batch_put_sortkey_count(int64_t decree,
+                                         const std::string &hash_key,
+                                         sortkey_count_meta meta)
+    {
+        std::string meta_key;
+        sortkey_count_meta::generate_key(hash_key, meta_key);
+        meta.generation = _sortkey_count_state.generation;
+        std::string encoded;
+        meta.encode(encoded);
+
+        rocksdb::Slice skey(meta_key);
+        rocksdb::SliceParts skey_parts(&skey, 1);
+        rocksdb::Status s = _batch.Put(
+            skey_parts, _value_generator.generate_value(_pegasus_data_version, encoded, 0, 0));
+        if (dsn_unlikely(!s.ok())) {
+            derror_rocksdb("WriteBatchPut",
+                           s.ToString(),
+                           "decree: {}, sortkey_count meta of hash_key: {}",
+                           decree,
+                           utils::c_escape_string(hash_key));
+        }
+        return s.code();
+    }
+
+    // Adds the deltas of the committed batch to the recounts, and starts to recount the hash
+    // keys whose metadata is not valid.
+    void on_sortkey_counts_written()
+    {
+        rocksdb::SequenceNumber seq = _db->GetLatestSequenceNumber();
+        for (const auto &kv : _batch_sortkey_counts) {
+            if (kv.second.st == batch_sortkey_count::status::RECOUNTING) {
+                sortkey_count_recount &recount = *_sortkey_count_recounts[kv.first];
+                ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr> l(recount.lock);
+                // the batch is counted by the recount if it is visible to the snapshot
+                if (!recount.started || recount.snapshot_seq < seq) {
+                    recount.pending.add(kv.second.delta);
+                }
+            } else if (kv.second.st == batch_sortkey_count::status::UNCOUNTED &&
+                       _sortkey_count_recounts.size() < MAX_SORTKEY_COUNT_RECOUNTS) {
+                start_sortkey_count_recount(kv.first);
+            }
+        }
+    }
+
+    // Recounts the records of `hash_key` in background, the hash keys beyond
+    // MAX_SORTKEY_COUNT_RECOUNTS are recounted after their next writes.
+    void start_sortkey_count_recount(const std::string &hash_key)
+    {
+        auto recount = std::make_shared<sortkey_count_recount>(hash_key);
+        _sortkey_count_recounts.emplace(hash_key, recount);
+        _pfc_recent_sortkey_count_read_count->increment();
+
+        std::string name = replica_name();
+        rocksdb::DB *db = _db;
+        rocksdb::ReadOptions options = _rd_opts;
+        uint32_t data_version = _pegasus_data_version;
+        uint32_t default_ttl = _default_ttl;
+        ::dsn::tasking::enqueue(LPC_PEGASUS_SORTKEY_COUNT_RECOUNT, &_tracker, [=]() {
+            recount_sortkey_count(name, db, options, data_version, default_ttl, *recount);
+        });
+    }
+
+    // Counts the unexpired records of `recount.hash_key` at a snapshot. It runs in background,
+    // and the server cancels it before closing `db`.
+    static void recount_sortkey_count(const std::string &name,
+                                      rocksdb::DB *db,
+                                      rocksdb::ReadOptions options,
+                                      uint32_t data_version,
+                                      uint32_t default_ttl,
+                                      sortkey_count_recount &recount)
+    {
+        {
+            ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr> l(recount.lock);
+            options.snapshot = db->GetSnapshot();
+            recount.started = true;
+            recount.snapshot_seq = options.snapshot->GetSequenceNumber();
+            // the writes before the snapshot are counted
+            recount.pending = sortkey_count_meta();
+        }
+
+        ::dsn::blob start_key, stop_key;
+        pegasus_generate_key(start_key, recount.hash_key, std::string());
+        pegasus_generate_next_blob(stop_key, recount.hash_key);
+        rocksdb::Slice stop(stop_key.data(), stop_key.length());
+        options.iterate_upper_bound = &stop;
+        uint32_t epoch_now = utils::epoch_now();
+        sortkey_count_meta counted;
+        std::unique_ptr<rocksdb::Iterator> it(db->NewIterator(options));
+        for (it->Seek(utils::to_rocksdb_slice(start_key)); it->Valid(); it->Next()) {
+            uint32_t expire_ts =
+                pegasus_extract_expire_ts(data_version, utils::to_string_view(it->value()));
+            if (check_if_ts_expired(epoch_now, expire_ts)) {
+                continue;
+            }
+            counted.count++;
+            // default ttl is added by compaction to the records without ttl no earlier than now
+            counted.add_expire_ts(expire_ts == 0 && default_ttl != 0 ? epoch_now + default_ttl
+                                                                      : expire_ts);
+        }
+        bool ok = it->status().ok();
+        if (!ok) {
+            derror_f("{}: rocksdb Iterate for sortkey_count meta failed: error = {} "
+                     "[hash_key: {}]",
+                     name,
+                     it->status().ToString(),
+                     utils::c_escape_string(recount.hash_key));
+        }
+        it.reset();
+        db->ReleaseSnapshot(options.snapshot);
+
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr> l(recount.lock);
+        recount.counted = counted;
+        recount.ok = ok;
+        recount.done = true;
+    }
+
+    int db_write_batch_merge_incr(const db_write_context &ctx,
+                                  const dsn::blob &raw_key,
+                                  int64_t increment,
+                                  int32_t expire_ts_seconds)
+    {
+        incr_operand op;
+        op.data_version = _pegasus_data_version;
+        op.timetag = generate_timetag(ctx.timestamp, get_cluster_id_if_exists(), false);
+        op.increment = increment;
+        op.expire_ts_seconds = expire_ts_seconds;
+        std::string operand;
+        op.encode(operand);
+
+        rocksdb::Status s = _batch.Merge(utils::to_rocksdb_slice(raw_key), operand);
+        if (s.ok() && _batch_index_built) {
+            _batch_index[raw_key.to_string()].merge(operand);
+        }
+        if (dsn_unlikely(!s.ok())) {
+            ::dsn::blob hash_key, sort_key;
+            pegasus_restore_key(raw_key, hash_key, sort_key);
+            derror_rocksdb("WriteBatchMerge",
+                           s.ToString(),
+                           "decree: {}, incr of hash_key: {}, sort_key: {}",
+                           ctx.decree,
+                           utils::c_escape_string(hash_key),
+                           utils::c_escape_string(sort_key));
+        }
+        return s.code();
+    }
+
     void clear_up_batch_states(int64_t decree, int err)
     {
         if (!_update_responses.empty()) {
@@ -665,8 +1386,37 @@ private:
             }
             _update_responses.clear();
         }
+        for (const auto &r : _multi_remove_responses) {
+            dsn::apps::multi_remove_response *mresp = r.first;
+            mresp->error = err;
+            mresp->count = err == 0 ? r.second : 0;
+            mresp->decree = decree;
+        }
+        _multi_remove_responses.clear();
+        for (const auto &r : _incr_responses) {
+            dsn::apps::incr_response *iresp = r.first;
+            iresp->error = err;
+            iresp->new_value = err == 0 ? r.second : 0;
+            iresp->decree = decree;
+        }
+        _incr_responses.clear();
+        for (auto &r : _multi_incr_responses) {
+            dsn::apps::multi_incr_response *mresp = r.first;
+            mresp->error = err;
+            if (err == 0) {
+                mresp->new_values = std::move(r.second);
+            } else {
+                mresp->new_values.clear();
+            }
+            mresp->decree = decree;
+        }
+        _multi_incr_responses.clear();
 
         _batch.Clear();
+        _batch_index.clear();
+        _batch_index_built = false;
+        _batch_record_exists.clear();
+        _batch_sortkey_counts.clear();
     }
 
     static dsn::blob composite_raw_key(dsn::string_view hash_key, dsn::string_view sort_key)
@@ -808,11 +1558,41 @@ private:
     rocksdb::WriteOptions _wt_opts;
     rocksdb::ReadOptions &_rd_opts;
     volatile uint32_t _default_ttl;
+    const bool _enable_blind_incr;
+    std::atomic<bool> &_sortkey_count_maintained;
+    std::atomic<uint64_t> &_sortkey_count_generation;
+    std::shared_ptr<KeyWithTTLCompactionFilterFactory> _key_ttl_compaction_filter_factory;
+    dsn::task_tracker &_tracker;
     ::dsn::perf_counter_wrapper &_pfc_recent_expire_count;
+    ::dsn::perf_counter_wrapper &_pfc_recent_sortkey_count_read_count;
     pegasus_value_generator _value_generator;
 
     // for setting update_response.error after committed.
     std::vector<dsn::apps::update_response *> _update_responses;
+    // for setting the responses of MULTI_REMOVE, INCR and MULTI_INCR after committed, along
+    // with the count of removed records and the new values.
+    std::vector<std::pair<dsn::apps::multi_remove_response *, int64_t>> _multi_remove_responses;
+    std::vector<std::pair<dsn::apps::incr_response *, int64_t>> _incr_responses;
+    std::vector<std::pair<dsn::apps::multi_incr_response *, std::vector<int64_t>>>
+        _multi_incr_responses;
+
+    // the writes of the current batch indexed by key, which is built by the first
+    // db_get_in_batch() of the batch and then kept up to date by the following writes, so that
+    // the batches without incr pay nothing for it.
+    std::unordered_map<std::string, batch_key_writes> _batch_index;
+    bool _batch_index_built{false};
+
+    // whether the records written in the current batch exist after the preceding writes, and
+    // the sortkey_count metadata of the current batch, only used when the sortkey_count
+    // metadata is maintained.
+    std::unordered_map<std::string, bool> _batch_record_exists;
+    std::map<std::string, batch_sortkey_count> _batch_sortkey_counts;
+
+    // the applied state of the sortkey_count metadata, and the hash keys being recounted in
+    // background, which are written by the first batch after they are done.
+    sortkey_count_state _sortkey_count_state;
+    std::map<std::string, std::shared_ptr<sortkey_count_recount>> _sortkey_count_recounts;
+    static constexpr size_t MAX_SORTKEY_COUNT_RECOUNTS = 64;
 };
 
 } // namespace server
@@ -0,0 +1,130 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <string>
+#include <rocksdb/iostats_context.h>
+#include <rocksdb/perf_context.h>
+#include <rocksdb/perf_level.h>
+#include <dsn/dist/fmt_logging.h>
+#include <dsn/perf_counter/perf_counter_wrapper.h>
+
+namespace pegasus {
+namespace server {
+
+// Breakdown of the work done by rocksdb in one read request, taken from the thread local
+// rocksdb::PerfContext and rocksdb::IOStatsContext.
+struct read_perf_stat
+{
+    uint64_t block_cache_hit_count{0};
+    uint64_t block_read_count{0};
+    uint64_t block_read_bytes{0};
+    uint64_t internal_key_skipped_count{0};
+    uint64_t internal_delete_skipped_count{0};
+    uint64_t block_read_ns{0};
+    uint64_t get_from_memtable_ns{0};
+    uint64_t seek_ns{0};
+    uint64_t io_read_ns{0};
+
+    std::string to_string() const
+    {
+        return fmt::format("block_cache_hit_count = {}, block_read_count = {}, "
+                           "block_read_bytes = {}, internal_key_skipped_count = {}, "
+                           "internal_delete_skipped_count = {}, block_read_ns = {}, "
+                           "get_from_memtable_ns = {}, seek_ns = {}, io_read_ns = {}",
+                           block_cache_hit_count,
+                           block_read_count,
+                           block_read_bytes,
+                           internal_key_skipped_count,
+                           internal_delete_skipped_count,
+                           block_read_ns,
+                           get_from_memtable_ns,
+                           seek_ns,
+                           io_read_ns);
+    }
+};
+
+// Enables rocksdb perf context on the current thread during its lifetime. Both the counts and
+// the time are collected for every request, because any request may exceed the slow query
+// threshold and its breakdown is logged then.
+class read_perf_context
+{
+public:
+    read_perf_context()
+    {
+        rocksdb::SetPerfLevel(rocksdb::PerfLevel::kEnableTimeExceptForMutex);
+        rocksdb::get_perf_context()->Reset();
+        rocksdb::get_iostats_context()->Reset();
+    }
+
+    ~read_perf_context() { rocksdb::SetPerfLevel(rocksdb::PerfLevel::kDisable); }
+
+    read_perf_stat stat() const
+    {
+        const rocksdb::PerfContext *perf = rocksdb::get_perf_context();
+        read_perf_stat s;
+        s.block_cache_hit_count = perf->block_cache_hit_count;
+        s.block_read_count = perf->block_read_count;
+        s.block_read_bytes = perf->block_read_byte;
+        s.internal_key_skipped_count = perf->internal_key_skipped_count;
+        s.internal_delete_skipped_count = perf->internal_delete_skipped_count;
+        s.block_read_ns = perf->block_read_time;
+        s.get_from_memtable_ns = perf->get_from_memtable_time;
+        s.seek_ns = perf->seek_internal_seek_time;
+        s.io_read_ns = rocksdb::get_iostats_context()->read_nanos;
+        return s;
+    }
+};
+
+// Aggregates read_perf_stat of one kind of read requests into perf counters.
+class read_perf_counters
+{
+public:
+    void init(const std::string &op, const std::string &str_gpid)
+    {
+        std::string name = fmt::format("recent.{}.block_read_count@{}", op, str_gpid);
+        _pfc_block_read_count.init_app_counter(
+            "app.pegasus",
+            name.c_str(),
+            COUNTER_TYPE_VOLATILE_NUMBER,
+            fmt::format("statistic the recent count of blocks read from disk by {}", op).c_str());
+
+        name = fmt::format("recent.{}.block_read_us@{}", op, str_gpid);
+        _pfc_block_read_us.init_app_counter(
+            "app.pegasus",
+            name.c_str(),
+            COUNTER_TYPE_VOLATILE_NUMBER,
+            fmt::format("statistic the recent time in us of reading blocks from disk by {}", op)
+                .c_str());
+
+        name = fmt::format("recent.{}.internal_delete_skipped@{}", op, str_gpid);
+        _pfc_internal_delete_skipped.init_app_counter(
+            "app.pegasus",
+            name.c_str(),
+            COUNTER_TYPE_VOLATILE_NUMBER,
+            fmt::format("statistic the recent count of tombstones skipped by {}", op).c_str());
+    }
+
+    void add(const read_perf_stat &s)
+    {
+        if (s.block_read_count > 0) {
+            _pfc_block_read_count->add(s.block_read_count);
+        }
+        if (s.block_read_ns >= 1000) {
+            _pfc_block_read_us->add(s.block_read_ns / 1000);
+        }
+        if (s.internal_delete_skipped_count > 0) {
+            _pfc_internal_delete_skipped->add(s.internal_delete_skipped_count);
+        }
+    }
+
+private:
+    ::dsn::perf_counter_wrapper _pfc_block_read_count;
+    ::dsn::perf_counter_wrapper _pfc_block_read_us;
+    ::dsn::perf_counter_wrapper _pfc_internal_delete_skipped;
+};
+
+} // namespace server
+} // namespace pegasus
@@ -0,0 +1,158 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <rocksdb/slice.h>
+#include <dsn/utility/endians.h>
+#include <dsn/utility/string_view.h>
+
+#include "base/pegasus_value_schema.h"
+
+namespace pegasus {
+namespace server {
+
+// Metadata record which counts the records of one hash key, maintained by the write path when
+// the table is in sortkey_count "maintain" or "meta" mode, see SORTKEY_COUNT_MODE_KEY.
+//
+// rocksdb key = [0xFFFF] ['c'] [hash_key(bytes)]
+// The heading 0xFFFF is the hash key length field of normal keys, which is never used because
+// the hash key length must be less than UINT16_MAX. So metadata records are out of the range
+// of any scan, and can not be read or written by clients.
+//
+// rocksdb value = [value header of the data version] [count(int64)] [min_expire_ts(uint32)]
+//                 [generation(uint64)]
+// The header is the same as normal values with expire_ts = 0, so that the readers which do not
+// know metadata records will not fail on them.
+//
+// `count` is the count of the unexpired records when they were counted, plus the records put
+// since then. `min_expire_ts` is the minimal expire_ts of them, 0 if none of them has ttl.
+// Expired records are removed by compaction without updating the metadata, so the metadata is
+// valid only until `min_expire_ts`, after which the hash key is recounted in background.
+// `generation` is the generation of sortkey_count_state when the metadata is written, the
+// metadata of former generations are invalid and dropped by compaction.
+struct sortkey_count_meta
+{
+    int64_t count{0};
+    uint32_t min_expire_ts{0};
+    uint64_t generation{0};
+
+    static constexpr size_t ENCODED_SIZE = sizeof(int64_t) + sizeof(uint32_t) + sizeof(uint64_t);
+
+    static void generate_key(dsn::string_view hash_key, std::string &key)
+    {
+        key.reserve(3 + hash_key.length());
+        key.assign("\xFF\xFF"
+                   "c");
+        key.append(hash_key.data(), hash_key.length());
+    }
+
+    static bool is_meta_key(const rocksdb::Slice &key)
+    {
+        return key.size() >= 2 && static_cast<uint8_t>(key[0]) == 0xFF &&
+               static_cast<uint8_t>(key[1]) == 0xFF;
+    }
+
+    // Return false if `key` is not the key of a metadata record generated by generate_key().
+    static bool extract_hash_key(const rocksdb::Slice &key, dsn::string_view &hash_key)
+    {
+        if (key.size() < 3 || !is_meta_key(key) || key[2] != 'c') {
+            return false;
+        }
+        hash_key = dsn::string_view(key.data() + 3, key.size() - 3);
+        return true;
+    }
+
+    // Decodes from the tail of `value`, return false if `value` is too short.
+    bool decode(const rocksdb::Slice &value)
+    {
+        if (value.size() < ENCODED_SIZE) {
+            return false;
+        }
+        dsn::data_input input(
+            dsn::string_view(value.data() + value.size() - ENCODED_SIZE, ENCODED_SIZE));
+        count = static_cast<int64_t>(input.read_u64());
+        min_expire_ts = input.read_u32();
+        generation = input.read_u64();
+        return true;
+    }
+
+    void encode(std::string &buf) const
+    {
+        buf.resize(ENCODED_SIZE);
+        dsn::data_output output(buf);
+        output.write_u64(static_cast<uint64_t>(count));
+        output.write_u32(min_expire_ts);
+        output.write_u64(generation);
+    }
+
+    // Whether `count` is exact at `epoch_now` in `current_generation`.
+    bool valid(uint64_t current_generation, uint32_t epoch_now) const
+    {
+        return generation == current_generation && count >= 0 &&
+               !check_if_ts_expired(epoch_now, min_expire_ts);
+    }
+
+    void add_expire_ts(uint32_t expire_ts)
+    {
+        if (expire_ts != 0 && (min_expire_ts == 0 || expire_ts < min_expire_ts)) {
+            min_expire_ts = expire_ts;
+        }
+    }
+
+    // Adds the records counted by `delta`.
+    void add(const sortkey_count_meta &delta)
+    {
+        count += delta.count;
+        add_expire_ts(delta.min_expire_ts);
+    }
+};
+
+// The state record of the sortkey_count metadata, which is written by the MAINTAIN_SORTKEY_COUNT
+// write, so that it is the same on all the replicas at the same decree.
+//
+// rocksdb key = [0xFFFF] ['s']
+// rocksdb value = [value header of the data version] [generation(uint64)] [maintained(uint8)]
+//
+// `generation` is increased whenever `maintained` is switched, which invalidates all the
+// metadata records written before. It is 0 if the state record does not exist.
+struct sortkey_count_state
+{
+    uint64_t generation{0};
+    bool maintained{false};
+
+    static constexpr size_t ENCODED_SIZE = sizeof(uint64_t) + sizeof(uint8_t);
+
+    static std::string key()
+    {
+        return std::string("\xFF\xFF"
+                           "s");
+    }
+
+    // Decodes from the tail of `value`, return false if `value` is too short.
+    bool decode(const rocksdb::Slice &value)
+    {
+        if (value.size() < ENCODED_SIZE) {
+            return false;
+        }
+        dsn::data_input input(
+            dsn::string_view(value.data() + value.size() - ENCODED_SIZE, ENCODED_SIZE));
+        generation = input.read_u64();
+        maintained = input.read_u8() != 0;
+        return true;
+    }
+
+    void encode(std::string &buf) const
+    {
+        buf.resize(ENCODED_SIZE);
+        dsn::data_output output(buf);
+        output.write_u64(generation);
+        output.write_u8(maintained ? 1 : 0);
+    }
+};
+
+} // namespace server
+} // namespace pegasus
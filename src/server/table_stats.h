@@ -10,24 +10,27 @@ struct table_stats
 
     double get_total_read_qps() const
     {
-        return total_get_qps + total_multi_get_qps + total_scan_qps;
+        return total_get_qps + total_multi_get_qps + total_batch_get_qps + total_scan_qps;
     }
 
     double get_total_write_qps() const
     {
         return total_put_qps + total_multi_put_qps + total_remove_qps + total_multi_remove_qps +
-               total_incr_qps + total_check_and_set_qps + total_check_and_mutate_qps;
+               total_incr_qps + total_multi_incr_qps + total_check_and_set_qps +
+               total_check_and_mutate_qps;
     }
 
     void aggregate(const row_data &row)
     {
         total_get_qps += row.get_qps;
         total_multi_get_qps += row.multi_get_qps;
+        total_batch_get_qps += row.batch_get_qps;
         total_put_qps += row.put_qps;
         total_multi_put_qps += row.multi_put_qps;
         total_remove_qps += row.remove_qps;
         total_multi_remove_qps += row.multi_remove_qps;
         total_incr_qps += row.incr_qps;
+        total_multi_incr_qps += row.multi_incr_qps;
         total_check_and_set_qps += row.check_and_set_qps;
         total_check_and_mutate_qps += row.check_and_mutate_qps;
         total_scan_qps += row.scan_qps;
@@ -42,6 +45,8 @@ struct table_stats
         total_storage_count += row.storage_count;
         total_rdb_block_cache_hit_count += row.rdb_block_cache_hit_count;
         total_rdb_block_cache_total_count += row.rdb_block_cache_total_count;
+        total_rdb_row_cache_hit_count += row.rdb_row_cache_hit_count;
+        total_rdb_row_cache_total_count += row.rdb_row_cache_total_count;
         total_rdb_index_and_filter_blocks_mem_usage += row.rdb_index_and_filter_blocks_mem_usage;
         total_rdb_memtable_mem_usage += row.rdb_memtable_mem_usage;
         total_rdb_estimate_num_keys += row.rdb_estimate_num_keys;
@@ -51,11 +56,13 @@ struct table_stats
     {
         total_get_qps += row_stats.total_get_qps;
         total_multi_get_qps += row_stats.total_multi_get_qps;
+        total_batch_get_qps += row_stats.total_batch_get_qps;
         total_put_qps += row_stats.total_put_qps;
         total_multi_put_qps += row_stats.total_multi_put_qps;
         total_remove_qps += row_stats.total_remove_qps;
         total_multi_remove_qps += row_stats.total_multi_remove_qps;
         total_incr_qps += row_stats.total_incr_qps;
+        total_multi_incr_qps += row_stats.total_multi_incr_qps;
         total_check_and_set_qps += row_stats.total_check_and_set_qps;
         total_check_and_mutate_qps += row_stats.total_check_and_mutate_qps;
         total_scan_qps += row_stats.total_scan_qps;
@@ -72,6 +79,8 @@ struct table_stats
         total_storage_count += row_stats.total_storage_count;
         total_rdb_block_cache_hit_count += row_stats.total_rdb_block_cache_hit_count;
         total_rdb_block_cache_total_count += row_stats.total_rdb_block_cache_total_count;
+        total_rdb_row_cache_hit_count += row_stats.total_rdb_row_cache_hit_count;
+        total_rdb_row_cache_total_count += row_stats.total_rdb_row_cache_total_count;
         total_rdb_index_and_filter_blocks_mem_usage +=
             row_stats.total_rdb_index_and_filter_blocks_mem_usage;
         total_rdb_memtable_mem_usage += row_stats.total_rdb_memtable_mem_usage;
@@ -81,11 +90,13 @@ struct table_stats
     std::string app_name;
     double total_get_qps = 0;
     double total_multi_get_qps = 0;
+    double total_batch_get_qps = 0;
     double total_put_qps = 0;
     double total_multi_put_qps = 0;
     double total_remove_qps = 0;
     double total_multi_remove_qps = 0;
     double total_incr_qps = 0;
+    double total_multi_incr_qps = 0;
     double total_check_and_set_qps = 0;
     double total_check_and_mutate_qps = 0;
     double total_scan_qps = 0;
@@ -100,6 +111,8 @@ struct table_stats
     double total_storage_count = 0;
     double total_rdb_block_cache_hit_count = 0;
     double total_rdb_block_cache_total_count = 0;
+    double total_rdb_row_cache_hit_count = 0;
+    double total_rdb_row_cache_total_count = 0;
     double total_rdb_index_and_filter_blocks_mem_usage = 0;
     double total_rdb_memtable_mem_usage = 0;
     double total_rdb_estimate_num_keys = 0;
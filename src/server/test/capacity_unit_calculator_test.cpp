@@ -160,6 +160,35 @@ TEST_F(capacity_unit_calculator_test, multi_get)
     _cal->reset();
 }
 
+TEST_F(capacity_unit_calculator_test, batch_get)
+{
+    std::vector<::dsn::apps::full_data> data;
+    for (int i = 0; i < 500; i++) {
+        ::dsn::apps::full_data d;
+        d.hash_key = dsn::blob::create_from_bytes("hash_key_" + std::to_string(i));
+        d.sort_key = dsn::blob::create_from_bytes("sort_key_" + std::to_string(i));
+        d.value = dsn::blob::create_from_bytes("value_" + std::to_string(i));
+        data.emplace_back(std::move(d));
+    }
+    _cal->add_batch_get_cu(rocksdb::Status::kOk, data);
+    ASSERT_GT(_cal->read_cu, 1);
+    ASSERT_EQ(_cal->write_cu, 0);
+    _cal->reset();
+
+    data.clear();
+    _cal->add_batch_get_cu(rocksdb::Status::kNotFound, data);
+    ASSERT_EQ(_cal->read_cu, 1);
+    _cal->reset();
+
+    _cal->add_batch_get_cu(rocksdb::Status::kInvalidArgument, data);
+    ASSERT_EQ(_cal->read_cu, 1);
+    _cal->reset();
+
+    _cal->add_batch_get_cu(rocksdb::Status::kCorruption, data);
+    ASSERT_EQ(_cal->read_cu, 0);
+    _cal->reset();
+}
+
 TEST_F(capacity_unit_calculator_test, scan)
 {
     std::vector<::dsn::apps::key_value> kvs;
@@ -193,6 +222,26 @@ TEST_F(capacity_unit_calculator_test, scan)
     _cal->reset();
 }
 
+TEST_F(capacity_unit_calculator_test, aggregate_scan)
+{
+    _cal->add_aggregate_scan_cu(rocksdb::Status::kIncomplete, 100);
+    ASSERT_EQ(_cal->read_cu, 1);
+    _cal->reset();
+
+    _cal->add_aggregate_scan_cu(rocksdb::Status::kOk, 4096 * 10 + 1);
+    ASSERT_EQ(_cal->read_cu, 11);
+    ASSERT_EQ(_cal->write_cu, 0);
+    _cal->reset();
+
+    _cal->add_aggregate_scan_cu(rocksdb::Status::kNotFound, 0);
+    ASSERT_EQ(_cal->read_cu, 1);
+    _cal->reset();
+
+    _cal->add_aggregate_scan_cu(rocksdb::Status::kCorruption, 100);
+    ASSERT_EQ(_cal->read_cu, 0);
+    _cal->reset();
+}
+
 TEST_F(capacity_unit_calculator_test, sortkey_count)
 {
     for (int i = 0; i < MAX_ROCKSDB_STATUS_CODE; i++) {
@@ -313,6 +362,30 @@ TEST_F(capacity_unit_calculator_test, incr)
     }
 }
 
+TEST_F(capacity_unit_calculator_test, multi_incr)
+{
+    std::vector<::dsn::apps::incr_item> items(100);
+    for (int i = 0; i < 100; i++) {
+        items[i].sort_key = dsn::blob::create_from_bytes("key_" + std::to_string(i));
+        items[i].increment = i;
+    }
+
+    for (int i = 0; i < MAX_ROCKSDB_STATUS_CODE; i++) {
+        _cal->add_multi_incr_cu(i, items);
+        if (i == rocksdb::Status::kOk) {
+            ASSERT_EQ(_cal->read_cu, 1);
+            ASSERT_EQ(_cal->write_cu, 1);
+        } else if (i == rocksdb::Status::kInvalidArgument) {
+            ASSERT_EQ(_cal->read_cu, 1);
+            ASSERT_EQ(_cal->write_cu, 0);
+        } else {
+            ASSERT_EQ(_cal->write_cu, 0);
+            ASSERT_EQ(_cal->read_cu, 0);
+        }
+        _cal->reset();
+    }
+}
+
 TEST_F(capacity_unit_calculator_test, check_and_set)
 {
     _cal->add_check_and_set_cu(rocksdb::Status::kOk,
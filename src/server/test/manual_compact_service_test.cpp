@@ -255,6 +255,10 @@ TEST_F(manual_compact_service_test, extract_manual_compact_opts)
     envs[MANUAL_COMPACT_ONCE_KEY_PREFIX + MANUAL_COMPACT_TARGET_LEVEL_KEY] = "8";
     extract_manual_compact_opts(envs, MANUAL_COMPACT_ONCE_KEY_PREFIX, out);
     ASSERT_EQ(out.target_level, -1);
+
+    envs[MANUAL_COMPACT_ONCE_KEY_PREFIX + MANUAL_COMPACT_TARGET_LEVEL_KEY] = "0";
+    extract_manual_compact_opts(envs, MANUAL_COMPACT_ONCE_KEY_PREFIX, out);
+    ASSERT_EQ(out.target_level, 0);
 }
 
 TEST_F(manual_compact_service_test, check_manual_compact_state_0_interval)
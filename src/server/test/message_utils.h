@@ -38,4 +38,16 @@ inline dsn::message_ex *create_incr_request(const dsn::apps::incr_request &reque
     return dsn::from_thrift_request_to_received_message(request, dsn::apps::RPC_RRDB_RRDB_INCR);
 }
 
+inline dsn::message_ex *create_multi_incr_request(const dsn::apps::multi_incr_request &request)
+{
+    return dsn::from_thrift_request_to_received_message(request,
+                                                        dsn::apps::RPC_RRDB_RRDB_MULTI_INCR);
+}
+
+inline dsn::message_ex *create_bulk_ingest_request(const dsn::apps::bulk_ingest_request &request)
+{
+    return dsn::from_thrift_request_to_received_message(request,
+                                                        dsn::apps::RPC_RRDB_RRDB_BULK_INGEST);
+}
+
 } // namespace pegasus
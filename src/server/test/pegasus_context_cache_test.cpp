@@ -0,0 +1,146 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/pegasus_scan_context.h"
+
+#include <gtest/gtest.h>
+
+namespace pegasus {
+namespace server {
+
+static std::shared_ptr<pegasus_scan_context> make_context(int32_t batch_size)
+{
+    return std::make_shared<pegasus_scan_context>(nullptr,
+                                                  std::string(),
+                                                  false,
+                                                  ::dsn::apps::filter_type::FT_NO_FILTER,
+                                                  std::string(),
+                                                  ::dsn::apps::filter_type::FT_NO_FILTER,
+                                                  std::string(),
+                                                  ::dsn::apps::filter_type::FT_NO_FILTER,
+                                                  std::string(),
+                                                  batch_size,
+                                                  0,
+                                                  0,
+                                                  false,
+                                                  false);
+}
+
+TEST(pegasus_context_cache, put_and_fetch)
+{
+    pegasus_context_cache cache;
+    int64_t h1 = cache.put(make_context(1));
+    int64_t h2 = cache.put(make_context(2));
+    ASSERT_NE(h1, h2);
+    ASSERT_EQ(2, cache.size());
+
+    std::shared_ptr<pegasus_scan_context> ctx = cache.fetch(h2);
+    ASSERT_NE(nullptr, ctx);
+    ASSERT_EQ(2, ctx->batch_size);
+    ASSERT_EQ(nullptr, cache.fetch(h2));
+    ASSERT_EQ(1, cache.size());
+
+    cache.clear();
+    ASSERT_EQ(nullptr, cache.fetch(h1));
+    ASSERT_EQ(0, cache.size());
+}
+
+TEST(pegasus_context_cache, evict_oldest)
+{
+    pegasus_context_cache cache;
+    // one context per shard at most
+    cache.set_limits(1, 300);
+
+    std::vector<int64_t> handles;
+    for (int i = 0; i < 32; ++i) {
+        handles.push_back(cache.put(make_context(i)));
+    }
+    // handles are consecutive, so each shard gets two contexts and evicts the older one
+    ASSERT_EQ(16, cache.size());
+    ASSERT_EQ(16, cache.fetch_evict_count());
+    ASSERT_EQ(0, cache.fetch_evict_count());
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_EQ(nullptr, cache.fetch(handles[i]));
+    }
+    for (int i = 16; i < 32; ++i) {
+        ASSERT_NE(nullptr, cache.fetch(handles[i]));
+    }
+}
+
+TEST(pegasus_context_cache, sweep_expired)
+{
+    pegasus_context_cache cache;
+    cache.set_limits(0, 0);
+    cache.put(make_context(1));
+    cache.put(make_context(2));
+    ASSERT_EQ(2, cache.sweep_expired());
+    ASSERT_EQ(0, cache.size());
+
+    cache.set_limits(0, 300);
+    int64_t h = cache.put(make_context(3));
+    ASSERT_EQ(0, cache.sweep_expired());
+    ASSERT_NE(nullptr, cache.fetch(h));
+}
+
+TEST(pegasus_context_cache, prefetch_quota)
+{
+    auto quota = std::make_shared<pegasus_scan_prefetch_quota>();
+    ASSERT_FALSE(quota->enabled());
+
+    quota->set_max_bytes(100);
+    ASSERT_TRUE(quota->enabled());
+    ASSERT_TRUE(quota->try_acquire(60));
+    // the limit is never exceeded
+    ASSERT_FALSE(quota->try_acquire(50));
+    ASSERT_TRUE(quota->try_acquire(40));
+    ASSERT_EQ(100, quota->used_bytes());
+    quota->release(100, false);
+    ASSERT_EQ(0, quota->used_bytes());
+    ASSERT_EQ(0, quota->fetch_wasted_count());
+
+    // the prefetched batch which is not replied is released as wasted
+    pegasus_context_cache cache;
+    std::shared_ptr<pegasus_scan_context> context = make_context(1);
+    context->prefetch_quota = quota;
+    context->prefetched.reset(new pegasus_scan_batch());
+    context->prefetched->bytes = 50;
+    ASSERT_TRUE(quota->try_acquire(50));
+    cache.put(context);
+    cache.clear();
+    // still held by others, e.g. the prefetch task
+    ASSERT_EQ(50, quota->used_bytes());
+    context.reset();
+    ASSERT_EQ(0, quota->used_bytes());
+    ASSERT_EQ(1, quota->fetch_wasted_count());
+}
+
+TEST(pegasus_context_cache, remove_expired)
+{
+    pegasus_scan_batch batch;
+    const char *keys[] = {"key0", "key1", "key2", "key3"};
+    const uint32_t expire_ts[] = {0, 100, 200, 100};
+    for (int i = 0; i < 4; ++i) {
+        ::dsn::apps::key_value kv;
+        kv.key.assign(keys[i], 0, 4);
+        kv.value.assign("value", 0, 5);
+        batch.bytes += kv.key.length() + kv.value.length();
+        batch.kvs.emplace_back(std::move(kv));
+        batch.expire_ts.push_back(expire_ts[i]);
+    }
+
+    batch.remove_expired(99);
+    ASSERT_EQ(4, batch.kvs.size());
+    ASSERT_EQ(0, batch.expire_count);
+
+    batch.remove_expired(100);
+    ASSERT_EQ(2, batch.kvs.size());
+    ASSERT_EQ(2, batch.expire_ts.size());
+    ASSERT_EQ("key0", batch.kvs[0].key.to_string());
+    ASSERT_EQ("key2", batch.kvs[1].key.to_string());
+    ASSERT_EQ(2, batch.expire_count);
+    ASSERT_EQ(18, batch.bytes);
+}
+
+} // namespace server
+} // namespace pegasus
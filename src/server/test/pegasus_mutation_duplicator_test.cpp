@@ -193,6 +193,68 @@ public:
         }
     }
 
+    void test_duplicate_batched()
+    {
+        replica_base replica(dsn::gpid(1, 1), "fake_replica");
+        auto duplicator = new_mutation_duplicator(&replica, "onebox2", "temp");
+        duplicator->set_task_environment(&_env);
+
+        // the writes of 2 hash keys are interleaved
+        mutation_tuple_set muts;
+        size_t write_size = 0;
+        for (uint64_t i = 0; i < 100; i++) {
+            uint64_t ts = 200 + i;
+            dsn::task_code code = dsn::apps::RPC_RRDB_RRDB_PUT;
+
+            dsn::apps::update_request request;
+            pegasus::pegasus_generate_key(
+                request.key, std::string("hash") + std::to_string(i % 2), std::string("sort"));
+            dsn::message_ptr msg = dsn::from_thrift_request_to_received_message(request, code);
+            auto data = dsn::move_message_to_blob(msg.get());
+            write_size = data.length();
+
+            muts.insert(std::make_tuple(ts, code, data));
+        }
+
+        auto duplicator_impl = dynamic_cast<pegasus_mutation_duplicator *>(duplicator.get());
+        duplicator_impl->_batch_bytes = 10 * write_size;
+        RPC_MOCKING(duplicate_rpc)
+        {
+            duplicator->duplicate(muts, [](size_t) {});
+
+            // each hash has 50 writes, which are carried by 5 rpcs.
+            ASSERT_EQ(duplicator_impl->_inflights.size(), 2);
+            ASSERT_EQ(duplicate_rpc::mail_box().size(), 2);
+            for (const auto &ents : duplicator_impl->_inflights) {
+                ASSERT_EQ(ents.second.size(), 4);
+            }
+
+            std::map<uint64_t, int64_t> last_ts; // hash -> timestamp of the last shipped write
+            size_t shipped_count = 0;
+            while (!duplicate_rpc::mail_box().empty()) {
+                auto rpc_list = std::move(duplicate_rpc::mail_box());
+                for (const auto &rpc : rpc_list) {
+                    uint64_t hash = get_hash(rpc);
+                    const auto &entries = rpc.request().entries;
+                    ASSERT_EQ(entries.size(), 10);
+                    for (const auto &entry : entries) {
+                        ASSERT_EQ(get_hash_from_request(entry.task_code, entry.raw_message), hash);
+                        // ensure writes of the same hash are shipped in order
+                        ASSERT_GT(entry.timestamp, last_ts[hash]);
+                        last_ts[hash] = entry.timestamp;
+                    }
+                    shipped_count += entries.size();
+
+                    rpc.response().error = dsn::ERR_OK;
+                    duplicator_impl->on_duplicate_reply(hash, [](size_t) {}, rpc, dsn::ERR_OK);
+                }
+                _tracker.wait_outstanding_tasks();
+            }
+            ASSERT_EQ(shipped_count, 100);
+            ASSERT_EQ(duplicator_impl->_inflights.size(), 0);
+        }
+    }
+
     void test_create_duplicator()
     {
         replica_base replica(dsn::gpid(1, 1), "fake_replica");
@@ -207,7 +269,12 @@ public:
 private:
     static uint64_t get_hash(const duplicate_rpc &rpc)
     {
-        return get_hash_from_request(rpc.request().task_code, rpc.request().raw_message);
+        const auto &request = rpc.request();
+        if (request.__isset.entries) {
+            return get_hash_from_request(request.entries.front().task_code,
+                                         request.entries.front().raw_message);
+        }
+        return get_hash_from_request(request.task_code, request.raw_message);
     }
 };
 
@@ -290,6 +357,8 @@ TEST_F(pegasus_mutation_duplicator_test, duplicate_isolated_hashkeys)
     test_duplicate_isolated_hashkeys();
 }
 
+TEST_F(pegasus_mutation_duplicator_test, duplicate_batched) { test_duplicate_batched(); }
+
 TEST_F(pegasus_mutation_duplicator_test, create_duplicator) { test_create_duplicator(); }
 
 } // namespace server
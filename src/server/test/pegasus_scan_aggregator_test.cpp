@@ -0,0 +1,82 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/pegasus_scan_aggregator.h"
+
+#include <gtest/gtest.h>
+
+namespace pegasus {
+namespace server {
+
+TEST(pegasus_scan_aggregator, histogram_bucket)
+{
+    ASSERT_EQ(0, pegasus_scan_aggregator::histogram_bucket(0));
+    ASSERT_EQ(1, pegasus_scan_aggregator::histogram_bucket(1));
+    ASSERT_EQ(2, pegasus_scan_aggregator::histogram_bucket(2));
+    ASSERT_EQ(2, pegasus_scan_aggregator::histogram_bucket(3));
+    ASSERT_EQ(3, pegasus_scan_aggregator::histogram_bucket(4));
+    ASSERT_EQ(11, pegasus_scan_aggregator::histogram_bucket(1024));
+}
+
+TEST(pegasus_scan_aggregator, count_only)
+{
+    pegasus_scan_aggregator aggregator(false, 10);
+    aggregator.add(dsn::blob::create_from_bytes("h1"), dsn::blob::create_from_bytes("s1"), 10);
+    aggregator.add(dsn::blob::create_from_bytes("h1"), dsn::blob::create_from_bytes("s2"), 10);
+
+    dsn::apps::aggregate_scan_response resp;
+    aggregator.fill_response(resp, false);
+    ASSERT_EQ(2, resp.row_count);
+    ASSERT_EQ(1, resp.hash_key_count);
+    ASSERT_EQ(0, resp.row_size.count);
+
+    // hash key "h1" spans two batches, and should be counted only once
+    aggregator.add(dsn::blob::create_from_bytes("h1"), dsn::blob::create_from_bytes("s3"), 10);
+    aggregator.add(dsn::blob::create_from_bytes("h2"), dsn::blob::create_from_bytes("s1"), 10);
+
+    resp = dsn::apps::aggregate_scan_response();
+    aggregator.fill_response(resp, true);
+    ASSERT_EQ(2, resp.row_count);
+    ASSERT_EQ(1, resp.hash_key_count);
+    ASSERT_TRUE(resp.top_rows.empty());
+}
+
+TEST(pegasus_scan_aggregator, stat_size)
+{
+    pegasus_scan_aggregator aggregator(true, 2);
+    aggregator.add(dsn::blob::create_from_bytes("h1"), dsn::blob::create_from_bytes("s1"), 0);
+    aggregator.add(dsn::blob::create_from_bytes("h1"), dsn::blob::create_from_bytes("s2"), 100);
+    aggregator.add(dsn::blob::create_from_bytes("h2"), dsn::blob::create_from_bytes("s1"), 10);
+
+    dsn::apps::aggregate_scan_response resp;
+    aggregator.fill_response(resp, false);
+    ASSERT_EQ(3, resp.row_count);
+    ASSERT_EQ(2, resp.hash_key_count);
+    ASSERT_EQ(3, resp.value_size.count);
+    ASSERT_EQ(110, resp.value_size.sum);
+    ASSERT_EQ(100, resp.value_size.max);
+    ASSERT_EQ(1, resp.value_size.buckets[0]);
+    ASSERT_EQ(1, resp.value_size.buckets[4]);
+    ASSERT_EQ(1, resp.value_size.buckets[7]);
+    ASSERT_EQ(3, resp.row_size.count);
+    ASSERT_EQ(122, resp.row_size.sum);
+    // top rows are returned only in the last batch
+    ASSERT_TRUE(resp.top_rows.empty());
+
+    aggregator.add(dsn::blob::create_from_bytes("h3"), dsn::blob::create_from_bytes("s1"), 50);
+
+    resp = dsn::apps::aggregate_scan_response();
+    aggregator.fill_response(resp, true);
+    ASSERT_EQ(1, resp.row_count);
+    ASSERT_EQ(1, resp.value_size.count);
+    ASSERT_EQ(2, resp.top_rows.size());
+    ASSERT_EQ("h1", resp.top_rows[0].hash_key.to_string());
+    ASSERT_EQ("s2", resp.top_rows[0].sort_key.to_string());
+    ASSERT_EQ(104, resp.top_rows[0].row_size);
+    ASSERT_EQ("h3", resp.top_rows[1].hash_key.to_string());
+    ASSERT_EQ(54, resp.top_rows[1].row_size);
+}
+
+} // namespace server
+} // namespace pegasus
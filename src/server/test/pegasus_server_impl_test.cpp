@@ -3,7 +3,13 @@
 // can be found in the LICENSE file in the root directory of this source tree.
 
 #include <base/pegasus_key_schema.h>
+#include <base/pegasus_value_schema.h>
+#include <base/pegasus_sst_builder.h>
+#include <base/pegasus_rpc_types.h>
 #include "pegasus_server_test_base.h"
+#include "message_utils.h"
+
+#include <thread>
 
 namespace pegasus {
 namespace server {
@@ -55,10 +61,557 @@ public:
             ASSERT_EQ(before_count + test.expect_perf_counter_incr, after_count);
         }
     }
+
+    void test_slow_query_perf_breakdown()
+    {
+        std::string test_hash_key = "test_hash_key";
+        std::string test_sort_key = "test_sort_key";
+        dsn::blob test_key;
+        pegasus_generate_key(test_key, test_hash_key, test_sort_key);
+
+        // flush the record so that the get has to read a block from the sst file
+        pegasus_value_generator gen;
+        rocksdb::SliceParts sparts =
+            gen.generate_value(_server->_pegasus_data_version, "value", 0, 0);
+        rocksdb::Slice skey(test_key.data(), test_key.length());
+        rocksdb::WriteBatch batch;
+        batch.Put(rocksdb::SliceParts(&skey, 1), sparts);
+        ASSERT_TRUE(_server->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+        ASSERT_TRUE(_server->_db->Flush(rocksdb::FlushOptions()).ok());
+
+        // the on_get function will sleep 10ms for unit test, so it is a slow query
+        std::map<std::string, std::string> envs;
+        _server->query_app_envs(envs);
+        envs[ROCKSDB_ENV_SLOW_QUERY_THRESHOLD] = "10";
+        _server->update_app_envs(envs);
+
+        _server->_last_abnormal_perf_stat = read_perf_stat();
+        ::dsn::rpc_replier<::dsn::apps::read_response> reply(nullptr);
+        _server->on_get(test_key, reply);
+
+        // both the counts and the time of reading the block are logged
+        const read_perf_stat &perf_stat = _server->_last_abnormal_perf_stat;
+        ASSERT_LT(0, perf_stat.block_read_count);
+        ASSERT_LT(0, perf_stat.block_read_bytes);
+        ASSERT_LT(0, perf_stat.block_read_ns);
+        ASSERT_NE(std::string::npos, perf_stat.to_string().find("block_read_ns = "));
+    }
+
+    void test_value_filter()
+    {
+        struct test_case
+        {
+            ::dsn::apps::filter_type::type value_filter_type;
+            std::string value_filter_pattern;
+            int expect_result; // 1-appended, 3-filtered
+        } tests[] = {{::dsn::apps::filter_type::FT_NO_FILTER, "", 1},
+                     {::dsn::apps::filter_type::FT_MATCH_ANYWHERE, "value", 1},
+                     {::dsn::apps::filter_type::FT_MATCH_ANYWHERE, "other", 3},
+                     {::dsn::apps::filter_type::FT_MATCH_PREFIX, "test", 1},
+                     {::dsn::apps::filter_type::FT_MATCH_PREFIX, "value", 3},
+                     {::dsn::apps::filter_type::FT_MATCH_POSTFIX, "value", 1},
+                     {::dsn::apps::filter_type::FT_MATCH_POSTFIX, "test", 3}};
+
+        std::string test_hash_key = "test_hash_key";
+        std::string test_sort_key = "test_sort_key";
+        dsn::blob test_key;
+        pegasus_generate_key(test_key, test_hash_key, test_sort_key);
+        rocksdb::Slice key(test_key.data(), test_key.length());
+
+        std::string test_value = "test_value";
+        pegasus_value_generator gen;
+        rocksdb::SliceParts sparts =
+            gen.generate_value(_server->_pegasus_data_version, test_value, 0, 0);
+        std::string raw_value;
+        for (int i = 0; i < sparts.num_parts; i++) {
+            raw_value += sparts.parts[i].ToString();
+        }
+        rocksdb::Slice value(raw_value);
+
+        for (auto test : tests) {
+            ::dsn::blob pattern(
+                test.value_filter_pattern.data(), 0, test.value_filter_pattern.size());
+
+            std::vector<::dsn::apps::key_value> kvs;
+            int r = _server->append_key_value_for_scan(kvs,
+                                                       key,
+                                                       value,
+                                                       ::dsn::apps::filter_type::FT_NO_FILTER,
+                                                       ::dsn::blob(),
+                                                       ::dsn::apps::filter_type::FT_NO_FILTER,
+                                                       ::dsn::blob(),
+                                                       test.value_filter_type,
+                                                       pattern,
+                                                       0,
+                                                       false);
+            ASSERT_EQ(test.expect_result, r);
+            ASSERT_EQ(test.expect_result == 1 ? 1 : 0, kvs.size());
+
+            kvs.clear();
+            r = _server->append_key_value_for_multi_get(kvs,
+                                                        key,
+                                                        value,
+                                                        ::dsn::apps::filter_type::FT_NO_FILTER,
+                                                        ::dsn::blob(),
+                                                        test.value_filter_type,
+                                                        pattern,
+                                                        0,
+                                                        true);
+            ASSERT_EQ(test.expect_result, r);
+            ASSERT_EQ(test.expect_result == 1 ? 1 : 0, kvs.size());
+        }
+    }
+
+    void test_scan_batch_limit()
+    {
+        uint64_t now = dsn_now_ns();
+        ASSERT_FALSE(pegasus_server_impl::is_scan_batch_full(1 << 20, now, 0, 0));
+        ASSERT_FALSE(pegasus_server_impl::is_scan_batch_full(100, now, 101, 0));
+        ASSERT_TRUE(pegasus_server_impl::is_scan_batch_full(101, now, 101, 0));
+        ASSERT_FALSE(pegasus_server_impl::is_scan_batch_full(0, now, 0, 1000 * 1000));
+        ASSERT_TRUE(pegasus_server_impl::is_scan_batch_full(0, now - 2000 * 1000, 0, 1000));
+    }
+
+    void test_request_deadline()
+    {
+        int64_t now_ms = utils::unix_now_ms();
+        ASSERT_FALSE(_server->is_past_deadline(0));
+        ASSERT_FALSE(_server->is_past_deadline(now_ms + 1000));
+        // clock skew is tolerated
+        ASSERT_FALSE(_server->is_past_deadline(now_ms - _server->_request_deadline_skew_ms / 2));
+        ASSERT_TRUE(_server->is_past_deadline(now_ms - _server->_request_deadline_skew_ms - 1000));
+        // only checked once every DEADLINE_CHECK_INTERVAL iterated records
+        int64_t past_ms = now_ms - _server->_request_deadline_skew_ms - 1000;
+        ASSERT_FALSE(_server->is_past_deadline_on_iterate(past_ms, 1));
+        ASSERT_TRUE(_server->is_past_deadline_on_iterate(
+            past_ms, pegasus_server_impl::DEADLINE_CHECK_INTERVAL));
+        ASSERT_FALSE(_server->is_past_deadline_on_iterate(
+            now_ms + 1000, pegasus_server_impl::DEADLINE_CHECK_INTERVAL));
+
+        std::string test_hash_key = "test_hash_key";
+        ::dsn::apps::multi_get_request request;
+        request.__set_hash_key(dsn::blob(test_hash_key.data(), 0, test_hash_key.size()));
+        request.__set_deadline_ms(now_ms - _server->_request_deadline_skew_ms - 1000);
+        long before_count = _server->_pfc_recent_read_shed_count->get_integer_value();
+        ::dsn::rpc_replier<::dsn::apps::multi_get_response> reply(nullptr);
+        _server->on_multi_get(request, reply);
+        ASSERT_EQ(before_count + 1, _server->_pfc_recent_read_shed_count->get_integer_value());
+
+        request.__set_deadline_ms(now_ms + 1000);
+        _server->on_multi_get(request, reply);
+        ASSERT_EQ(before_count + 1, _server->_pfc_recent_read_shed_count->get_integer_value());
+    }
+
+    void test_secondary_read()
+    {
+        // nothing has been applied yet
+        _server->_allow_secondary_read = true;
+        ASSERT_FALSE(_server->can_serve_secondary_read());
+
+        _server->_last_applied_write_time_us.store(dsn_now_us());
+        ASSERT_TRUE(_server->can_serve_secondary_read());
+        _server->_allow_secondary_read = false;
+        ASSERT_FALSE(_server->can_serve_secondary_read());
+
+        _server->_allow_secondary_read = true;
+        _server->_last_applied_write_time_us.store(
+            dsn_now_us() - (_server->_secondary_read_max_staleness_ms + 1000) * 1000);
+        ASSERT_FALSE(_server->can_serve_secondary_read());
+    }
+
+    void test_drop_expired_sst()
+    {
+        uint32_t expire_ts = utils::epoch_now() + 2;
+        pegasus_value_generator gen;
+        for (int i = 0; i < 10; ++i) {
+            dsn::blob key;
+            pegasus_generate_key(key, std::string("hash_key"), "sort_key_" + std::to_string(i));
+            rocksdb::SliceParts sparts =
+                gen.generate_value(_server->_pegasus_data_version, "value", expire_ts, 0);
+            rocksdb::Slice skey(key.data(), key.length());
+            rocksdb::WriteBatch batch;
+            batch.Put(rocksdb::SliceParts(&skey, 1), sparts);
+            ASSERT_TRUE(_server->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+        }
+        ASSERT_TRUE(_server->_db->Flush(rocksdb::FlushOptions()).ok());
+        // move the file out of level 0
+        ASSERT_TRUE(
+            _server->_db->CompactRange(rocksdb::CompactRangeOptions(), nullptr, nullptr).ok());
+
+        std::vector<rocksdb::LiveFileMetaData> files;
+        _server->_db->GetLiveFilesMetaData(&files);
+        ASSERT_EQ(1, files.size());
+        ASSERT_LT(0, files[0].level);
+
+        // not expired yet, the file is skippable once expired
+        _server->drop_expired_sst_files();
+        ASSERT_EQ(1, _server->_skippable_sst.size());
+        ASSERT_EQ(expire_ts, _server->_skippable_sst.begin()->second);
+        files.clear();
+        _server->_db->GetLiveFilesMetaData(&files);
+        ASSERT_EQ(1, files.size());
+
+        std::this_thread::sleep_for(std::chrono::seconds(3));
+        _server->drop_expired_sst_files();
+        ASSERT_EQ(0, _server->_skippable_sst.size());
+        files.clear();
+        _server->_db->GetLiveFilesMetaData(&files);
+        ASSERT_EQ(0, files.size());
+        ASSERT_EQ(1, _server->_pfc_recent_expired_sst_drop_count->get_integer_value());
+    }
+
+    void test_update_block_cache()
+    {
+        ASSERT_EQ(_server->_s_block_cache, _server->_block_cache);
+        ASSERT_TRUE(_server->_scan_fill_block_cache.load());
+
+        std::map<std::string, std::string> envs;
+        envs[ROCKSDB_ENV_SCAN_FILL_BLOCK_CACHE] = "false";
+        // the replica is open, the shared block cache can not be replaced
+        envs[ROCKSDB_ENV_BLOCK_CACHE_CAPACITY] = "1048576";
+        _server->update_app_envs(envs);
+        ASSERT_FALSE(_server->_scan_fill_block_cache.load());
+        ASSERT_EQ(_server->_s_block_cache, _server->_block_cache);
+        ASSERT_EQ(0, _server->_block_cache_capacity);
+
+        // reopen the replica with the dedicated block cache
+        _server->stop(false);
+        _server = dsn::make_unique<pegasus_server_impl>(_replica);
+        ASSERT_EQ(dsn::ERR_OK, start(envs));
+        ASSERT_NE(_server->_s_block_cache, _server->_block_cache);
+        ASSERT_EQ(1048576, _server->_block_cache->GetCapacity());
+
+        // the capacity of the dedicated block cache can be updated dynamically, and it is taken
+        // from the shared block cache
+        envs[ROCKSDB_ENV_BLOCK_CACHE_CAPACITY] = "2097152";
+        _server->update_app_envs(envs);
+        ASSERT_EQ(2097152, _server->_block_cache->GetCapacity());
+        ASSERT_EQ(_server->_s_block_cache_capacity - 2097152,
+                  _server->_s_block_cache->GetCapacity());
+
+        // the capacity is given back once the dedicated block cache is released
+        envs.erase(ROCKSDB_ENV_BLOCK_CACHE_CAPACITY);
+        _server->stop(false);
+        _server = dsn::make_unique<pegasus_server_impl>(_replica);
+        ASSERT_EQ(dsn::ERR_OK, start(envs));
+        ASSERT_EQ(_server->_s_block_cache, _server->_block_cache);
+        ASSERT_EQ(_server->_s_block_cache_capacity, _server->_s_block_cache->GetCapacity());
+    }
+
+    void test_persistent_cache()
+    {
+        // reopen the replica with a persistent cache in a temp dir
+        std::string path = "./data/persistent_cache_test";
+        dsn::utils::filesystem::remove_path(path);
+        ASSERT_TRUE(dsn::utils::filesystem::create_directory(path));
+        std::shared_ptr<rocksdb::PersistentCache> cache;
+        rocksdb::Status status = rocksdb::NewPersistentCache(
+            rocksdb::Env::Default(), path, 64 << 20, nullptr, false, &cache);
+        ASSERT_TRUE(status.ok()) << status.ToString();
+        _server->stop(false);
+        _server->_s_persistent_cache = cache;
+        _server = dsn::make_unique<pegasus_server_impl>(_replica);
+        // the persistent cache is held by the table options of the replica from now on
+        _server->_s_persistent_cache = nullptr;
+        ASSERT_EQ(dsn::ERR_OK, start());
+        ASSERT_EQ(cache, _server->_tbl_opts.persistent_cache);
+
+        std::string test_hash_key = "test_hash_key";
+        std::string test_sort_key = "test_sort_key";
+        dsn::blob test_key;
+        pegasus_generate_key(test_key, test_hash_key, test_sort_key);
+        pegasus_value_generator gen;
+        rocksdb::SliceParts sparts =
+            gen.generate_value(_server->_pegasus_data_version, "value", 0, 0);
+        rocksdb::Slice skey(test_key.data(), test_key.length());
+        rocksdb::WriteBatch batch;
+        batch.Put(rocksdb::SliceParts(&skey, 1), sparts);
+        ASSERT_TRUE(_server->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+        ASSERT_TRUE(_server->_db->Flush(rocksdb::FlushOptions()).ok());
+
+        // blocks are inserted into the persistent cache asynchronously once read from the sst
+        // file, so read until the block is served from the persistent cache, the block cache is
+        // cleared before each read to pass the read through to the persistent cache
+        uint64_t hit_count = 0;
+        for (int i = 0; i < 100 && hit_count == 0; ++i) {
+            _server->_block_cache->EraseUnRefEntries();
+            ::dsn::rpc_replier<::dsn::apps::read_response> reply(nullptr);
+            _server->on_get(test_key, reply);
+            hit_count = _server->_statistics->getTickerCount(rocksdb::PERSISTENT_CACHE_HIT);
+            if (hit_count == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+        ASSERT_LT(0, hit_count);
+        ASSERT_LT(0, _server->_statistics->getTickerCount(rocksdb::PERSISTENT_CACHE_MISS));
+    }
+
+    void test_time_series_scenario()
+    {
+        std::map<std::string, std::string> envs;
+        envs[ROCKSDB_ENV_USAGE_SCENARIO_KEY] = ROCKSDB_ENV_USAGE_SCENARIO_TIME_SERIES;
+        // the compaction style takes effect after reopened
+        _server->update_app_envs(envs);
+        ASSERT_EQ(rocksdb::kCompactionStyleLevel, _server->_data_cf_opts.compaction_style);
+        _server->stop(false);
+        _server = dsn::make_unique<pegasus_server_impl>(_replica);
+        ASSERT_EQ(dsn::ERR_OK, start(envs));
+        ASSERT_EQ(rocksdb::kCompactionStyleFIFO, _server->_data_cf_opts.compaction_style);
+
+        // the older file expires first
+        uint32_t now = utils::epoch_now();
+        uint32_t expire_ts[] = {now + 2, now + 100};
+        pegasus_value_generator gen;
+        for (uint32_t ts : expire_ts) {
+            dsn::blob key;
+            pegasus_generate_key(key, std::string("hash_key"), std::to_string(ts));
+            rocksdb::SliceParts sparts =
+                gen.generate_value(_server->_pegasus_data_version, "value", ts, 0);
+            rocksdb::Slice skey(key.data(), key.length());
+            rocksdb::WriteBatch batch;
+            batch.Put(rocksdb::SliceParts(&skey, 1), sparts);
+            ASSERT_TRUE(_server->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+            ASSERT_TRUE(_server->_db->Flush(rocksdb::FlushOptions()).ok());
+        }
+        std::vector<rocksdb::LiveFileMetaData> files;
+        _server->_db->GetLiveFilesMetaData(&files);
+        ASSERT_EQ(2, files.size());
+
+        std::this_thread::sleep_for(std::chrono::seconds(3));
+        _server->drop_expired_sst_files();
+        files.clear();
+        _server->_db->GetLiveFilesMetaData(&files);
+        ASSERT_EQ(1, files.size());
+        ASSERT_EQ(0, files[0].level);
+    }
+
+    void test_compaction_style_fallback()
+    {
+        // move a file out of level 0 by level compaction
+        dsn::blob key;
+        pegasus_generate_key(key, std::string("hash_key"), std::string("sort_key"));
+        pegasus_value_generator gen;
+        rocksdb::SliceParts sparts =
+            gen.generate_value(_server->_pegasus_data_version, "value", 0, 0);
+        rocksdb::Slice skey(key.data(), key.length());
+        rocksdb::WriteBatch batch;
+        batch.Put(rocksdb::SliceParts(&skey, 1), sparts);
+        ASSERT_TRUE(_server->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+        ASSERT_TRUE(_server->_db->Flush(rocksdb::FlushOptions()).ok());
+        ASSERT_TRUE(
+            _server->_db->CompactRange(rocksdb::CompactRangeOptions(), nullptr, nullptr).ok());
+
+        // FIFO compaction can not open the db, fall back to level compaction
+        std::map<std::string, std::string> envs;
+        envs[ROCKSDB_ENV_USAGE_SCENARIO_KEY] = ROCKSDB_ENV_USAGE_SCENARIO_TIME_SERIES;
+        int64_t fallback_count = _server->_pfc_compaction_style_fallback_count->get_integer_value();
+        _server->stop(false);
+        _server = dsn::make_unique<pegasus_server_impl>(_replica);
+        ASSERT_EQ(dsn::ERR_OK, start(envs));
+        ASSERT_EQ(rocksdb::kCompactionStyleLevel, _server->_data_cf_opts.compaction_style);
+        ASSERT_EQ(fallback_count + 1,
+                  _server->_pfc_compaction_style_fallback_count->get_integer_value());
+
+        // the scenario in effect is reported instead of the one failed
+        _server->update_app_envs(envs);
+        std::map<std::string, std::string> query_envs;
+        _server->query_app_envs(query_envs);
+        ASSERT_EQ(ROCKSDB_ENV_USAGE_SCENARIO_NORMAL, query_envs[ROCKSDB_ENV_USAGE_SCENARIO_KEY]);
+    }
+
+    void test_bulk_ingest()
+    {
+        const std::string dir = "./bulk_ingest_test";
+        dsn::utils::filesystem::remove_path(dir);
+        ASSERT_TRUE(dsn::utils::filesystem::create_directory(dir));
+
+        // the partition index of the test replica is 1
+        const int32_t partition_count = 2;
+        pegasus_sst_builder builder(dir, partition_count, _server->_pegasus_data_version, 1024);
+        std::vector<std::string> hash_keys;
+        for (int i = 0; i < 100; ++i) {
+            std::string hash_key = "hash_key_" + std::to_string(i);
+            // flush the buffer several times, and override the values of earlier files
+            ASSERT_TRUE(builder.add(hash_key, "sort_key", "old_value", 0).ok());
+            ASSERT_TRUE(builder.add(hash_key, "sort_key", "value_" + hash_key, 0).ok());
+            hash_keys.push_back(hash_key);
+        }
+        ASSERT_TRUE(builder.finish().ok());
+        ASSERT_LT(2 * partition_count, builder.file_count());
+
+        // the partition count of the table is unknown or mismatched
+        ASSERT_TRUE(_server->check_bulk_ingest(dir).IsInvalidArgument());
+        _server->set_partition_version(2 * partition_count - 1);
+        ASSERT_TRUE(_server->check_bulk_ingest(dir).IsInvalidArgument());
+        _server->set_partition_version(partition_count - 1);
+        ASSERT_TRUE(_server->check_bulk_ingest(dir).ok());
+
+        // ingested records are not counted by the sortkey_count meta records
+        _server->_sortkey_count_maintained.store(true);
+        ASSERT_TRUE(_server->check_bulk_ingest(dir).IsNotSupported());
+        ASSERT_TRUE(_server->ingest_sst_files(dir).IsNotSupported());
+        _server->_sortkey_count_maintained.store(false);
+
+        // a record written before the ingestion is overridden, even if it is not flushed
+        for (const std::string &hash_key : hash_keys) {
+            dsn::blob key;
+            pegasus_generate_key(key, hash_key, std::string("sort_key"));
+            if (pegasus_key_hash(key) % partition_count != 1) {
+                continue;
+            }
+            pegasus_value_generator gen;
+            rocksdb::SliceParts sparts =
+                gen.generate_value(_server->_pegasus_data_version, "written_value", 0, 0);
+            rocksdb::Slice skey(key.data(), key.length());
+            rocksdb::WriteBatch batch;
+            batch.Put(rocksdb::SliceParts(&skey, 1), sparts);
+            ASSERT_TRUE(_server->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+            break;
+        }
+
+        // the ingestion is applied as a write
+        const int64_t decree = 1;
+        RPC_MOCKING(bulk_ingest_rpc)
+        {
+            dsn::apps::bulk_ingest_request request;
+            request.dir = dir;
+            dsn::message_ex *write = create_bulk_ingest_request(request);
+            ASSERT_EQ(0, _server->on_batched_write_requests(decree, 0, &write, 1));
+            ASSERT_EQ(1, bulk_ingest_rpc::mail_box().size());
+            ASSERT_EQ(rocksdb::Status::kOk, bulk_ingest_rpc::mail_box()[0].response().error);
+            ASSERT_EQ(decree, bulk_ingest_rpc::mail_box()[0].response().decree);
+        }
+        std::vector<rocksdb::LiveFileMetaData> files;
+        _server->_db->GetLiveFilesMetaData(&files);
+        size_t file_count = files.size();
+        ASSERT_LT(0, file_count);
+
+        for (const std::string &hash_key : hash_keys) {
+            dsn::blob key;
+            pegasus_generate_key(key, hash_key, std::string("sort_key"));
+            std::string value;
+            rocksdb::Status status = _server->_db->Get(
+                rocksdb::ReadOptions(), rocksdb::Slice(key.data(), key.length()), &value);
+            if (pegasus_key_hash(key) % partition_count != 1) {
+                ASSERT_TRUE(status.IsNotFound());
+                continue;
+            }
+            ASSERT_TRUE(status.ok());
+            dsn::blob user_data;
+            pegasus_extract_user_data(_server->_pegasus_data_version, std::move(value), user_data);
+            ASSERT_EQ("value_" + hash_key, user_data.to_string());
+        }
+
+        // the same build is ingested only once, even if BULK_INGEST is resent
+        ASSERT_TRUE(_server->ingest_sst_files(dir).ok());
+        files.clear();
+        _server->_db->GetLiveFilesMetaData(&files);
+        ASSERT_EQ(file_count, files.size());
+
+        dsn::utils::filesystem::remove_path(dir);
+    }
+
+    void test_validate_partition_hash()
+    {
+        _server->_validate_partition_hash = true;
+        _server->_key_ttl_compaction_filter_factory->EnablePartitionHashValidation();
+
+        pegasus_value_generator gen;
+        std::vector<dsn::blob> keys;
+        for (int i = 0; i < 100; ++i) {
+            dsn::blob key;
+            pegasus_generate_key(key, "hash_key_" + std::to_string(i), std::string("sort_key"));
+            rocksdb::SliceParts sparts =
+                gen.generate_value(_server->_pegasus_data_version, "value", 0, 0);
+            rocksdb::Slice skey(key.data(), key.length());
+            rocksdb::WriteBatch batch;
+            batch.Put(rocksdb::SliceParts(&skey, 1), sparts);
+            ASSERT_TRUE(_server->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+            keys.push_back(key);
+        }
+        // the records whose keys are not user keys: the empty record written by empty_put(),
+        // a reserved record and a record whose key is shorter than its hash key length
+        std::vector<std::string> other_keys = {
+            std::string(), std::string("\xFF\xFFs", 3), std::string("\x00\x08hash", 6)};
+        for (const std::string &key : other_keys) {
+            rocksdb::SliceParts sparts =
+                gen.generate_value(_server->_pegasus_data_version, "", 0, 0);
+            rocksdb::Slice skey(key);
+            rocksdb::WriteBatch batch;
+            batch.Put(rocksdb::SliceParts(&skey, 1), sparts);
+            ASSERT_TRUE(_server->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+        }
+        ASSERT_TRUE(_server->_db->Flush(rocksdb::FlushOptions()).ok());
+
+        // nothing is validated before the partition version is set
+        for (const dsn::blob &key : keys) {
+            ASSERT_TRUE(_server->check_key_hash(key));
+        }
+
+        // the partition index of the test replica is 1, and the partition is being split
+        _server->set_partition_version(-1);
+        for (const dsn::blob &key : keys) {
+            ASSERT_TRUE(_server->check_key_hash(key));
+        }
+        // nothing is dropped if the partition version is invalid
+        ASSERT_TRUE(
+            _server->_db->CompactRange(rocksdb::CompactRangeOptions(), nullptr, nullptr).ok());
+        std::string value;
+        for (const dsn::blob &key : keys) {
+            rocksdb::Slice skey(key.data(), key.length());
+            ASSERT_TRUE(_server->_db->Get(rocksdb::ReadOptions(), skey, &value).ok());
+        }
+
+        // split into 2 partitions, the records of partition 0 are dropped by compaction
+        _server->set_partition_version(1);
+        ASSERT_TRUE(
+            _server->_db->CompactRange(rocksdb::CompactRangeOptions(), nullptr, nullptr).ok());
+        for (const dsn::blob &key : keys) {
+            bool owned = pegasus_key_hash(key) % 2 == 1;
+            ASSERT_EQ(owned, _server->check_key_hash(key));
+            rocksdb::Slice skey(key.data(), key.length());
+            rocksdb::Status status = _server->_db->Get(rocksdb::ReadOptions(), skey, &value);
+            ASSERT_EQ(owned, status.ok());
+        }
+        // the records of other keys are kept without being hashed
+        for (const std::string &key : other_keys) {
+            ASSERT_TRUE(_server->_db->Get(rocksdb::ReadOptions(), key, &value).ok());
+        }
+    }
 };
 
 TEST_F(pegasus_server_impl_test, test_table_level_slow_query) { test_table_level_slow_query(); }
 
+TEST_F(pegasus_server_impl_test, test_slow_query_perf_breakdown)
+{
+    test_slow_query_perf_breakdown();
+}
+
+TEST_F(pegasus_server_impl_test, test_value_filter) { test_value_filter(); }
+
+TEST_F(pegasus_server_impl_test, test_scan_batch_limit) { test_scan_batch_limit(); }
+
+TEST_F(pegasus_server_impl_test, test_request_deadline) { test_request_deadline(); }
+
+TEST_F(pegasus_server_impl_test, test_secondary_read) { test_secondary_read(); }
+
+TEST_F(pegasus_server_impl_test, test_drop_expired_sst) { test_drop_expired_sst(); }
+
+TEST_F(pegasus_server_impl_test, test_update_block_cache) { test_update_block_cache(); }
+
+TEST_F(pegasus_server_impl_test, test_time_series_scenario) { test_time_series_scenario(); }
+
+TEST_F(pegasus_server_impl_test, test_compaction_style_fallback)
+{
+    test_compaction_style_fallback();
+}
+
+TEST_F(pegasus_server_impl_test, test_persistent_cache) { test_persistent_cache(); }
+
+TEST_F(pegasus_server_impl_test, test_bulk_ingest) { test_bulk_ingest(); }
+
+TEST_F(pegasus_server_impl_test, test_validate_partition_hash) { test_validate_partition_hash(); }
+
 TEST_F(pegasus_server_impl_test, default_data_version)
 {
     ASSERT_EQ(_server->_pegasus_data_version, 1);
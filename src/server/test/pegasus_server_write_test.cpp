@@ -89,6 +89,149 @@ public:
         dsn::fail::teardown();
     }
 
+    void test_batch_multi_writes_and_incr()
+    {
+        const int64_t decree = 1;
+        RPC_MOCKING(multi_put_rpc) RPC_MOCKING(multi_remove_rpc) RPC_MOCKING(incr_rpc)
+        {
+            std::string hash_key = "hash";
+            std::string counter_sort_key = "counter";
+            std::string other_sort_key = "other";
+            std::string init_value = "10";
+
+            dsn::apps::multi_put_request multi_put;
+            multi_put.hash_key.assign(hash_key.data(), 0, hash_key.size());
+            multi_put.kvs.resize(2);
+            multi_put.kvs[0].key.assign(counter_sort_key.data(), 0, counter_sort_key.size());
+            multi_put.kvs[0].value.assign(init_value.data(), 0, init_value.size());
+            multi_put.kvs[1].key.assign(other_sort_key.data(), 0, other_sort_key.size());
+            multi_put.kvs[1].value.assign(init_value.data(), 0, init_value.size());
+
+            dsn::apps::multi_remove_request multi_remove;
+            multi_remove.hash_key = multi_put.hash_key;
+            multi_remove.sort_keys.push_back(multi_put.kvs[1].key);
+
+            dsn::apps::incr_request incr;
+            pegasus_generate_key(incr.key, hash_key, counter_sort_key);
+            incr.increment = 5;
+
+            // the invalid request fails alone
+            dsn::apps::multi_put_request invalid_multi_put;
+            invalid_multi_put.hash_key = multi_put.hash_key;
+
+            const int total_rpc_cnt = 5;
+            auto writes = new dsn::message_ex *[total_rpc_cnt];
+            writes[0] = pegasus::create_multi_put_request(multi_put);
+            writes[1] = pegasus::create_incr_request(incr);
+            writes[2] = pegasus::create_multi_remove_request(multi_remove);
+            writes[3] = pegasus::create_incr_request(incr);
+            writes[4] = pegasus::create_multi_put_request(invalid_multi_put);
+            auto cleanup = dsn::defer([=]() { delete[] writes; });
+
+            ASSERT_EQ(0,
+                      _server_write->on_batched_write_requests(writes, total_rpc_cnt, decree, 0));
+            ASSERT_TRUE(_server_write->_multi_put_rpc_batch.empty());
+            ASSERT_TRUE(_server_write->_multi_remove_rpc_batch.empty());
+            ASSERT_TRUE(_server_write->_incr_rpc_batch.empty());
+            ASSERT_EQ(_server_write->_write_svc->_impl->_batch.Count(), 0);
+
+            ASSERT_EQ(2, multi_put_rpc::mail_box().size());
+            verify_response(multi_put_rpc::mail_box()[0].response(), 0, decree);
+            ASSERT_EQ(rocksdb::Status::kInvalidArgument,
+                      multi_put_rpc::mail_box()[1].response().error);
+
+            ASSERT_EQ(1, multi_remove_rpc::mail_box().size());
+            ASSERT_EQ(0, multi_remove_rpc::mail_box()[0].response().error);
+            ASSERT_EQ(1, multi_remove_rpc::mail_box()[0].response().count);
+
+            // the preceding writes of the batch are visible to incr
+            ASSERT_EQ(2, incr_rpc::mail_box().size());
+            ASSERT_EQ(0, incr_rpc::mail_box()[0].response().error);
+            ASSERT_EQ(15, incr_rpc::mail_box()[0].response().new_value);
+            ASSERT_EQ(0, incr_rpc::mail_box()[1].response().error);
+            ASSERT_EQ(20, incr_rpc::mail_box()[1].response().new_value);
+
+            std::string value;
+            rocksdb::Slice skey(incr.key.data(), incr.key.length());
+            ASSERT_TRUE(_server->_db->Get(rocksdb::ReadOptions(), skey, &value).ok());
+            dsn::blob user_data;
+            pegasus_extract_user_data(_server->_pegasus_data_version, std::move(value), user_data);
+            ASSERT_EQ("20", user_data.to_string());
+
+            dsn::blob other_key;
+            pegasus_generate_key(other_key, hash_key, other_sort_key);
+            skey = rocksdb::Slice(other_key.data(), other_key.length());
+            ASSERT_TRUE(_server->_db->Get(rocksdb::ReadOptions(), skey, &value).IsNotFound());
+        }
+    }
+
+    void test_batch_multi_incr()
+    {
+        const int64_t decree = 1;
+        RPC_MOCKING(incr_rpc) RPC_MOCKING(multi_incr_rpc)
+        {
+            std::string hash_key = "hash";
+            std::string counter_sort_key = "counter";
+            std::string other_sort_key = "other";
+
+            dsn::apps::incr_request incr;
+            pegasus_generate_key(incr.key, hash_key, counter_sort_key);
+            incr.increment = 5;
+
+            // the same sort key appears twice
+            dsn::apps::multi_incr_request multi_incr;
+            multi_incr.hash_key.assign(hash_key.data(), 0, hash_key.size());
+            multi_incr.items.resize(3);
+            multi_incr.items[0].sort_key.assign(
+                counter_sort_key.data(), 0, counter_sort_key.size());
+            multi_incr.items[0].increment = 1;
+            multi_incr.items[1].sort_key.assign(other_sort_key.data(), 0, other_sort_key.size());
+            multi_incr.items[1].increment = 2;
+            multi_incr.items[2].sort_key = multi_incr.items[0].sort_key;
+            multi_incr.items[2].increment = 3;
+
+            // the second item is out of range, so the first one is not applied either
+            dsn::apps::multi_incr_request invalid_multi_incr;
+            invalid_multi_incr.hash_key = multi_incr.hash_key;
+            invalid_multi_incr.items.resize(2);
+            invalid_multi_incr.items[0].sort_key = multi_incr.items[0].sort_key;
+            invalid_multi_incr.items[0].increment = 1;
+            invalid_multi_incr.items[1].sort_key = multi_incr.items[1].sort_key;
+            invalid_multi_incr.items[1].increment = INT64_MAX;
+
+            const int total_rpc_cnt = 3;
+            auto writes = new dsn::message_ex *[total_rpc_cnt];
+            writes[0] = pegasus::create_incr_request(incr);
+            writes[1] = pegasus::create_multi_incr_request(multi_incr);
+            writes[2] = pegasus::create_multi_incr_request(invalid_multi_incr);
+            auto cleanup = dsn::defer([=]() { delete[] writes; });
+
+            ASSERT_EQ(0,
+                      _server_write->on_batched_write_requests(writes, total_rpc_cnt, decree, 0));
+            ASSERT_TRUE(_server_write->_multi_incr_rpc_batch.empty());
+            ASSERT_EQ(_server_write->_write_svc->_impl->_batch.Count(), 0);
+
+            ASSERT_EQ(1, incr_rpc::mail_box().size());
+            ASSERT_EQ(5, incr_rpc::mail_box()[0].response().new_value);
+
+            ASSERT_EQ(2, multi_incr_rpc::mail_box().size());
+            const dsn::apps::multi_incr_response &resp = multi_incr_rpc::mail_box()[0].response();
+            ASSERT_EQ(0, resp.error);
+            ASSERT_EQ(decree, resp.decree);
+            ASSERT_EQ(std::vector<int64_t>({6, 2, 9}), resp.new_values);
+            ASSERT_EQ(rocksdb::Status::kInvalidArgument,
+                      multi_incr_rpc::mail_box()[1].response().error);
+            ASSERT_TRUE(multi_incr_rpc::mail_box()[1].response().new_values.empty());
+
+            std::string value;
+            rocksdb::Slice skey(incr.key.data(), incr.key.length());
+            ASSERT_TRUE(_server->_db->Get(rocksdb::ReadOptions(), skey, &value).ok());
+            dsn::blob user_data;
+            pegasus_extract_user_data(_server->_pegasus_data_version, std::move(value), user_data);
+            ASSERT_EQ("9", user_data.to_string());
+        }
+    }
+
     void verify_response(const dsn::apps::update_response &response, int err, int64_t decree)
     {
         ASSERT_EQ(response.error, err);
@@ -101,5 +244,12 @@ public:
 
 TEST_F(pegasus_server_write_test, batch_writes) { test_batch_writes(); }
 
+TEST_F(pegasus_server_write_test, batch_multi_writes_and_incr)
+{
+    test_batch_multi_writes_and_incr();
+}
+
+TEST_F(pegasus_server_write_test, batch_multi_incr) { test_batch_multi_incr(); }
+
 } // namespace server
 } // namespace pegasus
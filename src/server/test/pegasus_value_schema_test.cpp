@@ -44,6 +44,17 @@ TEST(value_schema, generate_and_extract_v1_v0)
             ASSERT_EQ(t.timetag, pegasus_extract_timetag(t.value_schema_version, raw_value));
         }
 
+        dsn::string_view user_data_view =
+            pegasus_extract_user_data_view(t.value_schema_version, raw_value);
+        ASSERT_EQ(t.user_data, std::string(user_data_view.data(), user_data_view.length()));
+
+        auto pinned_value = dsn::make_unique<rocksdb::PinnableSlice>();
+        pinned_value->PinSelf(raw_value);
+        dsn::blob pinned_user_data;
+        pegasus_extract_user_data(
+            t.value_schema_version, std::move(pinned_value), pinned_user_data);
+        ASSERT_EQ(t.user_data, pinned_user_data.to_string());
+
         dsn::blob user_data;
         pegasus_extract_user_data(t.value_schema_version, std::move(raw_value), user_data);
         ASSERT_EQ(t.user_data, user_data.to_string());
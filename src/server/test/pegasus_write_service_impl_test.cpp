@@ -37,6 +37,66 @@ public:
         return extract_timestamp_from_timetag(local_timetag);
     }
 
+    sortkey_count_meta read_sortkey_count_meta(dsn::string_view hash_key)
+    {
+        std::string meta_key, meta_value;
+        sortkey_count_meta::generate_key(hash_key, meta_key);
+        sortkey_count_meta meta;
+        rocksdb::Status s = _write_impl->_db->Get(_write_impl->_rd_opts, meta_key, &meta_value);
+        if (s.ok()) {
+            EXPECT_TRUE(meta.decode(meta_value));
+        } else {
+            EXPECT_TRUE(s.IsNotFound());
+            meta.count = -1;
+        }
+        return meta;
+    }
+
+    int maintain_sortkey_count(int64_t decree, bool maintained)
+    {
+        dsn::apps::maintain_sortkey_count_request req;
+        req.maintained = maintained;
+        dsn::apps::update_response resp;
+        int err = _write_impl->maintain_sortkey_count(decree, req, resp);
+        EXPECT_EQ(err, resp.error);
+        EXPECT_EQ(decree, resp.decree);
+        return err;
+    }
+
+    int write_one(int64_t decree, dsn::string_view sort_key, uint32_t expire_ts, bool remove)
+    {
+        dsn::blob raw_key;
+        pegasus::pegasus_generate_key(raw_key, dsn::string_view("hash_key"), sort_key);
+        int err;
+        if (remove) {
+            err = _write_impl->db_write_batch_delete(decree, raw_key);
+        } else {
+            auto ctx = db_write_context::create(decree, 0);
+            err = _write_impl->db_write_batch_put_ctx(ctx, raw_key, "value", expire_ts);
+        }
+        if (err == 0) {
+            err = _write_impl->db_write(decree);
+        }
+        _write_impl->clear_up_batch_states(decree, err);
+        return err;
+    }
+
+    // read the user data and expire_ts of `raw_key`, return false if not found.
+    bool read_value(const dsn::blob &raw_key, std::string &value, uint32_t &expire_ts)
+    {
+        std::string raw_value;
+        rocksdb::Status s = _write_impl->_db->Get(
+            _write_impl->_rd_opts, utils::to_rocksdb_slice(raw_key), &raw_value);
+        if (!s.ok()) {
+            EXPECT_TRUE(s.IsNotFound());
+            return false;
+        }
+        expire_ts = pegasus_extract_expire_ts(_write_impl->_pegasus_data_version, raw_value);
+        value = pegasus_extract_user_data_view(_write_impl->_pegasus_data_version, raw_value)
+                    .to_string();
+        return true;
+    }
+
     // start with duplicating.
     void set_app_duplicating()
     {
@@ -140,5 +200,204 @@ TEST_F(pegasus_write_service_impl_test, verify_timetag_compatible_with_version_0
     dsn::fail::teardown();
 }
 
+TEST_F(pegasus_write_service_impl_test, maintain_sortkey_count_meta)
+{
+    uint32_t expire_ts = utils::epoch_now() + 1000;
+
+    // written before the metadata is maintained
+    ASSERT_EQ(0, write_one(1, "s1", 0, false));
+    ASSERT_EQ(0, write_one(2, "s2", expire_ts, false));
+    ASSERT_EQ(-1, read_sortkey_count_meta("hash_key").count);
+
+    ASSERT_EQ(0, maintain_sortkey_count(3, true));
+    ASSERT_TRUE(_server->_sortkey_count_maintained);
+    ASSERT_EQ(1, _server->_sortkey_count_generation);
+
+    // the first write does not count the existing records, which are recounted in background
+    // and written by the next write
+    ASSERT_EQ(0, write_one(4, "s3", 0, false));
+    ASSERT_EQ(-1, read_sortkey_count_meta("hash_key").count);
+    _server->_tracker.wait_outstanding_tasks();
+    ASSERT_EQ(0, write_one(5, "s2", 0, false));
+    sortkey_count_meta meta = read_sortkey_count_meta("hash_key");
+    ASSERT_EQ(3, meta.count);
+    ASSERT_EQ(expire_ts, meta.min_expire_ts);
+    ASSERT_EQ(1, meta.generation);
+
+    // remove an existing and a nonexistent record
+    ASSERT_EQ(0, write_one(6, "s1", 0, true));
+    ASSERT_EQ(0, write_one(7, "s4", 0, true));
+    ASSERT_EQ(2, read_sortkey_count_meta("hash_key").count);
+
+    // records written in the same batch
+    auto ctx = db_write_context::create(8, 0);
+    dsn::blob raw_key;
+    pegasus::pegasus_generate_key(raw_key, dsn::string_view("hash_key"), dsn::string_view("s5"));
+    ASSERT_EQ(0, _write_impl->db_write_batch_put_ctx(ctx, raw_key, "value", 0));
+    ASSERT_EQ(0, _write_impl->db_write_batch_put_ctx(ctx, raw_key, "value", expire_ts));
+    ASSERT_EQ(0, _write_impl->db_write_batch_delete(8, raw_key));
+    ASSERT_EQ(0, _write_impl->db_write_batch_put_ctx(ctx, raw_key, "value", 0));
+    ASSERT_EQ(0, _write_impl->db_write(8));
+    _write_impl->clear_up_batch_states(8, 0);
+    ASSERT_EQ(3, read_sortkey_count_meta("hash_key").count);
+
+    // the metadata of the former generation is invalid after switching back, and the writes
+    // racing with the recount are counted once
+    ASSERT_EQ(0, maintain_sortkey_count(9, false));
+    ASSERT_FALSE(_server->_sortkey_count_maintained);
+    ASSERT_EQ(0, write_one(10, "s6", 0, false));
+    ASSERT_EQ(1, read_sortkey_count_meta("hash_key").generation);
+    ASSERT_EQ(0, maintain_sortkey_count(11, true));
+    // resent before applied
+    ASSERT_EQ(0, maintain_sortkey_count(12, true));
+    ASSERT_EQ(3, _server->_sortkey_count_generation);
+    ASSERT_EQ(0, write_one(13, "s6", 0, true));
+    ASSERT_EQ(0, write_one(14, "s7", 0, false));
+    _server->_tracker.wait_outstanding_tasks();
+    ASSERT_EQ(0, write_one(15, "s8", 0, true));
+    meta = read_sortkey_count_meta("hash_key");
+    ASSERT_EQ(4, meta.count);
+    ASSERT_EQ(0, meta.min_expire_ts);
+    ASSERT_EQ(3, meta.generation);
+
+    // the metadata is recounted once any counted record may have expired
+    meta.count = 100;
+    meta.min_expire_ts = 1;
+    std::string meta_key, encoded;
+    sortkey_count_meta::generate_key("hash_key", meta_key);
+    meta.encode(encoded);
+    rocksdb::SliceParts svalue = _write_impl->_value_generator.generate_value(
+        _write_impl->_pegasus_data_version, encoded, 0, 0);
+    rocksdb::Slice skey(meta_key);
+    rocksdb::WriteBatch batch;
+    batch.Put(rocksdb::SliceParts(&skey, 1), svalue);
+    ASSERT_TRUE(_write_impl->_db->Write(rocksdb::WriteOptions(), &batch).ok());
+    ASSERT_EQ(0, write_one(16, "s9", expire_ts, false));
+    _server->_tracker.wait_outstanding_tasks();
+    ASSERT_EQ(0, write_one(17, "s10", 0, true));
+    meta = read_sortkey_count_meta("hash_key");
+    ASSERT_EQ(5, meta.count);
+    ASSERT_EQ(expire_ts, meta.min_expire_ts);
+
+    // the state is restored when reopened
+    _server->stop(false);
+    _server = dsn::make_unique<pegasus_server_impl>(_replica);
+    ASSERT_EQ(dsn::ERR_OK, start());
+    ASSERT_TRUE(_server->_sortkey_count_maintained);
+    ASSERT_EQ(3, _server->_sortkey_count_generation);
+
+    // default ttl makes the metadata inexact
+    std::map<std::string, std::string> envs;
+    envs[SORTKEY_COUNT_MODE_KEY] = SORTKEY_COUNT_MODE_META;
+    _server->update_sortkey_count_mode(envs);
+    ASSERT_TRUE(_server->_sortkey_count_by_meta);
+    envs[TABLE_LEVEL_DEFAULT_TTL] = "100";
+    _server->update_sortkey_count_mode(envs);
+    ASSERT_FALSE(_server->_sortkey_count_by_meta);
+}
+
+TEST_F(pegasus_write_service_impl_test, blind_incr)
+{
+    dsn::apps::incr_request req;
+    pegasus::pegasus_generate_key(req.key, std::string("hash_key"), std::string("counter"));
+    req.increment = 5;
+    req.__set_blind(true);
+    dsn::apps::incr_response resp;
+    ASSERT_EQ(0, _write_impl->incr(db_write_context::create(1, dsn_now_us()), req, resp));
+    ASSERT_EQ(0, resp.error);
+    ASSERT_EQ(0, resp.new_value);
+    uint32_t expire_ts = utils::epoch_now() + 1000;
+    req.expire_ts_seconds = expire_ts;
+    ASSERT_EQ(0, _write_impl->incr(db_write_context::create(2, dsn_now_us()), req, resp));
+
+    std::string value;
+    uint32_t value_expire_ts = 0;
+    ASSERT_TRUE(read_value(req.key, value, value_expire_ts));
+    ASSERT_EQ("10", value);
+    ASSERT_EQ(expire_ts, value_expire_ts);
+
+    // the operands are folded by compaction
+    ASSERT_TRUE(_write_impl->_db->Flush(rocksdb::FlushOptions()).ok());
+    ASSERT_TRUE(
+        _write_impl->_db->CompactRange(rocksdb::CompactRangeOptions(), nullptr, nullptr).ok());
+    ASSERT_TRUE(read_value(req.key, value, value_expire_ts));
+    ASSERT_EQ("10", value);
+
+    // the normal incr in the same batch sees the blind incr
+    req.expire_ts_seconds = 0;
+    dsn::apps::incr_response resps[2];
+    auto ctx = db_write_context::create(3, dsn_now_us());
+    ASSERT_EQ(0, _write_impl->batch_incr(ctx, req, resps[0]));
+    req.__set_blind(false);
+    ASSERT_EQ(0, _write_impl->batch_incr(ctx, req, resps[1]));
+    ASSERT_EQ(0, _write_impl->batch_commit(3));
+    ASSERT_EQ(0, resps[0].new_value);
+    ASSERT_EQ(20, resps[1].new_value);
+    ASSERT_TRUE(read_value(req.key, value, value_expire_ts));
+    ASSERT_EQ("20", value);
+    ASSERT_EQ(expire_ts, value_expire_ts);
+
+    // the increment is ignored if the old value is not an integer
+    req.__set_blind(true);
+    ASSERT_EQ(0, _write_impl->db_write_batch_put(4, req.key, "abc", 0));
+    ASSERT_EQ(0, _write_impl->db_write(4));
+    _write_impl->clear_up_batch_states(4, 0);
+    ASSERT_EQ(0, _write_impl->incr(db_write_context::create(5, dsn_now_us()), req, resp));
+    ASSERT_TRUE(read_value(req.key, value, value_expire_ts));
+    ASSERT_EQ("abc", value);
+}
+
+// The expiration of the old value is judged at the write time of the operands, so the result
+// does not depend on when the operands are merged.
+TEST_F(pegasus_write_service_impl_test, blind_incr_merge_expiration)
+{
+    const uint32_t version = _write_impl->_pegasus_data_version;
+    const uint32_t expire_ts = 10000;
+    auto make_operand = [version](int64_t increment, uint32_t write_epoch) {
+        incr_operand op;
+        op.data_version = version;
+        op.timetag = generate_timetag(
+            static_cast<uint64_t>(utils::epoch_begin + write_epoch) * 1000000, 1, false);
+        op.increment = increment;
+        std::string operand;
+        op.encode(operand);
+        return operand;
+    };
+
+    pegasus_value_generator gen;
+    rocksdb::SliceParts sparts = gen.generate_value(version, "7", expire_ts, 0);
+    std::string base;
+    for (int i = 0; i < sparts.num_parts; ++i) {
+        base.append(sparts.parts[i].data(), sparts.parts[i].size());
+    }
+    rocksdb::Slice base_slice(base);
+
+    // written before the old value expires
+    std::string before = make_operand(1, expire_ts - 10);
+    // written after the old value expires
+    std::string after = make_operand(2, expire_ts + 10);
+
+    std::string result;
+    ASSERT_TRUE(incr_operand::merge(&base_slice, {before}, result));
+    ASSERT_EQ("8", pegasus_extract_user_data_view(version, result).to_string());
+    ASSERT_EQ(expire_ts, pegasus_extract_expire_ts(version, result));
+
+    ASSERT_TRUE(incr_operand::merge(&base_slice, {before, after}, result));
+    ASSERT_EQ("2", pegasus_extract_user_data_view(version, result).to_string());
+    ASSERT_EQ(0, pegasus_extract_expire_ts(version, result));
+
+    // a non-integer value is kept until it expires
+    sparts = gen.generate_value(version, "abc", expire_ts, 0);
+    base.clear();
+    for (int i = 0; i < sparts.num_parts; ++i) {
+        base.append(sparts.parts[i].data(), sparts.parts[i].size());
+    }
+    base_slice = rocksdb::Slice(base);
+    ASSERT_TRUE(incr_operand::merge(&base_slice, {before}, result));
+    ASSERT_EQ(base, result);
+    ASSERT_TRUE(incr_operand::merge(&base_slice, {before, after}, result));
+    ASSERT_EQ("2", pegasus_extract_user_data_view(version, result).to_string());
+}
+
 } // namespace server
 } // namespace pegasus
@@ -272,6 +272,84 @@ TEST_F(pegasus_write_service_test, duplicate_batched)
     }
 }
 
+TEST_F(pegasus_write_service_test, duplicate_entries)
+{
+    std::string hash_key = "hash_key";
+    std::string sort_key[3] = {"sort_key_0", "sort_key_1", "sort_key_2"};
+    std::string value = "value";
+
+    dsn::blob raw_key[3];
+    for (int i = 0; i < 3; i++) {
+        pegasus::pegasus_generate_key(raw_key[i], hash_key, sort_key[i]);
+    }
+    auto add_entry = [](dsn::apps::duplicate_request &duplicate,
+                        dsn::task_code code,
+                        dsn::message_ex *msg) {
+        dsn::message_ptr msg_ptr = msg; // auto release memory
+        dsn::apps::duplicate_entry entry;
+        entry.__set_timestamp(1000 + duplicate.entries.size());
+        entry.__set_task_code(code);
+        entry.__set_raw_message(dsn::move_message_to_blob(msg_ptr.get()));
+        duplicate.entries.emplace_back(std::move(entry));
+    };
+
+    // put sort_key_0 and sort_key_1, remove sort_key_0, then multi_put sort_key_2
+    dsn::apps::duplicate_request duplicate;
+    duplicate.cluster_id = 2;
+    duplicate.__isset.entries = true;
+    for (int i = 0; i < 2; i++) {
+        dsn::apps::update_request request;
+        request.key = raw_key[i];
+        request.value.assign(value.data(), 0, value.size());
+        add_entry(duplicate, dsn::apps::RPC_RRDB_RRDB_PUT, pegasus::create_put_request(request));
+    }
+    add_entry(duplicate,
+              dsn::apps::RPC_RRDB_RRDB_REMOVE,
+              pegasus::create_remove_request(raw_key[0]));
+    {
+        dsn::apps::multi_put_request mput;
+        mput.hash_key.assign(hash_key.data(), 0, hash_key.size());
+        mput.kvs.emplace_back();
+        mput.kvs.back().key.assign(sort_key[2].data(), 0, sort_key[2].size());
+        mput.kvs.back().value.assign(value.data(), 0, value.size());
+        add_entry(duplicate,
+                  dsn::apps::RPC_RRDB_RRDB_MULTI_PUT,
+                  pegasus::create_multi_put_request(mput));
+    }
+
+    // an unrecognized write rejects the whole request
+    {
+        dsn::apps::duplicate_request illegal = duplicate;
+        dsn::apps::incr_request incr;
+        incr.key = raw_key[0];
+        add_entry(illegal, dsn::apps::RPC_RRDB_RRDB_INCR, pegasus::create_incr_request(incr));
+        dsn::apps::duplicate_response resp;
+        _write_svc->duplicate(1, illegal, resp);
+        ASSERT_EQ(resp.error, rocksdb::Status::kInvalidArgument);
+        std::string raw_value;
+        rocksdb::Slice skey(raw_key[1].data(), raw_key[1].length());
+        ASSERT_TRUE(_server->_db->Get(rocksdb::ReadOptions(), skey, &raw_value).IsNotFound());
+    }
+
+    dsn::apps::duplicate_response resp;
+    _write_svc->duplicate(2, duplicate, resp);
+    ASSERT_EQ(resp.error, 0);
+
+    bool expect_found[3] = {false, true, true};
+    for (int i = 0; i < 3; i++) {
+        std::string raw_value;
+        rocksdb::Slice skey(raw_key[i].data(), raw_key[i].length());
+        rocksdb::Status s = _server->_db->Get(rocksdb::ReadOptions(), skey, &raw_value);
+        ASSERT_EQ(s.ok(), expect_found[i]) << sort_key[i];
+        if (s.ok()) {
+            dsn::blob user_data;
+            pegasus_extract_user_data(
+                _server->_pegasus_data_version, std::move(raw_value), user_data);
+            ASSERT_EQ(value, user_data.to_string());
+        }
+    }
+}
+
 TEST_F(pegasus_write_service_test, illegal_duplicate_request)
 {
     std::string hash_key = "hash_key";
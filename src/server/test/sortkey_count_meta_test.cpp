@@ -0,0 +1,138 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/sortkey_count_meta.h"
+#include "server/key_ttl_compaction_filter.h"
+#include "server/hashkey_transform.h"
+#include "base/pegasus_key_schema.h"
+
+#include <gtest/gtest.h>
+
+namespace pegasus {
+namespace server {
+
+TEST(sortkey_count_meta, key)
+{
+    std::string meta_key;
+    sortkey_count_meta::generate_key("hash_key", meta_key);
+    ASSERT_EQ(std::string("\xFF\xFF"
+                          "chash_key"),
+              meta_key);
+    ASSERT_TRUE(sortkey_count_meta::is_meta_key(meta_key));
+
+    // metadata records are out of the range of any hash key
+    ::dsn::blob key;
+    pegasus_generate_key(key, std::string(UINT16_MAX - 1, 'a'), std::string("sort_key"));
+    ASSERT_FALSE(sortkey_count_meta::is_meta_key(rocksdb::Slice(key.data(), key.length())));
+    ASSERT_LT(rocksdb::Slice(key.data(), key.length()).compare(meta_key), 0);
+
+    // metadata records share the same prefix, which is not a valid hash key
+    HashkeyTransform transform;
+    ASSERT_EQ(rocksdb::Slice("\xFF\xFF"), transform.Transform(meta_key));
+}
+
+TEST(sortkey_count_meta, encode_and_decode)
+{
+    sortkey_count_meta meta;
+    meta.count = 100;
+    meta.min_expire_ts = 1000;
+    meta.generation = 3;
+    std::string buf;
+    meta.encode(buf);
+    ASSERT_EQ(sortkey_count_meta::ENCODED_SIZE, buf.size());
+
+    // decode from the tail of the value
+    std::string value = "header" + buf;
+    sortkey_count_meta decoded;
+    ASSERT_TRUE(decoded.decode(value));
+    ASSERT_EQ(100, decoded.count);
+    ASSERT_EQ(1000, decoded.min_expire_ts);
+    ASSERT_EQ(3, decoded.generation);
+
+    ASSERT_FALSE(decoded.decode(value.substr(value.size() - 1)));
+
+    sortkey_count_state state;
+    state.generation = 5;
+    state.maintained = true;
+    state.encode(buf);
+    ASSERT_EQ(sortkey_count_state::ENCODED_SIZE, buf.size());
+    sortkey_count_state decoded_state;
+    ASSERT_TRUE(decoded_state.decode("header" + buf));
+    ASSERT_EQ(5, decoded_state.generation);
+    ASSERT_TRUE(decoded_state.maintained);
+    ASSERT_FALSE(decoded_state.decode("short"));
+}
+
+TEST(sortkey_count_meta, valid)
+{
+    sortkey_count_meta meta;
+    meta.count = 10;
+    meta.generation = 2;
+    ASSERT_TRUE(meta.valid(2, 1000));
+    ASSERT_FALSE(meta.valid(3, 1000));
+
+    // valid until any counted record may have expired
+    meta.add_expire_ts(2000);
+    meta.add_expire_ts(0);
+    meta.add_expire_ts(3000);
+    ASSERT_EQ(2000, meta.min_expire_ts);
+    ASSERT_TRUE(meta.valid(2, 1000));
+    ASSERT_FALSE(meta.valid(2, 2000));
+
+    sortkey_count_meta delta;
+    delta.count = -3;
+    delta.min_expire_ts = 1500;
+    meta.add(delta);
+    ASSERT_EQ(7, meta.count);
+    ASSERT_EQ(1500, meta.min_expire_ts);
+
+    meta.count = -1;
+    ASSERT_FALSE(meta.valid(2, 1000));
+}
+
+TEST(sortkey_count_meta, compaction_filter)
+{
+    auto make_value = [](int64_t count, uint32_t min_expire_ts, uint64_t generation) {
+        sortkey_count_meta meta;
+        meta.count = count;
+        meta.min_expire_ts = min_expire_ts;
+        meta.generation = generation;
+        std::string buf;
+        meta.encode(buf);
+        return "header" + buf;
+    };
+
+    std::string meta_key;
+    sortkey_count_meta::generate_key("hash_key", meta_key);
+    std::string new_value;
+    bool value_changed = false;
+
+    // the metadata of the current generation is kept, with or without ttl
+    KeyWithTTLCompactionFilter filter(1, 0, true, 0, -1, false, 2);
+    ASSERT_FALSE(filter.Filter(0, meta_key, make_value(10, 0, 2), &new_value, &value_changed));
+    ASSERT_FALSE(filter.Filter(0, meta_key, make_value(10, 1, 2), &new_value, &value_changed));
+    ASSERT_FALSE(value_changed);
+
+    // the metadata of former generations is dropped
+    ASSERT_TRUE(filter.Filter(0, meta_key, make_value(10, 0, 1), &new_value, &value_changed));
+
+    // the metadata counting no record with ttl is invalidated once if default ttl is set
+    KeyWithTTLCompactionFilter default_ttl_filter(1, 100, true, 0, -1, false, 2);
+    ASSERT_FALSE(default_ttl_filter.Filter(
+        0, meta_key, make_value(10, 0, 2), &new_value, &value_changed));
+    ASSERT_TRUE(value_changed);
+    ASSERT_EQ(make_value(10, 1, 2), new_value);
+    value_changed = false;
+    ASSERT_FALSE(default_ttl_filter.Filter(
+        0, meta_key, make_value(10, 1000, 2), &new_value, &value_changed));
+    ASSERT_FALSE(value_changed);
+
+    // the state record is kept
+    ASSERT_FALSE(default_ttl_filter.Filter(
+        0, sortkey_count_state::key(), "header", &new_value, &value_changed));
+    ASSERT_FALSE(value_changed);
+}
+
+} // namespace server
+} // namespace pegasus
@@ -0,0 +1,81 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/ttl_table_properties_collector.h"
+
+#include <gtest/gtest.h>
+
+namespace pegasus {
+namespace server {
+
+static std::string generate_value(uint32_t expire_ts)
+{
+    pegasus_value_generator gen;
+    rocksdb::SliceParts sparts = gen.generate_value(1, "value", expire_ts, 0);
+    std::string raw_value;
+    for (int i = 0; i < sparts.num_parts; i++) {
+        raw_value += sparts.parts[i].ToString();
+    }
+    return raw_value;
+}
+
+static sst_ttl_properties finish(ttl_table_properties_collector &collector)
+{
+    rocksdb::UserCollectedProperties props;
+    EXPECT_TRUE(collector.Finish(&props).ok());
+    sst_ttl_properties ttl_props;
+    EXPECT_TRUE(ttl_props.decode(props));
+    return ttl_props;
+}
+
+TEST(ttl_table_properties_collector, collect)
+{
+    ttl_table_properties_collector collector(1, true);
+    ASSERT_TRUE(collector.AddUserKey("k1", generate_value(100), rocksdb::kEntryPut, 0, 0).ok());
+    ASSERT_TRUE(collector.AddUserKey("k2", generate_value(300), rocksdb::kEntryPut, 0, 0).ok());
+    ASSERT_TRUE(collector.AddUserKey("k3", "", rocksdb::kEntryDelete, 0, 0).ok());
+    ASSERT_TRUE(collector.AddUserKey("k4", generate_value(200), rocksdb::kEntryPut, 0, 0).ok());
+
+    sst_ttl_properties props = finish(collector);
+    ASSERT_EQ(100, props.min_expire_ts);
+    ASSERT_EQ(300, props.max_expire_ts);
+    ASSERT_EQ(0, props.no_ttl_count);
+    ASSERT_TRUE(props.all_with_ttl());
+    ASSERT_FALSE(props.all_expired(299));
+    ASSERT_TRUE(props.all_expired(300));
+}
+
+TEST(ttl_table_properties_collector, no_ttl)
+{
+    ttl_table_properties_collector collector(1, true);
+    ASSERT_TRUE(collector.AddUserKey("k1", generate_value(100), rocksdb::kEntryPut, 0, 0).ok());
+    ASSERT_TRUE(collector.AddUserKey("k2", generate_value(0), rocksdb::kEntryPut, 0, 0).ok());
+    ASSERT_TRUE(collector.AddUserKey("k3", generate_value(100), rocksdb::kEntryMerge, 0, 0).ok());
+    std::string meta_key;
+    sortkey_count_meta::generate_key("hash_key", meta_key);
+    ASSERT_TRUE(collector.AddUserKey(meta_key, generate_value(0), rocksdb::kEntryPut, 0, 0).ok());
+
+    sst_ttl_properties props = finish(collector);
+    ASSERT_EQ(100, props.min_expire_ts);
+    ASSERT_EQ(100, props.max_expire_ts);
+    ASSERT_EQ(3, props.no_ttl_count);
+    ASSERT_FALSE(props.all_with_ttl());
+    ASSERT_FALSE(props.all_expired(1000));
+}
+
+TEST(ttl_table_properties_collector, disabled)
+{
+    ttl_table_properties_collector collector(1, false);
+    ASSERT_TRUE(collector.AddUserKey("k1", generate_value(100), rocksdb::kEntryPut, 0, 0).ok());
+    rocksdb::UserCollectedProperties props;
+    ASSERT_TRUE(collector.Finish(&props).ok());
+    ASSERT_TRUE(props.empty());
+
+    // files written without the collector are never dropped or skipped
+    sst_ttl_properties ttl_props;
+    ASSERT_FALSE(ttl_props.decode(props));
+}
+
+} // namespace server
+} // namespace pegasus
@@ -0,0 +1,181 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <rocksdb/table_properties.h>
+#include <dsn/utility/rand.h>
+#include <dsn/utility/string_conv.h>
+
+#include "base/pegasus_utils.h"
+#include "base/pegasus_value_schema.h"
+#include "sortkey_count_meta.h"
+
+namespace pegasus {
+namespace server {
+
+// The expire_ts range of records in one sst file, which is stored in the user collected
+// properties of the file by ttl_table_properties_collector.
+struct sst_ttl_properties
+{
+    // random id to identify the file in rocksdb::ReadOptions::table_filter, which can only
+    // see the table properties.
+    uint64_t id{0};
+    // min and max expire_ts of records with ttl, 0 if there is no such record.
+    uint32_t min_expire_ts{0};
+    uint32_t max_expire_ts{0};
+    // count of records which never expire, including merge operands.
+    uint64_t no_ttl_count{0};
+
+    // Return false if the file is written without the collector.
+    bool decode(const rocksdb::UserCollectedProperties &props)
+    {
+        return decode_one(props, PROP_ID, id) &&
+               decode_one(props, PROP_MIN_EXPIRE_TS, min_expire_ts) &&
+               decode_one(props, PROP_MAX_EXPIRE_TS, max_expire_ts) &&
+               decode_one(props, PROP_NO_TTL_COUNT, no_ttl_count);
+    }
+
+    void encode(rocksdb::UserCollectedProperties &props) const
+    {
+        props[PROP_ID] = std::to_string(id);
+        props[PROP_MIN_EXPIRE_TS] = std::to_string(min_expire_ts);
+        props[PROP_MAX_EXPIRE_TS] = std::to_string(max_expire_ts);
+        props[PROP_NO_TTL_COUNT] = std::to_string(no_ttl_count);
+    }
+
+    // Whether all records (except tombstones) have ttl.
+    bool all_with_ttl() const { return no_ttl_count == 0 && max_expire_ts > 0; }
+
+    // Whether all records (except tombstones) have expired at `epoch_now`.
+    bool all_expired(uint32_t epoch_now) const
+    {
+        return all_with_ttl() && check_if_ts_expired(epoch_now, max_expire_ts);
+    }
+
+    static constexpr const char *PROP_ID = "pegasus.ttl.id";
+    static constexpr const char *PROP_MIN_EXPIRE_TS = "pegasus.ttl.min_expire_ts";
+    static constexpr const char *PROP_MAX_EXPIRE_TS = "pegasus.ttl.max_expire_ts";
+    static constexpr const char *PROP_NO_TTL_COUNT = "pegasus.ttl.no_ttl_count";
+
+private:
+    template <typename T>
+    static bool decode_one(const rocksdb::UserCollectedProperties &props, const char *name, T &v)
+    {
+        auto find = props.find(name);
+        if (find == props.end()) {
+            return false;
+        }
+        uint64_t val;
+        if (!dsn::buf2uint64(find->second, val)) {
+            return false;
+        }
+        v = static_cast<T>(val);
+        return true;
+    }
+};
+
+// Collects sst_ttl_properties of each sst file when it is written by flush or compaction.
+class ttl_table_properties_collector : public rocksdb::TablePropertiesCollector
+{
+public:
+    ttl_table_properties_collector(uint32_t pegasus_data_version, bool enabled)
+        : _pegasus_data_version(pegasus_data_version), _enabled(enabled)
+    {
+    }
+
+    rocksdb::Status AddUserKey(const rocksdb::Slice &key,
+                               const rocksdb::Slice &value,
+                               rocksdb::EntryType type,
+                               rocksdb::SequenceNumber /*seq*/,
+                               uint64_t /*file_size*/) override
+    {
+        if (!_enabled) {
+            return rocksdb::Status::OK();
+        }
+
+        switch (type) {
+        case rocksdb::kEntryPut: {
+            if (sortkey_count_meta::is_meta_key(key)) {
+                _props.no_ttl_count++;
+                break;
+            }
+            uint32_t expire_ts =
+                pegasus_extract_expire_ts(_pegasus_data_version, utils::to_string_view(value));
+            if (expire_ts == 0) {
+                _props.no_ttl_count++;
+            } else {
+                if (_props.min_expire_ts == 0 || expire_ts < _props.min_expire_ts) {
+                    _props.min_expire_ts = expire_ts;
+                }
+                if (expire_ts > _props.max_expire_ts) {
+                    _props.max_expire_ts = expire_ts;
+                }
+            }
+            break;
+        }
+        case rocksdb::kEntryDelete:
+        case rocksdb::kEntrySingleDelete:
+            // tombstones are ignored, files are dropped or skipped only if no file under them
+            // overlaps, in which case the tombstones shadow nothing.
+            break;
+        default:
+            _props.no_ttl_count++;
+            break;
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::Status Finish(rocksdb::UserCollectedProperties *properties) override
+    {
+        if (_enabled) {
+            _props.id = dsn::rand::next_u64();
+            _props.encode(*properties);
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::UserCollectedProperties GetReadableProperties() const override
+    {
+        rocksdb::UserCollectedProperties properties;
+        if (_enabled) {
+            _props.encode(properties);
+        }
+        return properties;
+    }
+
+    const char *Name() const override { return "pegasus.TtlTablePropertiesCollector"; }
+
+private:
+    uint32_t _pegasus_data_version;
+    bool _enabled; // only collect when _enabled == true
+    sst_ttl_properties _props;
+};
+
+class ttl_table_properties_collector_factory : public rocksdb::TablePropertiesCollectorFactory
+{
+public:
+    rocksdb::TablePropertiesCollector *
+    CreateTablePropertiesCollector(rocksdb::TablePropertiesCollectorFactory::Context) override
+    {
+        return new ttl_table_properties_collector(_pegasus_data_version.load(), _enabled.load());
+    }
+
+    const char *Name() const override { return "pegasus.TtlTablePropertiesCollectorFactory"; }
+
+    void SetPegasusDataVersion(uint32_t version)
+    {
+        _pegasus_data_version.store(version, std::memory_order_release);
+    }
+    void EnableCollector() { _enabled.store(true, std::memory_order_release); }
+
+private:
+    std::atomic<uint32_t> _pegasus_data_version{0};
+    std::atomic_bool _enabled{false}; // only collect when _enabled == true
+};
+
+} // namespace server
+} // namespace pegasus
@@ -514,8 +514,9 @@ struct row_data
 {
     double get_total_qps() const
     {
-        return get_qps + multi_get_qps + scan_qps + put_qps + multi_put_qps + remove_qps +
-               multi_remove_qps + incr_qps + check_and_set_qps + check_and_mutate_qps;
+        return get_qps + multi_get_qps + batch_get_qps + scan_qps + put_qps + multi_put_qps +
+               remove_qps + multi_remove_qps + incr_qps + multi_incr_qps + check_and_set_qps +
+               check_and_mutate_qps;
     }
 
     double get_total_cu() const { return recent_read_cu + recent_write_cu; }
@@ -525,11 +526,13 @@ struct row_data
     int32_t partition_count = 0;
     double get_qps = 0;
     double multi_get_qps = 0;
+    double batch_get_qps = 0;
     double put_qps = 0;
     double multi_put_qps = 0;
     double remove_qps = 0;
     double multi_remove_qps = 0;
     double incr_qps = 0;
+    double multi_incr_qps = 0;
     double check_and_set_qps = 0;
     double check_and_mutate_qps = 0;
     double scan_qps = 0;
@@ -544,6 +547,8 @@ struct row_data
     double storage_count = 0;
     double rdb_block_cache_hit_count = 0;
     double rdb_block_cache_total_count = 0;
+    double rdb_row_cache_hit_count = 0;
+    double rdb_row_cache_total_count = 0;
     double rdb_index_and_filter_blocks_mem_usage = 0;
     double rdb_memtable_mem_usage = 0;
     double rdb_estimate_num_keys = 0;
@@ -556,6 +561,8 @@ update_app_pegasus_perf_counter(row_data &row, const std::string &counter_name,
         row.get_qps += value;
     else if (counter_name == "multi_get_qps")
         row.multi_get_qps += value;
+    else if (counter_name == "batch_get_qps")
+        row.batch_get_qps += value;
     else if (counter_name == "put_qps")
         row.put_qps += value;
     else if (counter_name == "multi_put_qps")
@@ -566,6 +573,8 @@ update_app_pegasus_perf_counter(row_data &row, const std::string &counter_name,
         row.multi_remove_qps += value;
     else if (counter_name == "incr_qps")
         row.incr_qps += value;
+    else if (counter_name == "multi_incr_qps")
+        row.multi_incr_qps += value;
     else if (counter_name == "check_and_set_qps")
         row.check_and_set_qps += value;
     else if (counter_name == "check_and_mutate_qps")
@@ -594,6 +603,10 @@ update_app_pegasus_perf_counter(row_data &row, const std::string &counter_name,
         row.rdb_block_cache_hit_count += value;
     else if (counter_name == "rdb.block_cache.total_count")
         row.rdb_block_cache_total_count += value;
+    else if (counter_name == "rdb.row_cache.hit_count")
+        row.rdb_row_cache_hit_count += value;
+    else if (counter_name == "rdb.row_cache.total_count")
+        row.rdb_row_cache_total_count += value;
     else if (counter_name == "rdb.index_and_filter_blocks.memory_usage")
         row.rdb_index_and_filter_blocks_mem_usage += value;
     else if (counter_name == "rdb.memtable.memory_usage")
@@ -228,6 +228,8 @@ bool rdb_key_str2hex(command_executor *e, shell_context *sc, arguments args);
 
 bool rdb_value_hex2str(command_executor *e, shell_context *sc, arguments args);
 
+bool build_ingest_sst(command_executor *e, shell_context *sc, arguments args);
+
 // == duplication (see 'commands/duplication.cpp') == //
 
 bool add_dup(command_executor *e, shell_context *sc, arguments args);
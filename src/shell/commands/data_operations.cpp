@@ -11,6 +11,10 @@ print_current_scan_state(const std::vector<std::unique_ptr<scan_data_context>> &
                          std::shared_ptr<rocksdb::Statistics> statistics,
                          bool count_hash_key);
 
+static bool count_data_on_server(shell_context *sc,
+                                 int32_t partition,
+                                 const pegasus::pegasus_client::aggregate_options &options);
+
 void escape_sds_argv(int argc, sds *argv);
 int mutation_check(int args_count, sds *args);
 int load_mutations(shell_context *sc, pegasus::pegasus_client::mutations &mutations);
@@ -1088,6 +1092,7 @@ bool hash_scan(command_executor *e, shell_context *sc, arguments args)
                                            {"value_filter_type", required_argument, 0, 'v'},
                                            {"value_filter_pattern", required_argument, 0, 'z'},
                                            {"no_value", no_argument, 0, 'i'},
+                                           {"reverse", no_argument, 0, 'r'},
                                            {0, 0, 0, 0}};
 
     escape_sds_argv(args.argc, args.argv);
@@ -1095,7 +1100,7 @@ bool hash_scan(command_executor *e, shell_context *sc, arguments args)
     while (true) {
         int option_index = 0;
         int c;
-        c = getopt_long(args.argc, args.argv, "dn:t:o:a:b:s:y:v:z:i", long_options, &option_index);
+        c = getopt_long(args.argc, args.argv, "dn:t:o:a:b:s:y:v:z:ir", long_options, &option_index);
         if (c == -1)
             break;
         switch (c) {
@@ -1158,6 +1163,9 @@ bool hash_scan(command_executor *e, shell_context *sc, arguments args)
         case 'i':
             options.no_value = true;
             break;
+        case 'r':
+            options.reverse = true;
+            break;
         default:
             return false;
         }
@@ -1192,11 +1200,19 @@ bool hash_scan(command_executor *e, shell_context *sc, arguments args)
     fprintf(stderr, "timout_ms: %d\n", timeout_ms);
     fprintf(stderr, "detailed: %s\n", detailed ? "true" : "false");
     fprintf(stderr, "no_value: %s\n", options.no_value ? "true" : "false");
+    fprintf(stderr, "reverse: %s\n", options.reverse ? "true" : "false");
     fprintf(stderr, "\n");
 
     int count = 0;
     pegasus::pegasus_client::pegasus_scanner *scanner = nullptr;
     options.timeout_ms = timeout_ms;
+    if (value_filter_type != pegasus::pegasus_client::FT_NO_FILTER) {
+        if (value_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT)
+            options.value_filter_type = pegasus::pegasus_client::FT_MATCH_PREFIX;
+        else
+            options.value_filter_type = value_filter_type;
+        options.value_filter_pattern = value_filter_pattern;
+    }
     int ret = sc->pg_client->get_scanner(hash_key, start_sort_key, stop_sort_key, options, scanner);
     if (ret != pegasus::PERR_OK) {
         fprintf(file, "ERROR: get scanner failed: %s\n", sc->pg_client->get_error_string(ret));
@@ -1421,6 +1437,13 @@ bool full_scan(command_executor *e, shell_context *sc, arguments args)
             options.sort_key_filter_type = sort_key_filter_type;
         options.sort_key_filter_pattern = sort_key_filter_pattern;
     }
+    if (value_filter_type != pegasus::pegasus_client::FT_NO_FILTER) {
+        if (value_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT)
+            options.value_filter_type = pegasus::pegasus_client::FT_MATCH_PREFIX;
+        else
+            options.value_filter_type = value_filter_type;
+        options.value_filter_pattern = value_filter_pattern;
+    }
     int ret = sc->pg_client->get_unordered_scanners(10000, options, scanners);
     if (ret != pegasus::PERR_OK) {
         fprintf(file, "ERROR: %s\n", sc->pg_client->get_error_string(ret));
@@ -1723,6 +1746,13 @@ bool copy_data(command_executor *e, shell_context *sc, arguments args)
             options.sort_key_filter_type = sort_key_filter_type;
         options.sort_key_filter_pattern = sort_key_filter_pattern;
     }
+    if (value_filter_type != pegasus::pegasus_client::FT_NO_FILTER) {
+        if (value_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT)
+            options.value_filter_type = pegasus::pegasus_client::FT_MATCH_PREFIX;
+        else
+            options.value_filter_type = value_filter_type;
+        options.value_filter_pattern = value_filter_pattern;
+    }
     ret = sc->pg_client->get_unordered_scanners(INT_MAX, options, raw_scanners);
     if (ret != pegasus::PERR_OK) {
         fprintf(stderr,
@@ -1977,6 +2007,13 @@ bool clear_data(command_executor *e, shell_context *sc, arguments args)
             options.sort_key_filter_type = sort_key_filter_type;
         options.sort_key_filter_pattern = sort_key_filter_pattern;
     }
+    if (value_filter_type != pegasus::pegasus_client::FT_NO_FILTER) {
+        if (value_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT)
+            options.value_filter_type = pegasus::pegasus_client::FT_MATCH_PREFIX;
+        else
+            options.value_filter_type = value_filter_type;
+        options.value_filter_pattern = value_filter_pattern;
+    }
     if (value_filter_type != pegasus::pegasus_client::FT_NO_FILTER)
         options.no_value = false;
     else
@@ -2093,6 +2130,7 @@ bool count_data(command_executor *e, shell_context *sc, arguments args)
                                            {"stat_size", no_argument, 0, 'a'},
                                            {"top_count", required_argument, 0, 'n'},
                                            {"run_seconds", required_argument, 0, 'r'},
+                                           {"server_side", no_argument, 0, 'S'},
                                            {0, 0, 0, 0}};
 
     int32_t partition = -1;
@@ -2110,6 +2148,7 @@ bool count_data(command_executor *e, shell_context *sc, arguments args)
     bool stat_size = false;
     int top_count = 0;
     int run_seconds = 0;
+    bool server_side = false;
     pegasus::pegasus_client::scan_options options;
 
     optind = 0;
@@ -2117,7 +2156,7 @@ bool count_data(command_executor *e, shell_context *sc, arguments args)
         int option_index = 0;
         int c;
         c = getopt_long(
-            args.argc, args.argv, "p:b:t:h:x:s:y:v:z:dan:r:", long_options, &option_index);
+            args.argc, args.argv, "p:b:t:h:x:s:y:v:z:dan:r:S", long_options, &option_index);
         if (c == -1)
             break;
         switch (c) {
@@ -2194,6 +2233,9 @@ bool count_data(command_executor *e, shell_context *sc, arguments args)
                 return false;
             }
             break;
+        case 'S':
+            server_side = true;
+            break;
         default:
             return false;
         }
@@ -2248,6 +2290,31 @@ bool count_data(command_executor *e, shell_context *sc, arguments args)
     fprintf(stderr, "INFO: stat_size = %s\n", stat_size ? "true" : "false");
     fprintf(stderr, "INFO: top_count = %d\n", top_count);
     fprintf(stderr, "INFO: run_seconds = %d\n", run_seconds);
+    fprintf(stderr, "INFO: server_side = %s\n", server_side ? "true" : "false");
+
+    if (server_side) {
+        // the whole partition is aggregated on server side, so filters are all pushed down
+        if (sort_key_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT ||
+            value_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT) {
+            fprintf(stderr, "ERROR: filter type 'exact' is not supported with server_side\n");
+            return false;
+        }
+        if (diff_hash_key || run_seconds > 0) {
+            fprintf(stderr, "WARN: diff_hash_key and run_seconds are ignored with server_side\n");
+        }
+        pegasus::pegasus_client::aggregate_options agg_options;
+        agg_options.timeout_ms = timeout_ms;
+        agg_options.batch_size = max_batch_count;
+        agg_options.hash_key_filter_type = options.hash_key_filter_type;
+        agg_options.hash_key_filter_pattern = options.hash_key_filter_pattern;
+        agg_options.sort_key_filter_type = sort_key_filter_type;
+        agg_options.sort_key_filter_pattern = sort_key_filter_pattern;
+        agg_options.value_filter_type = value_filter_type;
+        agg_options.value_filter_pattern = value_filter_pattern;
+        agg_options.stat_size = stat_size;
+        agg_options.top_count = top_count;
+        return count_data_on_server(sc, partition, agg_options);
+    }
 
     std::vector<pegasus::pegasus_client::pegasus_scanner *> raw_scanners;
     options.timeout_ms = timeout_ms;
@@ -2258,6 +2325,13 @@ bool count_data(command_executor *e, shell_context *sc, arguments args)
             options.sort_key_filter_type = sort_key_filter_type;
         options.sort_key_filter_pattern = sort_key_filter_pattern;
     }
+    if (value_filter_type != pegasus::pegasus_client::FT_NO_FILTER) {
+        if (value_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT)
+            options.value_filter_type = pegasus::pegasus_client::FT_MATCH_PREFIX;
+        else
+            options.value_filter_type = value_filter_type;
+        options.value_filter_pattern = value_filter_pattern;
+    }
     if (stat_size || value_filter_type != pegasus::pegasus_client::FT_NO_FILTER)
         options.no_value = false;
     else
@@ -2419,6 +2493,146 @@ bool count_data(command_executor *e, shell_context *sc, arguments args)
     return true;
 }
 
+static void print_size_histogram(const char *name,
+                                 const pegasus::pegasus_client::size_histogram &h)
+{
+    if (h.count == 0) {
+        return;
+    }
+    // the percentile is estimated by the upper bound of the bucket it falls in
+    auto percentile = [&h](double p) -> int64_t {
+        int64_t threshold = static_cast<int64_t>(h.count * p);
+        int64_t accumulated = 0;
+        for (size_t i = 0; i < h.buckets.size(); i++) {
+            accumulated += h.buckets[i];
+            if (accumulated > threshold) {
+                return std::min(i == 0 ? 0 : (int64_t(1) << i) - 1, h.max);
+            }
+        }
+        return h.max;
+    };
+    fprintf(stderr,
+            "[%s] count = %" PRId64 ", sum = %" PRId64 ", avg = %.2f, max = %" PRId64
+            ", p50 <= %" PRId64 ", p99 <= %" PRId64 "\n",
+            name,
+            h.count,
+            h.sum,
+            (double)h.sum / h.count,
+            h.max,
+            percentile(0.5),
+            percentile(0.99));
+}
+
+static bool count_data_on_server(shell_context *sc,
+                                 int32_t partition,
+                                 const pegasus::pegasus_client::aggregate_options &options)
+{
+    int32_t app_id;
+    int32_t partition_count;
+    std::vector<::dsn::partition_configuration> partitions;
+    ::dsn::error_code err =
+        sc->ddl_client->list_app(sc->current_app_name, app_id, partition_count, partitions);
+    if (err != ::dsn::ERR_OK) {
+        fprintf(stderr, "ERROR: list app failed: %s\n", err.to_string());
+        return true;
+    }
+    if (partition >= partition_count) {
+        fprintf(stderr, "ERROR: invalid partition param: %d\n", partition);
+        return true;
+    }
+
+    std::vector<int> split_partitions;
+    if (partition >= 0) {
+        split_partitions.push_back(partition);
+    } else {
+        for (int i = 0; i < partition_count; i++)
+            split_partitions.push_back(i);
+    }
+    int split_count = split_partitions.size();
+    fprintf(stderr, "INFO: aggregate on server side, split_count = %d\n", split_count);
+
+    std::vector<int> split_errors(split_count, pegasus::PERR_OK);
+    std::vector<pegasus::pegasus_client::aggregate_results> split_results(split_count);
+    std::atomic_int completed_split_count(0);
+    for (int i = 0; i < split_count; i++) {
+        sc->pg_client->async_aggregate_partition(
+            split_partitions[i],
+            options,
+            [&, i](int ec,
+                   pegasus::pegasus_client::aggregate_results &&results,
+                   pegasus::pegasus_client::internal_info &&info) {
+                split_errors[i] = ec;
+                split_results[i] = std::move(results);
+                completed_split_count++;
+            });
+    }
+
+    int sleep_seconds = 0;
+    while (completed_split_count.load() < split_count) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        sleep_seconds++;
+        fprintf(stderr,
+                "INFO: processed for %d seconds, (%d/%d) splits\n",
+                sleep_seconds,
+                completed_split_count.load(),
+                split_count);
+    }
+
+    pegasus::pegasus_client::aggregate_results total;
+    bool error_occurred = false;
+    std::vector<pegasus::pegasus_client::top_row> top_rows;
+    for (int i = 0; i < split_count; i++) {
+        if (split_errors[i] != pegasus::PERR_OK) {
+            fprintf(stderr,
+                    "ERROR: aggregate partition %d failed: %s\n",
+                    split_partitions[i],
+                    sc->pg_client->get_error_string(split_errors[i]));
+            error_occurred = true;
+            continue;
+        }
+        const pegasus::pegasus_client::aggregate_results &r = split_results[i];
+        total.row_count += r.row_count;
+        total.hash_key_count += r.hash_key_count;
+        total.hash_key_size.merge(r.hash_key_size);
+        total.sort_key_size.merge(r.sort_key_size);
+        total.value_size.merge(r.value_size);
+        total.row_size.merge(r.row_size);
+        top_rows.insert(top_rows.end(), r.top_rows.begin(), r.top_rows.end());
+    }
+
+    fprintf(stderr,
+            "INFO: %s, total %" PRId64 " rows (%" PRId64 " hash keys)\n",
+            error_occurred ? "terminated as error occurred" : "done",
+            total.row_count,
+            total.hash_key_count);
+    if (options.stat_size) {
+        print_size_histogram("hash_key_size", total.hash_key_size);
+        print_size_histogram("sort_key_size", total.sort_key_size);
+        print_size_histogram("value_size", total.value_size);
+        print_size_histogram("row_size", total.row_size);
+
+        std::sort(top_rows.begin(),
+                  top_rows.end(),
+                  [](const pegasus::pegasus_client::top_row &l,
+                     const pegasus::pegasus_client::top_row &r) {
+                      return l.row_size > r.row_size;
+                  });
+        for (int i = 1; i <= options.top_count && i <= top_rows.size(); i++) {
+            const pegasus::pegasus_client::top_row &item = top_rows[i - 1];
+            fprintf(stderr,
+                    "[top][%d].hash_key = \"%s\"\n",
+                    i,
+                    pegasus::utils::c_escape_string(item.hash_key, sc->escape_all).c_str());
+            fprintf(stderr,
+                    "[top][%d].sort_key = \"%s\"\n",
+                    i,
+                    pegasus::utils::c_escape_string(item.sort_key, sc->escape_all).c_str());
+            fprintf(stderr, "[top][%d].row_size = %" PRId64 "\n", i, item.row_size);
+        }
+    }
+    return true;
+}
+
 std::string unescape_str(const char *escaped)
 {
     std::string dst, src = escaped;
@@ -7,6 +7,9 @@
 #include <rocksdb/utilities/ldb_cmd.h>
 #include <fmt/time.h>
 
+#include "base/pegasus_const.h"
+#include "base/pegasus_sst_builder.h"
+
 bool sst_dump(command_executor *e, shell_context *sc, arguments args)
 {
     rocksdb::SSTDumpTool tool;
@@ -129,6 +132,17 @@ bool mlog_dump(command_executor *e, shell_context *sc, arguments args)
                        << pegasus::utils::c_escape_string(hash_key, sc->escape_all) << "\" : \""
                        << pegasus::utils::c_escape_string(sort_key, sc->escape_all) << "\" => "
                        << update.increment << std::endl;
+                } else if (msg->local_rpc_code == ::dsn::apps::RPC_RRDB_RRDB_MULTI_INCR) {
+                    ::dsn::apps::multi_incr_request update;
+                    ::dsn::unmarshall(request, update);
+                    os << INDENT << "[MULTI_INCR] " << update.items.size() << std::endl;
+                    for (::dsn::apps::incr_item &item : update.items) {
+                        os << INDENT << INDENT << "[INCR] \""
+                           << pegasus::utils::c_escape_string(update.hash_key, sc->escape_all)
+                           << "\" : \""
+                           << pegasus::utils::c_escape_string(item.sort_key, sc->escape_all)
+                           << "\" => " << item.increment << std::endl;
+                    }
                 } else {
                     os << INDENT << "ERROR: unsupported code "
                        << ::dsn::task_code(msg->local_rpc_code).to_string() << "("
@@ -241,3 +255,127 @@ bool rdb_value_hex2str(command_executor *e, shell_context *sc, arguments args)
             pegasus::utils::c_escape_string(user_data.to_string(), sc->escape_all).c_str());
     return true;
 }
+
+bool build_ingest_sst(command_executor *e, shell_context *sc, arguments args)
+{
+    static struct option long_options[] = {{"input", required_argument, 0, 'i'},
+                                           {"output", required_argument, 0, 'o'},
+                                           {"partition_count", required_argument, 0, 'p'},
+                                           {"data_version", required_argument, 0, 'd'},
+                                           {"max_buffer_mb", required_argument, 0, 'm'},
+                                           {0, 0, 0, 0}};
+
+    std::string input;
+    std::string output;
+    int32_t partition_count = 0;
+    int32_t data_version = pegasus::PEGASUS_DATA_VERSION_MAX;
+    uint64_t max_buffer_mb = 256;
+    optind = 0;
+    while (true) {
+        int option_index = 0;
+        int c;
+        c = getopt_long(args.argc, args.argv, "i:o:p:d:m:", long_options, &option_index);
+        if (c == -1)
+            break;
+        switch (c) {
+        case 'i':
+            input = optarg;
+            break;
+        case 'o':
+            output = optarg;
+            break;
+        case 'p':
+            if (!dsn::buf2int32(optarg, partition_count) || partition_count <= 0) {
+                fprintf(stderr, "ERROR: invalid partition_count %s\n", optarg);
+                return false;
+            }
+            break;
+        case 'd':
+            if (!dsn::buf2int32(optarg, data_version) || data_version < 0 ||
+                data_version > pegasus::PEGASUS_DATA_VERSION_MAX) {
+                fprintf(stderr, "ERROR: invalid data_version %s\n", optarg);
+                return false;
+            }
+            break;
+        case 'm':
+            if (!dsn::buf2uint64(optarg, max_buffer_mb) || max_buffer_mb == 0) {
+                fprintf(stderr, "ERROR: invalid max_buffer_mb %s\n", optarg);
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    if (input.empty() || output.empty() || partition_count == 0) {
+        fprintf(stderr, "ERROR: input, output and partition_count must be specified\n");
+        return false;
+    }
+    if (dsn::utils::filesystem::path_exists(output)) {
+        fprintf(stderr, "ERROR: output %s already exists\n", output.c_str());
+        return true;
+    }
+    if (!dsn::utils::filesystem::create_directory(output)) {
+        fprintf(stderr, "ERROR: create output dir %s failed\n", output.c_str());
+        return true;
+    }
+
+    std::ifstream is(input);
+    if (!is) {
+        fprintf(stderr, "ERROR: open input file %s failed\n", input.c_str());
+        return true;
+    }
+
+    // each line is "<hash_key>\t<sort_key>\t<value>[\t<ttl_seconds>]", the strings are escaped
+    // as the output of the scan commands.
+    pegasus::pegasus_sst_builder builder(
+        output, partition_count, data_version, max_buffer_mb * 1024 * 1024);
+    std::string line;
+    uint64_t line_no = 0;
+    while (std::getline(is, line)) {
+        line_no++;
+        std::vector<std::string> fields;
+        size_t begin = 0;
+        for (size_t pos = line.find('\t'); pos != std::string::npos; pos = line.find('\t', begin)) {
+            fields.emplace_back(line.substr(begin, pos - begin));
+            begin = pos + 1;
+        }
+        fields.emplace_back(line.substr(begin));
+        int32_t ttl_seconds = 0;
+        if ((fields.size() != 3 && fields.size() != 4) ||
+            (fields.size() == 4 && (!dsn::buf2int32(fields[3], ttl_seconds) || ttl_seconds < 0))) {
+            fprintf(stderr, "ERROR: invalid line %" PRIu64 ": %s\n", line_no, line.c_str());
+            return true;
+        }
+        std::string hash_key, sort_key, value;
+        if (pegasus::utils::c_unescape_string(fields[0], hash_key) < 0 ||
+            pegasus::utils::c_unescape_string(fields[1], sort_key) < 0 ||
+            pegasus::utils::c_unescape_string(fields[2], value) < 0) {
+            fprintf(stderr, "ERROR: invalid escaped string in line %" PRIu64 "\n", line_no);
+            return true;
+        }
+        uint32_t expire_ts = ttl_seconds > 0 ? pegasus::utils::epoch_now() + ttl_seconds : 0;
+        rocksdb::Status status = builder.add(hash_key, sort_key, value, expire_ts);
+        if (!status.ok()) {
+            fprintf(stderr,
+                    "ERROR: add line %" PRIu64 " failed: %s\n",
+                    line_no,
+                    status.ToString().c_str());
+            return true;
+        }
+    }
+
+    rocksdb::Status status = builder.finish();
+    if (!status.ok()) {
+        fprintf(stderr, "ERROR: build sst files failed: %s\n", status.ToString().c_str());
+        return true;
+    }
+    fprintf(stderr,
+            "build %" PRIu64 " records into %" PRIu64 " sst files in %s, set app env "
+            "\"%s\" to ingest them\n",
+            builder.record_count(),
+            builder.file_count(),
+            output.c_str(),
+            pegasus::ROCKSDB_ENV_BULK_INGEST_DIR.c_str());
+    return true;
+}
@@ -472,11 +472,13 @@ bool app_stat(command_executor *e, shell_context *sc, arguments args)
         sum.partition_count += row.partition_count;
         sum.get_qps += row.get_qps;
         sum.multi_get_qps += row.multi_get_qps;
+        sum.batch_get_qps += row.batch_get_qps;
         sum.put_qps += row.put_qps;
         sum.multi_put_qps += row.multi_put_qps;
         sum.remove_qps += row.remove_qps;
         sum.multi_remove_qps += row.multi_remove_qps;
         sum.incr_qps += row.incr_qps;
+        sum.multi_incr_qps += row.multi_incr_qps;
         sum.check_and_set_qps += row.check_and_set_qps;
         sum.check_and_mutate_qps += row.check_and_mutate_qps;
         sum.scan_qps += row.scan_qps;
@@ -491,6 +493,8 @@ bool app_stat(command_executor *e, shell_context *sc, arguments args)
         sum.storage_count += row.storage_count;
         sum.rdb_block_cache_hit_count += row.rdb_block_cache_hit_count;
         sum.rdb_block_cache_total_count += row.rdb_block_cache_total_count;
+        sum.rdb_row_cache_hit_count += row.rdb_row_cache_hit_count;
+        sum.rdb_row_cache_total_count += row.rdb_row_cache_total_count;
         sum.rdb_index_and_filter_blocks_mem_usage += row.rdb_index_and_filter_blocks_mem_usage;
         sum.rdb_memtable_mem_usage += row.rdb_memtable_mem_usage;
     }
@@ -515,11 +519,13 @@ bool app_stat(command_executor *e, shell_context *sc, arguments args)
     if (!only_usage) {
         tp.add_column("GET", tp_alignment::kRight);
         tp.add_column("MGET", tp_alignment::kRight);
+        tp.add_column("BGET", tp_alignment::kRight);
         tp.add_column("PUT", tp_alignment::kRight);
         tp.add_column("MPUT", tp_alignment::kRight);
         tp.add_column("DEL", tp_alignment::kRight);
         tp.add_column("MDEL", tp_alignment::kRight);
         tp.add_column("INCR", tp_alignment::kRight);
+        tp.add_column("MINCR", tp_alignment::kRight);
         tp.add_column("CAS", tp_alignment::kRight);
         tp.add_column("CAM", tp_alignment::kRight);
         tp.add_column("SCAN", tp_alignment::kRight);
@@ -538,6 +544,7 @@ bool app_stat(command_executor *e, shell_context *sc, arguments args)
         tp.add_column("mem_idx_mb", tp_alignment::kRight);
     }
     tp.add_column("hit_rate", tp_alignment::kRight);
+    tp.add_column("row_hit_rate", tp_alignment::kRight);
 
     for (row_data &row : rows) {
         tp.add_row(row.row_name);
@@ -548,11 +555,13 @@ bool app_stat(command_executor *e, shell_context *sc, arguments args)
         if (!only_usage) {
             tp.append_data(row.get_qps);
             tp.append_data(row.multi_get_qps);
+            tp.append_data(row.batch_get_qps);
             tp.append_data(row.put_qps);
             tp.append_data(row.multi_put_qps);
             tp.append_data(row.remove_qps);
             tp.append_data(row.multi_remove_qps);
             tp.append_data(row.incr_qps);
+            tp.append_data(row.multi_incr_qps);
             tp.append_data(row.check_and_set_qps);
             tp.append_data(row.check_and_mutate_qps);
             tp.append_data(row.scan_qps);
@@ -575,6 +584,11 @@ bool app_stat(command_executor *e, shell_context *sc, arguments args)
                 ? 0.0
                 : row.rdb_block_cache_hit_count / row.rdb_block_cache_total_count;
         tp.append_data(block_cache_hit_rate);
+        double row_cache_hit_rate =
+            std::abs(row.rdb_row_cache_total_count) < 1e-6
+                ? 0.0
+                : row.rdb_row_cache_hit_count / row.rdb_row_cache_total_count;
+        tp.append_data(row_cache_hit_rate);
     }
     tp.output(out, json ? tp_output_format::kJsonPretty : tp_output_format::kTabular);
 
@@ -234,7 +234,7 @@ static command_executor commands[] = {
         "[-v|--value_filter_type anywhere|prefix|postfix|exact] "
         "[-z|--value_filter_pattern str] "
         "[-o|--output file_name] [-n|--max_count num] [-t|--timeout_ms num] "
-        "[-d|--detailed] [-i|--no_value]",
+        "[-d|--detailed] [-i|--no_value] [-r|--reverse]",
         data_operations,
     },
     {
@@ -287,7 +287,8 @@ static command_executor commands[] = {
         "[-y|--sort_key_filter_pattern str] "
         "[-v|--value_filter_type anywhere|prefix|postfix|exact] "
         "[-z|--value_filter_pattern str] "
-        "[-d|--diff_hash_key] [-a|--stat_size] [-n|--top_count num] [-r|--run_seconds num]",
+        "[-d|--diff_hash_key] [-a|--stat_size] [-n|--top_count num] [-r|--run_seconds num] "
+        "[-S|--server_side]",
         data_operations,
     },
     {
@@ -350,6 +351,13 @@ static command_executor commands[] = {
         "[--from=user_key] [--to=user_key] [--read_num=num] [--show_properties] [--pegasus_data]",
         sst_dump,
     },
+    {
+        "build_ingest_sst",
+        "build sst files from a local file for bulk ingestion into a table",
+        "<-i|--input file_name> <-o|--output dir> <-p|--partition_count num> "
+        "[-d|--data_version num] [-m|--max_buffer_mb num]",
+        build_ingest_sst,
+    },
     {
         "mlog_dump",
         "dump mutation log dir",